@@ -511,6 +511,8 @@ namespace rs2
                     throw std::runtime_error("not a valid format");
                 case RS2_FORMAT_Z16H:
                     throw std::runtime_error("unexpected format: Z16H. Check decoder processing block");
+                case RS2_FORMAT_Z16RVL:
+                    throw std::runtime_error("unexpected format: Z16RVL. Check decoder processing block");
                 case RS2_FORMAT_Z16:
                 case RS2_FORMAT_DISPARITY16:
                 case RS2_FORMAT_DISPARITY32:
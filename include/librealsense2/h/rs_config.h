@@ -129,6 +129,19 @@ extern "C" {
     */
     void rs2_config_enable_record_to_file(rs2_config* config, const char* file, rs2_error ** error);
 
+    /**
+    * Deliver only the latest frames to the pipeline's wait_for_frames, poll_for_frames and try_wait_for_frames: a
+    * frameset that was not retrieved yet is replaced by the next one, and released right away, so a slow consumer
+    * always gets data that is at most one frame period old rather than a backlog. Use rs2_get_frame_age to see how
+    * old the frames are. In non-real-time playback, this means frames are skipped instead of waited for.
+    * Off by default. Has no effect on a pipeline started with a callback.
+    *
+    * \param[in] config    A pointer to an instance of a config
+    * \param[in] enable    Non-zero for only the latest frames, zero to queue frames
+    * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+    */
+    void rs2_config_enable_latest_frames_only(rs2_config* config, int enable, rs2_error ** error);
+
 
     /**
     * Disable a device stream explicitly, to remove any requests on this stream type.
@@ -14,6 +14,7 @@
 extern "C" {
 #endif
 #include "rs_types.h"
+#include "rs_sensor.h"
 
 /** \brief Specifies the clock in relation to which the frame timestamp was measured. */
 typedef enum rs2_timestamp_domain
@@ -90,6 +91,26 @@ typedef enum rs2_calib_target_type
 } rs2_calib_target_type;
 const char* rs2_calib_target_type_to_string(rs2_calib_target_type type);
 
+/** \brief The commonly-used fields of a frame, as retrieved together by rs2_get_frame_view(). */
+typedef struct rs2_frame_view
+{
+    const void*                 data;               /**< Pointer to the start of the frame data, valid as long as the frame is */
+    int                         data_size;          /**< Size of the frame data, in bytes */
+    int                         width;              /**< Width in pixels; 0 if not a video frame */
+    int                         height;             /**< Height in pixels; 0 if not a video frame */
+    int                         stride_in_bytes;    /**< Bytes from the start of one line to the next; 0 if not a video frame */
+    int                         bits_per_pixel;     /**< Bits per pixel; 0 if not a video frame */
+    rs2_format                  format;             /**< Format of the frame's stream */
+    rs2_stream                  stream;             /**< Type of the frame's stream */
+    int                         stream_index;       /**< Index of the frame's stream */
+    int                         unique_id;          /**< Unique identifier of the frame's stream profile */
+    const rs2_stream_profile*   profile;            /**< The frame's stream profile, valid as long as the frame is */
+    rs2_time_t                  timestamp;          /**< Frame timestamp, in milliseconds */
+    rs2_timestamp_domain        timestamp_domain;   /**< Clock the timestamp relates to */
+    unsigned long long          frame_number;       /**< Frame number */
+    float                       depth_units;        /**< Meters per unit of depth data; 0 if not a depth frame */
+} rs2_frame_view;
+
 /**
 * retrieve metadata from frame handle
 * \param[in] frame      handle returned from a callback
@@ -126,6 +147,15 @@ rs2_timestamp_domain rs2_get_frame_timestamp_domain(const rs2_frame* frameset, r
 */
 rs2_time_t rs2_get_frame_timestamp(const rs2_frame* frame, rs2_error** error);
 
+/**
+* retrieve how long ago a frame arrived at the host, by the host clock (see RS2_FRAME_METADATA_TIME_OF_ARRIVAL);
+* for a frameset, how long ago the oldest of its frames did. Frames played back from a file arrived when recorded.
+* \param[in] frame      handle returned from a callback
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               the age of the frame in milliseconds
+*/
+rs2_time_t rs2_get_frame_age(const rs2_frame* frame, rs2_error** error);
+
 /**
 * retrieve frame parent sensor from frame handle
 * \param[in] frame      handle returned from a callback
@@ -197,6 +227,16 @@ int rs2_get_frame_stride_in_bytes(const rs2_frame* frame, rs2_error** error);
 */
 int rs2_get_frame_bits_per_pixel(const rs2_frame* frame, rs2_error** error);
 
+/**
+* retrieve the commonly-used fields of a frame in a single call, rather than one call per field
+* unlike other frame accessors, calls are not traced by the API logger
+* the view includes the data pointer: for frames processed on the GPU, that copies the frame back to memory
+* \param[in] frame      handle returned from a callback
+* \param[out] view      receives the frame fields
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_get_frame_view(const rs2_frame* frame, rs2_frame_view* view, rs2_error** error);
+
 /**
 * create additional reference to a frame without duplicating frame data
 * \param[in] frame      handle returned from a callback
@@ -359,6 +399,23 @@ void rs2_synthetic_frame_ready(rs2_source* source, rs2_frame* frame, rs2_error**
 */
 void rs2_pose_frame_get_pose_data(const rs2_frame* frame, rs2_pose* pose, rs2_error** error);
 
+/**
+* When called on a motion batch frame, returns the number of samples it holds. The frame data is their motion data,
+* one rs2_vector per sample.
+* \param[in] frame       Motion batch frame
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                Number of samples
+*/
+int rs2_motion_batch_frame_get_sample_count(const rs2_frame* frame, rs2_error** error);
+
+/**
+* When called on a motion batch frame, returns the timestamps of its samples, in the frame's timestamp domain
+* \param[in] frame       Motion batch frame
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return                One timestamp per sample, valid as long as the frame is
+*/
+const double* rs2_motion_batch_frame_get_timestamps(const rs2_frame* frame, rs2_error** error);
+
 /**
 * Extract the target dimensions on the specific target
 * \param[in] frame            Left or right camera frame of specified size based on the target type
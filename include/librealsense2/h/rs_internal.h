@@ -522,6 +522,30 @@ unsigned int rs2_get_fw_log_parsed_timestamp(rs2_firmware_log_parsed_message* fw
 */
 unsigned int rs2_get_fw_log_parsed_sequence_id(rs2_firmware_log_parsed_message* fw_log_parsed_msg, rs2_error** error);
 
+/**
+* \brief Creates a RealSense firmware logs parser, for logs captured raw and formatted later (and elsewhere)
+* \param[in] xml_content    content of the xml file needed for parsing
+* \param[out] error         If non-null, receives any error that occurs during this call, otherwise, errors are ignored.
+* \return                   pointer to created firmware logs parser object
+*/
+rs2_firmware_log_parser* rs2_create_fw_log_parser(const char* xml_content, rs2_error** error);
+
+/**
+* \brief Deletes RealSense firmware logs parser.
+* \param[in] parser         firmware logs parser to be deleted
+*/
+void rs2_delete_fw_log_parser(rs2_firmware_log_parser* parser);
+
+/**
+* \brief Parses a buffer of raw firmware logs, as concatenated from rs2_fw_log_message_data, all at once
+* \param[in] parser         firmware logs parser object
+* \param[in] raw_logs       the raw logs
+* \param[in] size           size of the raw logs buffer; a trailing partial log is ignored
+* \param[out] error         If non-null, receives any error that occurs during this call, otherwise, errors are ignored.
+* \return                   text with a line per log: timestamp, sequence id, severity, thread name, file name, line and message
+*/
+rs2_raw_data_buffer* rs2_parse_raw_fw_logs(rs2_firmware_log_parser* parser, const void* raw_logs, unsigned int size, rs2_error** error);
+
 /**
 * \brief Creates RealSense terminal parser.
 * \param[in] xml_content    content of the xml file needed for parsing
@@ -35,6 +35,103 @@ rs2_processing_block* rs2_create_colorizer(rs2_error** error);
 */
 rs2_processing_block* rs2_create_sync_processing_block(rs2_error** error);
 
+/**
+* Creates a multi-device syncer processing block. This block accepts frames or framesets from several devices and
+* outputs one composite frame per time slot, containing what each stream contributed to it. A frameset is handled as
+* one stream, that of its first frame, so feeding it per-device framesets (e.g., from each device's syncer) matches
+* whole framesets.
+* For frames to be comparable across devices, their timestamps must be in RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME (enable
+* RS2_OPTION_GLOBAL_TIME_ENABLED), or the devices must be hardware-synced and matched by frame counter.
+* \param[in] match_frame_counter  if non-zero, match by frame number rather than by timestamp
+* \param[in] tolerance            maximal difference between frames of the same slot, in milliseconds (or frames)
+* \param[in] queue_size           maximal number of frames held per stream; the oldest are dropped under load
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_multi_device_syncer(int match_frame_counter, double tolerance, int queue_size, rs2_error** error);
+
+/**
+* Creates a motion batcher processing block. This block accepts motion frames and outputs motion batch frames, each
+* holding the consecutive samples of one stream; other frames are passed through.
+* \param[in] latency      a batch is released once it spans this many milliseconds of sample time, or was held
+*                         about as long when no more samples come
+* \param[in] max_samples  a batch is released once it holds this many samples
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_motion_batcher(double latency, int max_samples, rs2_error** error);
+
+/**
+* Sets the intrinsics (scale, cross-axis and bias) the motion batcher applies to the batches of a stream type: each
+* sample becomes the 3x3 matrix in intrinsics->data times the sample, minus the bias in the last column. The whole
+* batch is corrected at once, so an application's own IMU calibration costs little more than the copy.
+* \param[in] block       the motion batcher
+* \param[in] stream      the stream type, e.g. RS2_STREAM_ACCEL or RS2_STREAM_GYRO, whose batches to correct
+* \param[in] intrinsics  the correction to apply, replacing any set before for the stream type
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_motion_batcher_set_intrinsics(rs2_processing_block* block, rs2_stream stream, const rs2_motion_device_intrinsic* intrinsics, rs2_error** error);
+
+/** \brief Depth quality metrics of a frame, of a flat target, as measured by the Depth Quality Tool. */
+typedef struct rs2_depth_metrics
+{
+    unsigned long long frame_number; /**< The frame the metrics are of */
+    double             timestamp;    /**< Its timestamp, in milliseconds */
+    float              fill_rate;    /**< Percent of the ROI pixels that have depth */
+    int                plane_fit;    /**< Non-zero if a plane was fit to the ROI; the metrics below are valid only then */
+    float              distance_mm;  /**< Distance from the camera to the plane, along its normal */
+    float              angle;        /**< Angle between the plane and the image plane, in degrees */
+    float              plane_fit_rms_mm; /**< RMS of the distances of the points from the plane (spatial noise) */
+    float              plane_fit_rms;    /**< Same, in percent of the distance */
+    float              subpixel_rms; /**< RMS of the disparity errors, in pixels; 0 for a depth sensor that is not stereo */
+    float              z_accuracy;   /**< Median error relative to the ground truth, in percent; 0 when there is none */
+} rs2_depth_metrics;
+
+/**
+* Creates a depth metrics processing block. This block accepts depth frames and passes them through as they are,
+* measuring each: a plane is fit to the points of a region of interest, and how the depth deviates from it is
+* available with rs2_depth_metrics_get, for the latest frame.
+* The 0.5% nearest and 0.5% farthest points are not included in the RMS and accuracy metrics.
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_depth_metrics(rs2_error** error);
+
+/**
+* Sets the region of interest of a depth metrics block; by default, it is the center 40% of the frame
+* \param[in] block  the depth metrics block
+* \param[in] min_x, min_y, max_x, max_y  the region, in pixels, max exclusive; it is clipped to the frame
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_depth_metrics_set_roi(rs2_processing_block* block, int min_x, int min_y, int max_x, int max_y, rs2_error** error);
+
+/**
+* Sets the actual distance of the target, for the Z accuracy of a depth metrics block
+* \param[in] block          the depth metrics block
+* \param[in] ground_truth   distance to the target, in millimeters, or 0 when not known (the default)
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_depth_metrics_set_ground_truth(rs2_processing_block* block, float ground_truth, rs2_error** error);
+
+/**
+* Retrieves the metrics of the latest frame a depth metrics block has processed
+* \param[in] block     the depth metrics block
+* \param[out] metrics  the metrics; all zero before the first frame
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_depth_metrics_get(rs2_processing_block* block, rs2_depth_metrics* metrics, rs2_error** error);
+
+/**
+* Creates a depth encoder processing block. This block accepts Z16 depth frames and compresses them, losslessly, to
+* RS2_FORMAT_Z16RVL video frames of the same width and height, typically 3-5 times smaller, for recording or sending.
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_depth_encoder(rs2_error** error);
+
+/**
+* Creates a depth decoder processing block. This block accepts RS2_FORMAT_Z16RVL frames and outputs the Z16 depth
+* frames they were compressed from.
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+rs2_processing_block* rs2_create_depth_decoder(rs2_error** error);
+
 /**
 * Creates Point-Cloud processing block. This block accepts depth frames and outputs Points frames
 * In addition, given non-depth frame, the block will align texture coordinate to the non-depth stream
@@ -48,6 +48,18 @@ rs2_device* rs2_create_record_device(const rs2_device* device, const char* file,
 */
 rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* file, int compression_enabled, rs2_error** error);
 
+/**
+* Creates a recording device to record the given device and save it to the given file, with its Z16 depth losslessly
+* compressed (RS2_FORMAT_Z16RVL), typically 3-5 times smaller. Playback decompresses it: the depth is played back as
+* Z16, as it was recorded. Versions that do not know this format cannot play such a file back.
+* \param[in]  device                The device to record
+* \param[in]  file                  The desired path to which the recorder should save the data
+* \param[in]  compression_enabled   Indicates if the file is compressed as well, 0 means false, otherwise true
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return A pointer to a device that records its data to file, or null in case of failure
+*/
+rs2_device* rs2_create_record_device_with_depth_compression(const rs2_device* device, const char* file, int compression_enabled, rs2_error** error);
+
 /**
 * Pause the recording device without stopping the actual device from streaming.
 * Pausing will cause the device to stop writing new data to the file, in particular, frames and changes to extensions
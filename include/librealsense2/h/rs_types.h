@@ -189,6 +189,11 @@ typedef enum rs2_extension
     RS2_EXTENSION_MAX_USABLE_RANGE_SENSOR,
     RS2_EXTENSION_DEBUG_STREAM_SENSOR,
     RS2_EXTENSION_CALIBRATION_CHANGE_DEVICE,
+    RS2_EXTENSION_MOTION_BATCH_FRAME,
+    RS2_EXTENSION_DEPTH_METRICS_FILTER,
+    RS2_EXTENSION_DEPTH_ENCODER,
+    RS2_EXTENSION_DEPTH_DECODER,
+    RS2_EXTENSION_MOTION_BATCHER,
     RS2_EXTENSION_COUNT
 } rs2_extension;
 const char* rs2_extension_type_to_string(rs2_extension type);
@@ -14,6 +14,14 @@
 #include <iostream>
 #include <thread>
 #include <chrono>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
 namespace rs2
 {
     struct vec3d {
@@ -50,8 +58,8 @@ namespace rs2
             register_simple_option(OPTION_PLY_THRESHOLD, option_range{ 0, 1, 0.05f, 0 });
         }
 
-    private:
-        void func(frame data, frame_source& source)
+        // Saves the point-cloud of a depth frame (or of the depth and color in a frameset) to 'filename'
+        void save(frame data, const std::string& filename)
         {
             frame depth, color;
             if (auto fs = data.as<frameset>()) {
@@ -70,25 +78,38 @@ namespace rs2
                 depth = _pc.calculate(depth);
             }
 
-            export_to_ply(depth, color);
+            export_to_ply(depth, color, filename);
+        }
+
+    private:
+        void func(frame data, frame_source& source)
+        {
+            save(data, fname);
             source.frame_ready(data); // passthrough filter because processing_block::process doesn't support sinks
         }
 
-        void export_to_ply(points p, video_frame color) {
+        template<class T>
+        static char* put(char* out, const T& value)
+        {
+            // we assume little endian architecture on your device
+            memcpy(out, &value, sizeof(T));
+            return out + sizeof(T);
+        }
+
+        void export_to_ply(points p, video_frame color, const std::string& filename) {
             const bool use_texcoords  = color && !get_option(OPTION_IGNORE_COLOR);
             bool mesh = get_option(OPTION_PLY_MESH) != 0;
             bool binary = get_option(OPTION_PLY_BINARY) != 0;
-            bool use_normals = get_option(OPTION_PLY_NORMALS) != 0;
+            bool use_normals = mesh && get_option(OPTION_PLY_NORMALS) != 0;
             const auto verts = p.get_vertices();
             const auto texcoords = p.get_texture_coordinates();
-            const uint8_t* texture_data;
+            const uint8_t* texture_data = nullptr;
             if (use_texcoords) // texture might be on the gpu, get pointer to data before for-loop to avoid repeated access
                 texture_data = reinterpret_cast<const uint8_t*>(color.get_data());
             std::vector<rs2::vertex> new_verts;
             std::vector<vec3d> normals;
             std::vector<std::array<uint8_t, 3>> new_tex;
-            std::map<size_t, size_t> idx_map;
-            std::map<size_t, std::vector<vec3d>> index_to_normals;
+            std::vector<int> idx_map(p.size(), -1);  // -1 for points that are not saved
 
             new_verts.reserve(p.size());
             if (use_texcoords) new_tex.reserve(p.size());
@@ -99,7 +120,7 @@ namespace rs2
                 if (fabs(verts[i].x) >= min_distance || fabs(verts[i].y) >= min_distance ||
                     fabs(verts[i].z) >= min_distance)
                 {
-                    idx_map[int(i)] = int(new_verts.size());
+                    idx_map[i] = int(new_verts.size());
                     new_verts.push_back({ verts[i].x, -1 * verts[i].y, -1 * verts[i].z });
                     if (use_texcoords)
                     {
@@ -110,20 +131,21 @@ namespace rs2
             }
 
             auto profile = p.get_profile().as<video_stream_profile>();
-            auto width = profile.width(), height = profile.height();
-            static const auto threshold = get_option(OPTION_PLY_THRESHOLD);
-            std::vector<std::array<size_t, 3>> faces;
+            size_t width = profile.width(), height = profile.height();
+            const auto threshold = get_option(OPTION_PLY_THRESHOLD);
+            std::vector<std::array<int, 3>> faces;
+            if (use_normals)
+                normals.resize(new_verts.size(), { 0, 0, 0 });
             if (mesh)
             {
-                for (size_t x = 0; x < width - 1; ++x) {
-                    for (size_t y = 0; y < height - 1; ++y) {
+                for (size_t x = 0; x + 1 < width; ++x) {
+                    for (size_t y = 0; y + 1 < height; ++y) {
                         auto a = y * width + x, b = y * width + x + 1, c = (y + 1)*width + x, d = (y + 1)*width + x + 1;
                         if (verts[a].z && verts[b].z && verts[c].z && verts[d].z
                             && fabs(verts[a].z - verts[b].z) < threshold && fabs(verts[a].z - verts[c].z) < threshold
                             && fabs(verts[b].z - verts[d].z) < threshold && fabs(verts[c].z - verts[d].z) < threshold)
                         {
-                            if (idx_map.count(a) == 0 || idx_map.count(b) == 0 || idx_map.count(c) == 0 ||
-                                idx_map.count(d) == 0)
+                            if (idx_map[a] < 0 || idx_map[b] < 0 || idx_map[c] < 0 || idx_map[d] < 0)
                                 continue;
                             faces.push_back({ idx_map[a], idx_map[d], idx_map[b] });
                             faces.push_back({ idx_map[d], idx_map[a], idx_map[c] });
@@ -138,37 +160,22 @@ namespace rs2
                                 auto n1 = cross(point_d - point_a, point_b - point_a);
                                 auto n2 = cross(point_c - point_a, point_d - point_a);
 
-                                index_to_normals[idx_map[a]].push_back(n1);
-                                index_to_normals[idx_map[a]].push_back(n2);
-
-                                index_to_normals[idx_map[b]].push_back(n1);
-
-                                index_to_normals[idx_map[c]].push_back(n2);
-
-                                index_to_normals[idx_map[d]].push_back(n1);
-                                index_to_normals[idx_map[d]].push_back(n2);
+                                // Accumulate the face normals of each vertex; normalized below
+                                normals[idx_map[a]] = normals[idx_map[a]] + n1 + n2;
+                                normals[idx_map[b]] = normals[idx_map[b]] + n1;
+                                normals[idx_map[c]] = normals[idx_map[c]] + n2;
+                                normals[idx_map[d]] = normals[idx_map[d]] + n1 + n2;
                             }
                         }
                     }
                 }
             }
 
-            if (mesh && use_normals)
-            {
-                for (size_t i = 0; i < new_verts.size(); ++i)
-                {
-                    auto normals_vec = index_to_normals[i];
-                    vec3d sum = { 0, 0, 0 };
-                    for (auto& n : normals_vec)
-                        sum = sum + n;
-                    if (normals_vec.size() > 0)
-                        normals.push_back((sum.normalize()));
-                    else
-                        normals.push_back({ 0, 0, 0 });
-                }
-            }
+            for (auto& n : normals)
+                if (n.length() > 0)
+                    n = n.normalize();
 
-            std::ofstream out(fname);
+            std::ofstream out(filename, binary ? std::ios_base::binary : std::ios_base::out);
             out << "ply\n";
             if (binary)
                 out << "format binary_little_endian 1.0\n";
@@ -179,7 +186,7 @@ namespace rs2
             out << "property float" << sizeof(float) * 8 << " x\n";
             out << "property float" << sizeof(float) * 8 << " y\n";
             out << "property float" << sizeof(float) * 8 << " z\n";
-            if (mesh && use_normals)
+            if (use_normals)
             {
                 out << "property float" << sizeof(float) * 8 << " nx\n";
                 out << "property float" << sizeof(float) * 8 << " ny\n";
@@ -200,39 +207,36 @@ namespace rs2
 
             if (binary)
             {
-                out.close();
-                out.open(fname, std::ios_base::app | std::ios_base::binary);
+                // Pack each element block as it appears in the file and write it at once; the buffer
+                // is kept between frames
+                const size_t vertex_size = 3 * sizeof(float) * (use_normals ? 2 : 1) + (use_texcoords ? 3 : 0);
+                const size_t face_size = sizeof(uint8_t) + 3 * sizeof(int);
+                _buffer.resize(std::max(new_verts.size() * vertex_size, faces.size() * face_size));
+
+                char* ptr = _buffer.data();
                 for (size_t i = 0; i < new_verts.size(); ++i)
                 {
-                    // we assume little endian architecture on your device
-                    out.write(reinterpret_cast<const char*>(&(new_verts[i].x)), sizeof(float));
-                    out.write(reinterpret_cast<const char*>(&(new_verts[i].y)), sizeof(float));
-                    out.write(reinterpret_cast<const char*>(&(new_verts[i].z)), sizeof(float));
-
-                    if (mesh && use_normals)
+                    ptr = put(ptr, new_verts[i]);
+                    if (use_normals)
                     {
-                        out.write(reinterpret_cast<const char*>(&(normals[i].x)), sizeof(float));
-                        out.write(reinterpret_cast<const char*>(&(normals[i].y)), sizeof(float));
-                        out.write(reinterpret_cast<const char*>(&(normals[i].z)), sizeof(float));
+                        ptr = put(ptr, normals[i].x);
+                        ptr = put(ptr, normals[i].y);
+                        ptr = put(ptr, normals[i].z);
                     }
-
                     if (use_texcoords)
-                    {
-                        out.write(reinterpret_cast<const char*>(&(new_tex[i][0])), sizeof(uint8_t));
-                        out.write(reinterpret_cast<const char*>(&(new_tex[i][1])), sizeof(uint8_t));
-                        out.write(reinterpret_cast<const char*>(&(new_tex[i][2])), sizeof(uint8_t));
-                    }
+                        ptr = put(ptr, new_tex[i]);
                 }
+                out.write(_buffer.data(), ptr - _buffer.data());
+
                 if (mesh)
                 {
-                    auto size = faces.size();
-                    for (size_t i = 0; i < size; ++i) {
-                        static const int three = 3;
-                        out.write(reinterpret_cast<const char*>(&three), sizeof(uint8_t));
-                        out.write(reinterpret_cast<const char*>(&(faces[i][0])), sizeof(int));
-                        out.write(reinterpret_cast<const char*>(&(faces[i][1])), sizeof(int));
-                        out.write(reinterpret_cast<const char*>(&(faces[i][2])), sizeof(int));
+                    ptr = _buffer.data();
+                    for (auto& face : faces)
+                    {
+                        ptr = put(ptr, uint8_t(3));
+                        ptr = put(ptr, face);
                     }
+                    out.write(_buffer.data(), ptr - _buffer.data());
                 }
             }
             else
@@ -244,7 +248,7 @@ namespace rs2
                     out << new_verts[i].z << " ";
                     out << "\n";
 
-                    if (mesh && use_normals)
+                    if (use_normals)
                     {
                         out << normals[i].x << " ";
                         out << normals[i].y << " ";
@@ -286,6 +290,215 @@ namespace rs2
 
         std::string fname;
         pointcloud _pc;
+        std::vector<char> _buffer;
+    };
+
+    // Saves binary PCD files (x, y, z and, when a color frame is available, rgb) of the valid points only
+    class save_to_pcd : public filter
+    {
+    public:
+        static const auto OPTION_IGNORE_COLOR = rs2_option(RS2_OPTION_COUNT + 10);
+
+        save_to_pcd(std::string filename = "RealSense Pointcloud ", pointcloud pc = pointcloud()) : filter([this](frame f, frame_source& s) { func(f, s); }),
+            fname(filename), _pc(std::move(pc))
+        {
+            register_simple_option(OPTION_IGNORE_COLOR, option_range{ 0, 1, 0, 1 });
+        }
+
+        // Saves the point-cloud of a depth frame (or of the depth and color in a frameset) to 'filename'
+        void save(frame data, const std::string& filename)
+        {
+            frame depth, color;
+            if (auto fs = data.as<frameset>()) {
+                for (auto f : fs) {
+                    if (f.is<points>()) depth = f;
+                    else if (!depth && f.is<depth_frame>()) depth = f;
+                    else if (!color && f.is<video_frame>()) color = f;
+                }
+            } else if (data.is<depth_frame>() || data.is<points>()) {
+                depth = data;
+            }
+
+            if (!depth) throw std::runtime_error("Need depth data to save PCD");
+            if (!depth.is<points>()) {
+                if (color) _pc.map_to(color);
+                depth = _pc.calculate(depth);
+            }
+
+            export_to_pcd(depth, color, filename);
+        }
+
+    private:
+        void func(frame data, frame_source& source)
+        {
+            save(data, fname);
+            source.frame_ready(data); // passthrough filter because processing_block::process doesn't support sinks
+        }
+
+        void export_to_pcd(points p, video_frame color, const std::string& filename)
+        {
+            const bool use_texcoords = color && !get_option(OPTION_IGNORE_COLOR);
+            const auto verts = p.get_vertices();
+            const auto texcoords = p.get_texture_coordinates();
+            const uint8_t* texture_data = nullptr;
+            int w = 0, h = 0, bpp = 0, stride = 0;
+            if (use_texcoords)
+            {
+                texture_data = reinterpret_cast<const uint8_t*>(color.get_data());
+                w = color.get_width();
+                h = color.get_height();
+                bpp = color.get_bytes_per_pixel();
+                stride = color.get_stride_in_bytes();
+            }
+
+            // Points are packed in one pass that also skips invalid points and samples the texture
+            const size_t point_size = 3 * sizeof(float) + (use_texcoords ? sizeof(uint32_t) : 0);
+            _buffer.resize(p.size() * point_size);
+            char* ptr = _buffer.data();
+            size_t count = 0;
+            static const auto min_distance = 1e-6;
+            for (size_t i = 0; i < p.size(); ++i)
+            {
+                if (fabs(verts[i].x) < min_distance && fabs(verts[i].y) < min_distance && fabs(verts[i].z) < min_distance)
+                    continue;
+                memcpy(ptr, &verts[i], 3 * sizeof(float));
+                ptr += 3 * sizeof(float);
+                if (use_texcoords)
+                {
+                    int x = std::min(std::max(int(texcoords[i].u * w + .5f), 0), w - 1);
+                    int y = std::min(std::max(int(texcoords[i].v * h + .5f), 0), h - 1);
+                    auto rgb = texture_data + x * bpp + y * stride;
+                    // PCL convention: rgb packed into 32 bits, declared as a float field
+                    uint32_t packed = (uint32_t(rgb[0]) << 16) | (uint32_t(rgb[1]) << 8) | uint32_t(rgb[2]);
+                    memcpy(ptr, &packed, sizeof(packed));
+                    ptr += sizeof(packed);
+                }
+                ++count;
+            }
+
+            std::ofstream out(filename, std::ios_base::binary);
+            out << "# .PCD v0.7 - Point Cloud Data file format\n";
+            out << "VERSION 0.7\n";
+            out << (use_texcoords ? "FIELDS x y z rgb\n" : "FIELDS x y z\n");
+            out << (use_texcoords ? "SIZE 4 4 4 4\n" : "SIZE 4 4 4\n");
+            out << (use_texcoords ? "TYPE F F F F\n" : "TYPE F F F\n");
+            out << (use_texcoords ? "COUNT 1 1 1 1\n" : "COUNT 1 1 1\n");
+            out << "WIDTH " << count << "\n";
+            out << "HEIGHT 1\n";
+            out << "VIEWPOINT 0 0 0 1 0 0 0\n";
+            out << "POINTS " << count << "\n";
+            out << "DATA binary\n";
+            // we assume little endian architecture on your device
+            out.write(_buffer.data(), ptr - _buffer.data());
+        }
+
+        std::string fname;
+        pointcloud _pc;
+        std::vector<char> _buffer;
+    };
+
+    // Passes frames through untouched, and hands every Nth one to 'exporter' on a background thread so
+    // that saving does not stall the frame pipeline. When 'queue_size' frames are already waiting to be
+    // exported, new ones are skipped (see skipped()) rather than queued without bound. The first error the
+    // exporter throws is rethrown by flush(); frames keep being exported meanwhile. For example:
+    //     auto ply = std::make_shared< rs2::save_to_ply >();
+    //     rs2::async_exporter exporter( [ply]( rs2::frame f ) {
+    //         ply->save( f, "cloud-" + std::to_string( f.get_frame_number() ) + ".ply" ); }, 30 );
+    class async_exporter : public filter
+    {
+    public:
+        async_exporter(std::function<void(frame)> exporter, int every_nth = 1, size_t queue_size = 2)
+            : filter([this](frame f, frame_source& s) { func(f, s); }),
+            _exporter(std::move(exporter)), _every_nth(std::max(every_nth, 1)), _queue_size(std::max(queue_size, size_t(1))),
+            _counter(0), _skipped(0), _stopping(false), _thread([this]() { run(); })
+        {
+        }
+
+        ~async_exporter()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _cv.notify_all();
+            _thread.join();
+        }
+
+        // Blocks until everything queued so far has been exported, then throws the first error exporting
+        // threw since the last flush(), if any
+        void flush()
+        {
+            std::exception_ptr error;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this]() { return _queue.empty() && !_busy; });
+                std::swap(error, _error);
+            }
+            if (error)
+                std::rethrow_exception(error);
+        }
+
+        size_t skipped() const { return _skipped; }
+
+    private:
+        void func(frame data, frame_source& source)
+        {
+            if (_counter++ % _every_nth == 0)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_queue.size() < _queue_size)
+                {
+                    data.keep(); // the frame would otherwise hold on to its pool until exported
+                    _queue.push_back(data);
+                    _cv.notify_all();
+                }
+                else
+                    ++_skipped;
+            }
+            source.frame_ready(data);
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            while (true)
+            {
+                _cv.wait(lock, [this]() { return _stopping || !_queue.empty(); });
+                if (_queue.empty())
+                    break; // stopping, and everything was exported
+                auto f = _queue.front();
+                _queue.pop_front();
+                _busy = true;
+                lock.unlock();
+                std::exception_ptr error;
+                try
+                {
+                    _exporter(f);
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+                lock.lock();
+                if (error && !_error)
+                    _error = error;
+                _busy = false;
+                _cv.notify_all();
+            }
+        }
+
+        std::function<void(frame)> _exporter;
+        const int _every_nth;
+        const size_t _queue_size;
+        unsigned long long _counter;
+        std::atomic<size_t> _skipped;
+        bool _stopping;
+        bool _busy = false;
+        std::exception_ptr _error;  // the first the exporter threw, until flush() throws it
+        std::deque<frame> _queue;
+        std::mutex _mutex;
+        std::condition_variable _cv;
+        std::thread _thread;
     };
 
     class save_single_frameset : public filter {
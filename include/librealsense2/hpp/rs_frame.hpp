@@ -481,6 +481,17 @@ namespace rs2
             return r;
         }
 
+        /** retrieve how long ago the frame arrived at the host; for a frameset, the oldest of its frames
+        * \return            the age of the frame, in milliseconds
+        */
+        double get_age() const
+        {
+            rs2_error* e = nullptr;
+            auto r = rs2_get_frame_age(frame_ref, &e);
+            error::handle(e);
+            return r;
+        }
+
         /** retrieve the timestamp domain
         * \return            timestamp domain (clock name) for timestamp values
         */
@@ -552,6 +563,20 @@ namespace rs2
             return r;
         }
 
+        /**
+        * retrieve the commonly-used frame fields (data, dimensions, stream, timestamp, etc.) in one call
+        * includes the data, which for GPU frames means downloading them: the per-field getters do not
+        * \return  rs2_frame_view - valid as long as the frame is
+        */
+        rs2_frame_view get_view() const
+        {
+            rs2_frame_view view;
+            rs2_error* e = nullptr;
+            rs2_get_frame_view(frame_ref, &view, &e);
+            error::handle(e);
+            return view;
+        }
+
         /**
         * retrieve stream profile from frame handle
         * \return  stream_profile - the pointer to the stream profile
@@ -913,6 +938,64 @@ namespace rs2
         }
     };
 
+    class motion_batch_frame : public frame
+    {
+    public:
+        /**
+        * Extends the frame class with access to each of the motion samples batched in the frame
+        * \param[in] frame - existing frame instance
+        */
+        motion_batch_frame(const frame& f)
+            : frame(f), _size(0), _timestamps(nullptr)
+        {
+            rs2_error* e = nullptr;
+            if (!f || (rs2_is_frame_extendable_to(f.get(), RS2_EXTENSION_MOTION_BATCH_FRAME, &e) == 0 && !e))
+            {
+                reset();
+            }
+            error::handle(e);
+
+            if (*this)
+            {
+                _size = rs2_motion_batch_frame_get_sample_count(get(), &e);
+                error::handle(e);
+                _timestamps = rs2_motion_batch_frame_get_timestamps(get(), &e);
+                error::handle(e);
+            }
+        }
+        /**
+        * Retrieve the number of samples in the batch
+        * \return size_t - number of samples
+        */
+        size_t size() const { return _size; }
+        /**
+        * Retrieve the motion data of one sample; get_data() has all of them, one after the other
+        * \param[in] index - index of the sample, from 0 to size()-1
+        * \return rs2_vector - 3D vector in Euclidean coordinate space.
+        */
+        rs2_vector get_motion_data(size_t index) const
+        {
+            if (index >= _size)
+                throw error("Requested index is out of range!");
+            return reinterpret_cast<const rs2_vector*>(get_data())[index];
+        }
+        /**
+        * Retrieve the timestamp of one sample, in the frame's timestamp domain
+        * \param[in] index - index of the sample, from 0 to size()-1
+        * \return double - timestamp in milliseconds
+        */
+        double get_sample_timestamp(size_t index) const
+        {
+            if (index >= _size)
+                throw error("Requested index is out of range!");
+            return _timestamps[index];
+        }
+
+    private:
+        size_t _size;
+        const double* _timestamps;
+    };
+
     class pose_frame : public frame
     {
     public:
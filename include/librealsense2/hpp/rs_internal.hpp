@@ -526,6 +526,43 @@ namespace rs2
         }
     };
 
+    // Parses firmware logs captured raw, without a device: a whole buffer of them at once
+    class firmware_log_parser
+    {
+    public:
+        firmware_log_parser(const std::string& xml_content)
+        {
+            rs2_error* e = nullptr;
+
+            _parser = std::shared_ptr<rs2_firmware_log_parser>(
+                rs2_create_fw_log_parser(xml_content.c_str(), &e),
+                rs2_delete_fw_log_parser);
+            error::handle(e);
+        }
+
+        // Returns a line per log, for the concatenated data of firmware_log_message objects
+        std::string parse(const std::vector<uint8_t>& raw_logs)
+        {
+            rs2_error* e = nullptr;
+
+            std::shared_ptr<const rs2_raw_data_buffer> text(
+                rs2_parse_raw_fw_logs(_parser.get(), raw_logs.data(), (unsigned int)raw_logs.size(), &e),
+                rs2_delete_raw_data);
+            error::handle(e);
+
+            auto size = rs2_get_raw_data_size(text.get(), &e);
+            error::handle(e);
+
+            auto start = rs2_get_raw_data(text.get(), &e);
+            error::handle(e);
+
+            return std::string(start, start + size);
+        }
+
+    private:
+        std::shared_ptr<rs2_firmware_log_parser> _parser;
+    };
+
     class terminal_parser
     {
     public:
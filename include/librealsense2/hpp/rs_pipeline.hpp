@@ -267,6 +267,21 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Deliver only the latest frames to \c wait_for_frames(), \c poll_for_frames() and \c try_wait_for_frames():
+        * a frameset that was not retrieved yet is replaced by the next one, so a slow consumer always gets data that is
+        * at most one frame period old rather than a backlog. \c frame::get_age() tells how old it is.
+        * In non-real-time playback, frames are then skipped instead of waited for.
+        *
+        * \param[in] enable  true for only the latest frames, false (the default) to queue them
+        */
+        void enable_latest_frames_only(bool enable = true)
+        {
+            rs2_error* e = nullptr;
+            rs2_config_enable_latest_frames_only(_config.get(), enable, &e);
+            error::handle(e);
+        }
+
         /**
         * Disable a device stream explicitly, to remove any requests on this stream profile.
         * The stream can still be enabled due to pipeline computer vision module request. This call removes any filter on the
@@ -363,13 +363,15 @@ namespace rs2
     public:
         /**
         * Ask processing block to process the frame and poll the processed frame from internal queue
+        * If no other reference to the frame is kept (e.g., it is passed with std::move), filters whose
+        * output has the same layout as their input may write their output into it instead of a new frame
         *
         * \param[in] on_frame      frame to be processed.
         * return processed frame
         */
         rs2::frame process(rs2::frame frame) const override
         {
-            invoke(frame);
+            invoke(std::move(frame));
             rs2::frame f;
             if (!_queue.poll_for_frame(&f))
                 throw std::runtime_error("Error occured during execution of the processing block! See the log for more info");
@@ -593,6 +595,136 @@ namespace rs2
         }
     };
 
+    /**
+    * Measures the depth quality of a flat target on every depth frame, as the Depth Quality Tool does: a plane is fit
+    * to the region of interest, and the fill rate, plane-fit RMS, subpixel RMS and Z accuracy are kept for the latest
+    * frame. Frames are passed through as they are.
+    */
+    class depth_metrics : public filter
+    {
+    public:
+        depth_metrics() : filter(init(), 1) {}
+
+        depth_metrics(filter f) : filter(f)
+        {
+            rs2_error* e = nullptr;
+            if (!rs2_is_processing_block_extendable_to(f.get(), RS2_EXTENSION_DEPTH_METRICS_FILTER, &e) && !e)
+            {
+                _block.reset();
+            }
+            error::handle(e);
+        }
+
+        /**
+        * Set the region of interest; by default, the center 40% of the frame
+        * \param[in] roi  in pixels, max exclusive
+        */
+        void set_roi(const region_of_interest& roi)
+        {
+            rs2_error* e = nullptr;
+            rs2_depth_metrics_set_roi(get(), roi.min_x, roi.min_y, roi.max_x, roi.max_y, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Set the actual distance of the target, for the Z accuracy
+        * \param[in] mm  distance in millimeters, or 0 when not known
+        */
+        void set_ground_truth(float mm)
+        {
+            rs2_error* e = nullptr;
+            rs2_depth_metrics_set_ground_truth(get(), mm, &e);
+            error::handle(e);
+        }
+
+        /**
+        * The metrics of the latest frame processed
+        */
+        rs2_depth_metrics get_metrics() const
+        {
+            rs2_error* e = nullptr;
+            rs2_depth_metrics metrics;
+            rs2_depth_metrics_get(get(), &metrics, &e);
+            error::handle(e);
+            return metrics;
+        }
+
+    private:
+        std::shared_ptr<rs2_processing_block> init()
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_depth_metrics(&e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
+
+    /**
+    * Compresses Z16 depth frames, losslessly, to RS2_FORMAT_Z16RVL frames of the same width and height, typically 3-5
+    * times smaller. The depth_decoder restores them.
+    */
+    class depth_encoder : public filter
+    {
+    public:
+        depth_encoder() : filter(init(), 1) {}
+
+        depth_encoder(filter f) : filter(f)
+        {
+            rs2_error* e = nullptr;
+            if (!rs2_is_processing_block_extendable_to(f.get(), RS2_EXTENSION_DEPTH_ENCODER, &e) && !e)
+            {
+                _block.reset();
+            }
+            error::handle(e);
+        }
+
+    private:
+        std::shared_ptr<rs2_processing_block> init()
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_depth_encoder(&e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
+
+    /**
+    * Decompresses RS2_FORMAT_Z16RVL frames, as made by the depth_encoder, back to Z16 depth frames
+    */
+    class depth_decoder : public filter
+    {
+    public:
+        depth_decoder() : filter(init(), 1) {}
+
+        depth_decoder(filter f) : filter(f)
+        {
+            rs2_error* e = nullptr;
+            if (!rs2_is_processing_block_extendable_to(f.get(), RS2_EXTENSION_DEPTH_DECODER, &e) && !e)
+            {
+                _block.reset();
+            }
+            error::handle(e);
+        }
+
+    private:
+        std::shared_ptr<rs2_processing_block> init()
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_depth_decoder(&e),
+                rs2_delete_processing_block);
+            error::handle(e);
+
+            return block;
+        }
+    };
+
     class units_transform : public filter
     {
     public:
@@ -702,6 +834,177 @@ namespace rs2
         frame_queue _results;
     };
 
+    /**
+    * Matches frames, or framesets, coming from several devices into one frameset per time slot.
+    * Pass it the frames of every device (e.g., as the callback of each device's pipeline or sensors) and get the
+    * matched framesets from it, as with a syncer. Each stream (or frameset) is queued separately, and a slot takes
+    * one frame from each. Slots missing a stream are released without it once the stream has moved past them or the
+    * queues fill up, so one stalled device does not stall the others.
+    */
+    class multi_device_syncer
+    {
+    public:
+        /**
+        * \param[in] tolerance            Maximal difference between frames of the same slot: milliseconds of global
+        *                                 time, or frame numbers if match_frame_counter is set
+        * \param[in] match_frame_counter  Match hardware-synced devices by frame counter rather than by timestamp
+        * \param[in] device_queue_size    Maximal number of frames held per stream (or per device, when given
+        *                                 its framesets); the oldest are dropped under load
+        * \param[in] queue_size           Size of the output queue
+        */
+        multi_device_syncer(double tolerance = 2., bool match_frame_counter = false, int device_queue_size = 4, int queue_size = 1)
+            : _block(init(tolerance, match_frame_counter, device_queue_size)), _results(queue_size)
+        {
+            _block.start(_results);
+        }
+
+        /**
+        * Wait until a matched set of frames becomes available
+        * \param[in] timeout_ms   Max time in milliseconds to wait until an exception will be thrown
+        * \return Set of frames, from all the devices that contributed to the slot
+        */
+        frameset wait_for_frames(unsigned int timeout_ms = 5000) const
+        {
+            return frameset(_results.wait_for_frame(timeout_ms));
+        }
+
+        /**
+        * Check if a matched set of frames is available
+        * \param[out] fs      New frame-set
+        * \return true if new frame-set was stored to result
+        */
+        bool poll_for_frames(frameset* fs) const
+        {
+            frame result;
+            if (_results.poll_for_frame(&result))
+            {
+                *fs = frameset(result);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+        * Wait until a matched set of frames becomes available
+        * \param[in] timeout_ms     Max time in milliseconds to wait until an available frame
+        * \param[out] fs            New frame-set
+        * \return true if new frame-set was stored to result
+        */
+        bool try_wait_for_frames(frameset* fs, unsigned int timeout_ms = 5000) const
+        {
+            frame result;
+            if (_results.try_wait_for_frame(&result, timeout_ms))
+            {
+                *fs = frameset(result);
+                return true;
+            }
+            return false;
+        }
+
+        void operator()(frame f) const
+        {
+            _block.invoke(std::move(f));
+        }
+
+    private:
+        static std::shared_ptr<rs2_processing_block> init(double tolerance, bool match_frame_counter, int device_queue_size)
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_multi_device_syncer(match_frame_counter ? 1 : 0, tolerance, device_queue_size, &e),
+                rs2_delete_processing_block);
+            error::handle(e);
+            return block;
+        }
+
+        processing_block _block;
+        frame_queue _results;
+    };
+
+    /**
+    * Collects the samples of each motion stream into motion_batch_frame objects, so IMU data can be handled a batch
+    * at a time rather than one frame per sample. A batch is released once it spans 'latency' milliseconds of sample
+    * time; one that is not, because no more samples came, is released once it was held about as long. Other frames
+    * are passed through as they are.
+    */
+    class motion_batcher
+    {
+    public:
+        /**
+        * \param[in] latency      Milliseconds of samples a batch spans before it is released
+        * \param[in] max_samples  Maximal number of samples per batch
+        * \param[in] queue_size   Size of the output queue
+        */
+        motion_batcher(double latency = 5., int max_samples = 1000, int queue_size = 16)
+            : _block(init(latency, max_samples)), _results(queue_size)
+        {
+            _block.start(_results);
+        }
+
+        /**
+        * Wait until a batch (or another frame) becomes available
+        * \param[in] timeout_ms   Max time in milliseconds to wait until an exception will be thrown
+        * \return The frame, a motion_batch_frame for motion streams
+        */
+        frame wait_for_frame(unsigned int timeout_ms = 5000) const
+        {
+            return _results.wait_for_frame(timeout_ms);
+        }
+
+        /**
+        * Check if a batch (or another frame) is available
+        * \param[out] f      The frame
+        * \return true if a frame was stored to f
+        */
+        bool poll_for_frame(frame* f) const
+        {
+            return _results.poll_for_frame(f);
+        }
+
+        /**
+        * Wait until a batch (or another frame) becomes available
+        * \param[in] timeout_ms     Max time in milliseconds to wait until an available frame
+        * \param[out] f             The frame
+        * \return true if a frame was stored to f
+        */
+        bool try_wait_for_frame(frame* f, unsigned int timeout_ms = 5000) const
+        {
+            return _results.try_wait_for_frame(f, timeout_ms);
+        }
+
+        /**
+        * Correct the batches of a stream type with the given intrinsics: each sample becomes the 3x3 matrix in
+        * intrinsics.data times the sample, minus the bias in the last column
+        * \param[in] stream      The stream type, e.g. RS2_STREAM_ACCEL or RS2_STREAM_GYRO
+        * \param[in] intrinsics  The correction, replacing any set before for the stream type
+        */
+        void set_intrinsics(rs2_stream stream, const rs2_motion_device_intrinsic& intrinsics) const
+        {
+            rs2_error* e = nullptr;
+            rs2_motion_batcher_set_intrinsics(_block.get(), stream, &intrinsics, &e);
+            error::handle(e);
+        }
+
+        void operator()(frame f) const
+        {
+            _block.invoke(std::move(f));
+        }
+
+    private:
+        static std::shared_ptr<rs2_processing_block> init(double latency, int max_samples)
+        {
+            rs2_error* e = nullptr;
+            auto block = std::shared_ptr<rs2_processing_block>(
+                rs2_create_motion_batcher(latency, max_samples, &e),
+                rs2_delete_processing_block);
+            error::handle(e);
+            return block;
+        }
+
+        processing_block _block;
+        frame_queue _results;
+    };
+
     /**
     Auxiliary processing block that performs image alignment using depth data and camera calibration
     */
@@ -234,6 +234,25 @@ namespace rs2
             rs2::error::handle(e);
         }
 
+        /**
+        * Creates a recording device to record the given device and save it to the given file as rosbag format
+        * \param[in]  file                  The desired path to which the recorder should save the data
+        * \param[in]  device                The device to record
+        * \param[in]  compression_enabled   Indicates if compression is enabled
+        * \param[in]  compress_depth        Indicates if Z16 depth is recorded losslessly compressed (RS2_FORMAT_Z16RVL),
+        *                                   which playback decompresses
+        */
+        recorder(const std::string& file, rs2::device dev, bool compression_enabled, bool compress_depth)
+        {
+            rs2_error* e = nullptr;
+            _dev = std::shared_ptr<rs2_device>(
+                compress_depth
+                    ? rs2_create_record_device_with_depth_compression(dev.get().get(), file.c_str(), compression_enabled, &e)
+                    : rs2_create_record_device_ex(dev.get().get(), file.c_str(), compression_enabled, &e),
+                rs2_delete_device);
+            rs2::error::handle(e);
+        }
+
 
         /**
         * Pause the recording device without stopping the actual device from streaming.
@@ -90,6 +90,9 @@ void rs2_set_amp_factor(rs2_device* dev, const  STAFactor* group, rs2_error** er
 /* Gets new values for STAFactor, returns 0 if success */
 void rs2_get_amp_factor(rs2_device* dev, STAFactor* group, int mode, rs2_error** error);
 
+/* Gets the number of group and control writes that loading presets skipped, as the device already held their values */
+void rs2_get_skipped_transfers(rs2_device* dev, unsigned long long* skipped, rs2_error** error);
+
 #ifdef __cplusplus
 }
 #endif
@@ -262,6 +262,17 @@ namespace rs400
 
             return group;
         }
+
+        // Writes that loading presets skipped, as the device already held their values
+        unsigned long long get_skipped_transfers() const
+        {
+            rs2_error* e = nullptr;
+            unsigned long long skipped = 0;
+            rs2_get_skipped_transfers(_dev.get(), &skipped, &e);
+            rs2::error::handle(e);
+
+            return skipped;
+        }
     };
 }
 
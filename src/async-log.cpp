@@ -0,0 +1,243 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "async-log.h"
+
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#ifdef __ANDROID__
+#include <android/log.h>
+#endif
+
+
+namespace librealsense {
+namespace async_log {
+
+
+std::atomic< int > min_severity( RS2_LOG_SEVERITY_NONE );
+
+
+void set_min_severity( rs2_log_severity severity )
+{
+    min_severity.store( severity, std::memory_order_relaxed );
+}
+
+
+namespace {
+
+
+    std::atomic< unsigned long long > n_dropped( 0 );
+
+
+    // Written only by the thread that owns it, read only by the dispatcher: head and tail only ever
+    // grow, and each is stored by one side alone
+    struct ring
+    {
+        static constexpr size_t size = 128;
+
+        entry entries[size];
+        std::atomic< size_t > head{ 0 };  // next to be written out
+        std::atomic< size_t > tail{ 0 };  // next to be filled
+        std::atomic< bool > orphaned{ false };  // the thread is gone; remove once empty
+    };
+
+
+    void write_out( entry const & e, std::string const & msg )
+    {
+#ifdef __ANDROID__
+        int priority;
+        switch( e.severity )
+        {
+        case RS2_LOG_SEVERITY_DEBUG: priority = ANDROID_LOG_DEBUG; break;
+        case RS2_LOG_SEVERITY_INFO: priority = ANDROID_LOG_INFO; break;
+        case RS2_LOG_SEVERITY_WARN: priority = ANDROID_LOG_WARN; break;
+        default: priority = ANDROID_LOG_ERROR; break;
+        }
+        __android_log_write( priority, "librs", msg.c_str() );
+#elif BUILD_EASYLOGGINGPP
+        el::Level level;
+        switch( e.severity )
+        {
+        case RS2_LOG_SEVERITY_DEBUG: level = el::Level::Debug; break;
+        case RS2_LOG_SEVERITY_INFO: level = el::Level::Info; break;
+        case RS2_LOG_SEVERITY_WARN: level = el::Level::Warning; break;
+        default: level = el::Level::Error; break;
+        }
+        el::base::Writer( level, e.file, e.line, "" ).construct( 1, LIBREALSENSE_ELPP_ID ) << msg;
+#endif
+    }
+
+
+    // Owns the background thread, which is started with the first ring, and writes out all the rings
+    class dispatcher
+    {
+        std::mutex _mutex;
+        std::condition_variable _cv;
+        std::vector< std::shared_ptr< ring > > _rings;
+        std::thread _thread;
+        unsigned long long _passes = 0;
+        bool _stopping = false;
+
+    public:
+        static dispatcher & instance()
+        {
+            static dispatcher the_dispatcher;
+            return the_dispatcher;
+        }
+
+        ~dispatcher()
+        {
+            {
+                std::lock_guard< std::mutex > lock( _mutex );
+                _stopping = true;
+            }
+            _cv.notify_all();
+            if( _thread.joinable() )
+                _thread.join();
+        }
+
+        void add( std::shared_ptr< ring > r )
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            _rings.push_back( std::move( r ) );
+            if( ! _thread.joinable() )
+                _thread = std::thread( [this]() { run(); } );
+        }
+
+        void flush()
+        {
+            std::unique_lock< std::mutex > lock( _mutex );
+            if( ! _thread.joinable() )
+                return;
+            // The pass under way may have missed the latest messages; the one after it cannot
+            auto const done = _passes + 2;
+            _cv.notify_all();
+            _cv.wait( lock, [&]() { return _passes >= done || _stopping; } );
+        }
+
+    private:
+        void run()
+        {
+            std::unique_lock< std::mutex > lock( _mutex );
+            unsigned long long reported = 0;
+            while( true )
+            {
+                bool const stopping = _stopping;
+                auto rings = _rings;
+                // Not locked while writing: a log callback may itself log, from this thread
+                lock.unlock();
+                size_t n_written = 0;
+                for( auto & r : rings )
+                    n_written += drain( *r );
+
+                auto const dropped = n_dropped.load();
+                if( dropped != reported )
+                {
+                    LOG_WARNING( "async log: " << dropped - reported << " messages were dropped (ring full)" );
+                    reported = dropped;
+                }
+
+                lock.lock();
+                _rings.erase( std::remove_if( _rings.begin(),
+                                              _rings.end(),
+                                              []( std::shared_ptr< ring > const & r ) {
+                                                  return r->orphaned && r->head == r->tail;
+                                              } ),
+                              _rings.end() );
+                ++_passes;
+                _cv.notify_all();
+                if( stopping )
+                    break;
+                if( ! n_written )
+                    _cv.wait_for( lock, std::chrono::milliseconds( 10 ) );
+            }
+        }
+
+        static size_t drain( ring & r )
+        {
+            auto const first = r.head.load( std::memory_order_relaxed );
+            auto const tail = r.tail.load( std::memory_order_acquire );
+            for( auto head = first; head != tail; ++head )
+            {
+                entry const & e = r.entries[head % ring::size];
+                std::ostringstream ss;
+                e.format( ss, e.args );
+                write_out( e, ss.str() );
+                r.head.store( head + 1, std::memory_order_release );
+            }
+            return tail - first;
+        }
+    };
+
+
+    // The calling thread's ring, created (and handed to the dispatcher) on its first message
+    struct thread_ring
+    {
+        std::shared_ptr< ring > r;
+
+        ~thread_ring()
+        {
+            if( r )
+                r->orphaned = true;
+        }
+
+        ring & get()
+        {
+            if( ! r )
+            {
+                r = std::make_shared< ring >();
+                dispatcher::instance().add( r );
+            }
+            return *r;
+        }
+    };
+
+    thread_local thread_ring this_thread_ring;
+
+
+}  // namespace
+
+
+entry * begin_write()
+{
+    auto & r = this_thread_ring.get();
+    auto const tail = r.tail.load( std::memory_order_relaxed );
+    if( tail - r.head.load( std::memory_order_acquire ) == ring::size )
+    {
+        ++n_dropped;
+        return nullptr;
+    }
+    return &r.entries[tail % ring::size];
+}
+
+
+void end_write()
+{
+    auto & r = *this_thread_ring.r;
+    r.tail.store( r.tail.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+}
+
+
+void flush()
+{
+    dispatcher::instance().flush();
+}
+
+
+unsigned long long dropped()
+{
+    return n_dropped.load();
+}
+
+
+}  // namespace async_log
+}  // namespace librealsense
@@ -0,0 +1,164 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include "core/enum-helpers.h"
+#include <librealsense2/h/rs_types.h>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <ostream>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+// Logging for the frame path, where LOG_DEBUG() would format (and write, under the logger's locks) on the
+// streaming thread. The arguments are given comma-separated rather than <<-chained:
+//
+//     LOG_DEBUG_ASYNC( "FrameAccepted,", stream_type, ",Counter,", frame_number );
+//
+// They are not evaluated at all when no log output wants the severity. Otherwise, their values are copied
+// into a lock-free ring owned by the calling thread, and formatted and written by a background thread,
+// with the file and line of the log statement. When a thread's ring is full, its messages are dropped
+// and counted, and the count is logged as a warning.
+//
+// Since the formatting happens later, only values can be captured: numbers, enums, stream manipulators
+// like std::fixed, and string literals. Strings that may not outlive the statement, char buffers included,
+// do not compile; log the enum rather than its get_string(). Messages from the same thread keep their order, but the time and
+// thread ELPP shows are those of the writing.
+//
+#if BUILD_EASYLOGGINGPP
+#define LOG_ASYNC( SEVERITY, ... )                                                                             \
+    do                                                                                                         \
+    {                                                                                                          \
+        if( librealsense::async_log::is_enabled( SEVERITY ) )                                                  \
+            librealsense::async_log::write( SEVERITY, __FILE__, __LINE__, __VA_ARGS__ );                       \
+    }                                                                                                          \
+    while( false )
+#else
+#define LOG_ASYNC( SEVERITY, ... ) do { ; } while( false )
+#endif
+#define LOG_DEBUG_ASYNC( ... )   LOG_ASYNC( RS2_LOG_SEVERITY_DEBUG, __VA_ARGS__ )
+#define LOG_INFO_ASYNC( ... )    LOG_ASYNC( RS2_LOG_SEVERITY_INFO, __VA_ARGS__ )
+#define LOG_WARNING_ASYNC( ... ) LOG_ASYNC( RS2_LOG_SEVERITY_WARN, __VA_ARGS__ )
+
+
+namespace librealsense {
+namespace async_log {
+
+
+    // The lowest severity any of the log outputs (console, file, callbacks) wants, updated by the logger
+    extern std::atomic< int > min_severity;
+    inline bool is_enabled( rs2_log_severity severity )
+    {
+        return severity >= min_severity.load( std::memory_order_relaxed );
+    }
+    void set_min_severity( rs2_log_severity );
+
+
+    // A queued message: the captured arguments, and the function that knows how to format them
+    struct entry
+    {
+        static constexpr size_t capacity = 256;
+
+        rs2_log_severity severity;
+        char const * file;
+        int line;
+        void ( *format )( std::ostream &, void const * args );
+        alignas( std::max_align_t ) unsigned char args[capacity];
+    };
+
+    // The next free entry in the calling thread's ring, or null if the ring is full (and the message
+    // was counted as dropped); a non-null entry must be filled and then published with end_write()
+    entry * begin_write();
+    void end_write();
+
+    // Waits until everything logged before the call has been written
+    void flush();
+
+    // How many messages were dropped, since the start
+    unsigned long long dropped();
+
+
+    namespace detail {
+
+        // Whether an argument, as given, may be captured: a value, or a string literal. Only the pointer to a string
+        // is stored, so a char buffer (or pointer) is refused: it may be gone by the time the message is formatted.
+        // A literal is a const char array; a const array that is not a literal must be static.
+        template< class T,
+                  class U = typename std::remove_reference< T >::type,
+                  class D = typename std::decay< T >::type >
+        struct can_capture
+            : std::integral_constant< bool,
+                                      std::is_array< U >::value
+                                          ? std::is_same< typename std::remove_extent< U >::type, char const >::value
+                                          : std::is_trivially_copyable< D >::value
+                                                && ! std::is_same< typename std::remove_cv< typename std::remove_pointer< D >::type >::type,
+                                                                   char >::value >
+        {
+        };
+
+        // What gets stored for each argument
+        template< class T >
+        struct captured
+        {
+            using type = typename std::decay< T >::type;
+            static_assert( can_capture< T >::value, "async logs can only capture values and string literals" );
+        };
+
+        template< class T >
+        void put( std::ostream & os, T const & value, std::false_type /*is_enum*/ )
+        {
+            os << value;
+        }
+
+        // Named, so an rs2 enum is not ambiguous where rs.hpp's operators are also seen
+        template< class T >
+        void put( std::ostream & os, T value, std::true_type /*is_enum*/ )
+        {
+            librealsense::operator<<( os, value );
+        }
+
+        template< class Tuple, size_t... I >
+        void print( std::ostream & os, Tuple const & args, std::index_sequence< I... > )
+        {
+            int unused[] = { 0,
+                             ( put( os,
+                                    std::get< I >( args ),
+                                    std::is_enum< typename std::tuple_element< I, Tuple >::type >() ),
+                               0 )... };
+            (void)unused;
+        }
+
+        template< class Tuple >
+        void format( std::ostream & os, void const * args )
+        {
+            print( os, *static_cast< Tuple const * >( args ), std::make_index_sequence< std::tuple_size< Tuple >::value >() );
+        }
+
+    }  // namespace detail
+
+
+    template< class... Args >
+    void write( rs2_log_severity severity, char const * file, int line, Args &&... args )
+    {
+        using tuple = std::tuple< typename detail::captured< Args >::type... >;
+        static_assert( sizeof( tuple ) <= entry::capacity, "too many arguments for an async log message" );
+        static_assert( std::is_trivially_destructible< tuple >::value, "async logs can only capture values" );
+
+        if( auto e = begin_write() )
+        {
+            e->severity = severity;
+            e->file = file;
+            e->line = line;
+            e->format = &detail::format< tuple >;
+            new( e->args ) tuple( std::forward< Args >( args )... );
+            end_write();
+        }
+    }
+
+
+}  // namespace async_log
+}  // namespace librealsense
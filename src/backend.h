@@ -16,6 +16,7 @@
 const uint16_t DELAY_FOR_CONNECTION        = 50;
 const int      DISCONNECT_PERIOD_MS        = 6000;
 const int      POLLING_DEVICES_INTERVAL_MS = 2000;
+const int      HOTPLUG_SETTLE_PERIOD_MS    = 100;
 
 const uint8_t MAX_META_DATA_SIZE          = 0xff; // UVC Metadata total length
                                             // is limited by (UVC Bulk) design to 255 bytes
@@ -10,6 +10,9 @@
 #include "serializable-interface.h"
 #include <rsutils/lazy.h>
 
+#include <atomic>
+#include <cstring>
+
 
 typedef enum
 {
@@ -91,6 +94,9 @@ namespace librealsense
         virtual void set_census_radius(const STCensusRadius& val) = 0;
         virtual void set_amp_factor(const STAFactor& val) = 0;
 
+        // Number of writes that loading a preset did not send, as the device already held their values
+        virtual unsigned long long get_skipped_transfers() const = 0;
+
         virtual ~ds_advanced_mode_interface() = default;
     };
 
@@ -140,6 +146,8 @@ namespace librealsense
         void set_census_radius(const STCensusRadius& val) override;
         void set_amp_factor(const STAFactor& val) override;
 
+        unsigned long long get_skipped_transfers() const override;
+
         std::vector<uint8_t> serialize_json() const override;
         void load_json(const std::string& json_content) override;
 
@@ -209,11 +217,13 @@ namespace librealsense
         rsutils::lazy< bool > _amplitude_factor_support;
         bool _blocked = false;
         std::string _block_message;
+        std::atomic< unsigned long long > _skipped_transfers{ 0 };
 
         preset get_all() const;
-        void set_all( const preset & p );
-        void set_all_depth( const preset & p );
-        void set_all_rgb( const preset & p );
+        // With 'current', the values the device holds, writes only what differs from them
+        void set_all( const preset & p, const preset * current = nullptr );
+        void set_all_depth( const preset & p, const preset * current );
+        void set_all_rgb( const preset & p, const preset * current );
         bool should_set_rgb_preset() const;
 
         std::vector<uint8_t> send_receive(const std::vector<uint8_t>& input) const;
@@ -232,6 +242,32 @@ namespace librealsense
             std::this_thread::sleep_for(std::chrono::milliseconds(20));
         }
 
+        // Writes a group of the preset, unless 'current' has it already
+        template<class T>
+        void set(const preset& p, const preset* current, T preset::*group)
+        {
+            // The groups are all 32-bit fields, without padding
+            if (current && !memcmp(&(current->*group), &(p.*group), sizeof(T)))
+                ++_skipped_transfers;
+            else
+                set(p.*group, advanced_mode_traits<T>::group);
+        }
+
+        // Whether a control of the preset has to be written: it is set, and not to its value in 'current'
+        template<class T, class V>
+        bool should_set(const preset& p, const preset* current, T preset::*control, V T::*value)
+        {
+            auto& requested = p.*control;
+            if (!requested.was_set)
+                return false;
+            if (current && (current->*control).was_set && (current->*control).*value == requested.*value)
+            {
+                ++_skipped_transfers;
+                return false;
+            }
+            return true;
+        }
+
         template<class T>
         T get(EtAdvancedModeRegGroup cmd, T* ptr = static_cast<T*>(nullptr), int mode = 0) const
         {
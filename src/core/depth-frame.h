@@ -33,6 +33,12 @@ public:
 
     float get_units() const { return additional_data.depth_units; }
 
+    void get_view( rs2_frame_view & view ) const override
+    {
+        video_frame::get_view( view );
+        view.depth_units = get_units();
+    }
+
     void set_original( frame_holder h )
     {
         _original = std::move( h );
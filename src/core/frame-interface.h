@@ -53,6 +53,9 @@ public:
 
     virtual void keep() = 0;
 
+    // Fills in all the fields at once, for the hot path: no casting required
+    virtual void get_view( rs2_frame_view & view ) const = 0;
+
     virtual ~frame_interface() = default;
 };
 
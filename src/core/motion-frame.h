@@ -3,8 +3,11 @@
 #pragma once
 
 #include <src/frame.h>
+#include <src/float3.h>
 #include "extension.h"
 
+#include <vector>
+
 
 namespace librealsense {
 
@@ -21,4 +24,23 @@ public:
 MAP_EXTENSION( RS2_EXTENSION_MOTION_FRAME, librealsense::motion_frame );
 
 
+// Consecutive samples of one motion stream, delivered together (see motion_batcher). The data is the xyz of
+// each sample, one after the other, so it can be used as an array; the header is that of the first sample.
+class motion_batch_frame : public frame
+{
+public:
+    motion_batch_frame()
+        : frame()
+    {
+    }
+
+    size_t get_sample_count() const { return get_frame_data_size() / sizeof( float3 ); }
+
+    // The timestamp of each sample, in the frame's timestamp domain
+    std::vector< double > timestamps;
+};
+
+MAP_EXTENSION( RS2_EXTENSION_MOTION_BATCH_FRAME, librealsense::motion_batch_frame );
+
+
 }  // namespace librealsense
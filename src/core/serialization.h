@@ -3,6 +3,7 @@
 
 #pragma once
 #include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
@@ -116,6 +117,18 @@ namespace librealsense
             {}
             stream_identifier stream_id;
             frame_holder frame;
+            // What is left to do before the frame can be used (decompressing it), which a reader may leave to whoever
+            // plays the frame so it can be done on another thread; see finish()
+            std::function<void()> pending;
+            void finish()
+            {
+                if (pending)
+                {
+                    auto work = std::move(pending);
+                    pending = nullptr;
+                    work();
+                }
+            }
             static serialized_data_type get_type()
             {
                 return serialized_data_type::frame;
@@ -43,7 +43,13 @@ namespace librealsense
                                                        frame_interface* original,
                                                        rs2_extension frame_type = RS2_EXTENSION_MOTION_FRAME) = 0;
 
-        virtual frame_interface* allocate_composite_frame(std::vector<frame_holder> frames) = 0;
+        // A motion batch frame for 'samples' samples, with the header of 'original' (its first sample)
+        virtual frame_interface* allocate_motion_batch_frame(std::shared_ptr<stream_profile_interface> stream,
+                                                             frame_interface* original,
+                                                             size_t samples) = 0;
+
+        // Takes the frames out of 'frames', leaving it (with its capacity) for the caller to reuse
+        virtual frame_interface* allocate_composite_frame(std::vector<frame_holder> && frames) = 0;
 
         virtual frame_interface* allocate_points(std::shared_ptr<stream_profile_interface> stream, 
             frame_interface* original, 
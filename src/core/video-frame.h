@@ -26,6 +26,15 @@ public:
     int get_stride() const { return _stride; }
     int get_bpp() const { return _bpp; }
 
+    void get_view( rs2_frame_view & view ) const override
+    {
+        frame::get_view( view );
+        view.width = _width;
+        view.height = _height;
+        view.stride_in_bytes = _stride;
+        view.bits_per_pixel = _bpp;
+    }
+
     void assign( int width, int height, int stride, int bpp )
     {
         _width = width;
@@ -91,7 +91,8 @@ namespace librealsense
                                               rs2_rs400_visual_preset preset, uint16_t device_pid,
                                               const firmware_version& fw_version)
     {
-        auto p = get_all();
+        auto const current = get_all();
+        auto p = current;
         res_type res;
         // configuration is empty before first streaming - so set default res
         if (configuration.empty())
@@ -197,7 +198,7 @@ namespace librealsense
             throw invalid_value_exception( rsutils::string::from()
                                             << "apply_preset(...) failed! Invalid preset! (" << preset << ")" );
         }
-        set_all(p);
+        set_all(p, &current);
     }
 
     void ds_advanced_mode_base::get_depth_control_group(STDepthControlGroup* ptr, int mode) const
@@ -694,6 +695,11 @@ namespace librealsense
             (*_color_sensor)->get_option(RS2_OPTION_POWER_LINE_FREQUENCY).set((float)val.power_line_frequency);
     }
 
+    unsigned long long ds_advanced_mode_base::get_skipped_transfers() const
+    {
+        return _skipped_transfers;
+    }
+
     void ds_advanced_mode_base::block( const std::string & exception_message )
     {
         _blocked = true;
@@ -722,9 +728,10 @@ namespace librealsense
             throw wrong_api_call_sequence_exception( rsutils::string::from()
                                                      << "load_json(...) failed! Device is not in Advanced-Mode." );
 
-        auto p = get_all();
+        auto const current = get_all();
+        auto p = current;
         update_structs(_depth_sensor.get_device(),  json_content, p);
-        set_all(p);
+        set_all(p, &current);
         _preset_opt->set(RS2_RS400_VISUAL_PRESET_CUSTOM);
     }
 
@@ -766,67 +773,109 @@ namespace librealsense
         return p;
     }
 
-    void ds_advanced_mode_base::set_all( const preset & p )
+    void ds_advanced_mode_base::set_all( const preset & p, const preset * current )
     {
-        set_all_depth( p );
+        set_all_depth( p, current );
         if( should_set_rgb_preset() )
-            set_all_rgb( p );
+            set_all_rgb( p, current );
     }
 
-    void ds_advanced_mode_base::set_all_depth(const preset& p)
+    // Each group is its own SET_ADV command (the firmware has no command to write several), followed by a
+    // 20ms wait: switching between presets that share most of their values is much faster when the
+    // groups that did not change are left alone. A control written before others (e.g., auto-exposure
+    // before exposure) may change them on the device, so they are then written regardless.
+    void ds_advanced_mode_base::set_all_depth(const preset& p, const preset* current)
     {
-        set(p.depth_controls, advanced_mode_traits<STDepthControlGroup>::group);
-        set(p.rsm           , advanced_mode_traits<STRsm>::group);
-        set(p.rsvc          , advanced_mode_traits<STRauSupportVectorControl>::group);
-        set(p.hdad          , advanced_mode_traits<STHdad>::group);
+        set(p, current, &preset::depth_controls);
+        set(p, current, &preset::rsm);
+        set(p, current, &preset::rsvc);
+        set(p, current, &preset::hdad);
 
         // Setting auto-white-balance control before colorCorrection parameters
-        set_depth_auto_white_balance(p.depth_auto_white_balance);
-        set(p.cc            , advanced_mode_traits<STColorCorrection>::group);
+        auto after_awb = current;
+        if (should_set(p, current, &preset::depth_auto_white_balance, &auto_white_balance_control::auto_white_balance))
+        {
+            set_depth_auto_white_balance(p.depth_auto_white_balance);
+            after_awb = nullptr;
+        }
+        set(p, after_awb, &preset::cc);
 
-        set(p.depth_table   , advanced_mode_traits<STDepthTableControl>::group);
-        set(p.ae            , advanced_mode_traits<STAEControl>::group);
-        set(p.census        , advanced_mode_traits<STCensusRadius>::group);
+        set(p, current, &preset::depth_table);
+        set(p, current, &preset::ae);
+        set(p, current, &preset::census);
         if (*_amplitude_factor_support)
-            set(p.amplitude_factor, advanced_mode_traits<STAFactor>::group);
+            set(p, current, &preset::amplitude_factor);
 
-        set_laser_state(p.laser_state);
-        if (p.laser_state.was_set && p.laser_state.laser_state == 1) // 1 - on
+        auto after_laser_state = current;
+        if (should_set(p, current, &preset::laser_state, &laser_state_control::laser_state))
+        {
+            set_laser_state(p.laser_state);
+            after_laser_state = nullptr;
+        }
+        if (p.laser_state.was_set && p.laser_state.laser_state == 1 // 1 - on
+            && should_set(p, after_laser_state, &preset::laser_power, &laser_power_control::laser_power))
             set_laser_power(p.laser_power);
 
-        set_depth_auto_exposure(p.depth_auto_exposure);
+        auto after_ae = current;
+        if (should_set(p, current, &preset::depth_auto_exposure, &auto_exposure_control::auto_exposure))
+        {
+            set_depth_auto_exposure(p.depth_auto_exposure);
+            after_ae = nullptr;
+        }
         if (p.depth_auto_exposure.was_set && p.depth_auto_exposure.auto_exposure == 0)
         {
-            set_depth_gain(p.depth_gain);
-            set_depth_exposure(p.depth_exposure);
+            if (should_set(p, after_ae, &preset::depth_gain, &gain_control::gain))
+                set_depth_gain(p.depth_gain);
+            if (should_set(p, after_ae, &preset::depth_exposure, &exposure_control::exposure))
+                set_depth_exposure(p.depth_exposure);
         }
 
         // Depth sensor related even though they have color in the name. Probably color from left IR imager.
-        set( p.color_control, advanced_mode_traits< STColorControl >::group );
-        set( p.rctc         , advanced_mode_traits< STRauColorThresholdsControl >::group );
-        set( p.sctc         , advanced_mode_traits< STSloColorThresholdsControl >::group );
-        set( p.spc          , advanced_mode_traits< STSloPenaltyControl >::group );
+        set(p, current, &preset::color_control);
+        set(p, current, &preset::rctc);
+        set(p, current, &preset::sctc);
+        set(p, current, &preset::spc);
     }
 
-    void ds_advanced_mode_base::set_all_rgb( const preset & p )
+    void ds_advanced_mode_base::set_all_rgb( const preset & p, const preset * current )
     {
-        set_color_auto_exposure(p.color_auto_exposure);
+        auto after_ae = current;
+        if (should_set(p, current, &preset::color_auto_exposure, &auto_exposure_control::auto_exposure))
+        {
+            set_color_auto_exposure(p.color_auto_exposure);
+            after_ae = nullptr;
+        }
         if (p.color_auto_exposure.was_set && p.color_auto_exposure.auto_exposure == 0)
         {
-            set_color_exposure(p.color_exposure);
-            set_color_gain(p.color_gain);
+            if (should_set(p, after_ae, &preset::color_exposure, &exposure_control::exposure))
+                set_color_exposure(p.color_exposure);
+            if (should_set(p, after_ae, &preset::color_gain, &gain_control::gain))
+                set_color_gain(p.color_gain);
         }
 
-        set_color_backlight_compensation(p.color_backlight_compensation);
-        set_color_brightness(p.color_brightness);
-        set_color_contrast(p.color_contrast);
-        set_color_gamma(p.color_gamma);
-        set_color_hue(p.color_hue);
-        set_color_saturation(p.color_saturation);
-        set_color_sharpness(p.color_sharpness);
-
-        set_color_auto_white_balance(p.color_auto_white_balance);
-        if (p.color_auto_white_balance.was_set && p.color_auto_white_balance.auto_white_balance == 0)
+        if (should_set(p, current, &preset::color_backlight_compensation, &backlight_compensation_control::backlight_compensation))
+            set_color_backlight_compensation(p.color_backlight_compensation);
+        if (should_set(p, current, &preset::color_brightness, &brightness_control::brightness))
+            set_color_brightness(p.color_brightness);
+        if (should_set(p, current, &preset::color_contrast, &contrast_control::contrast))
+            set_color_contrast(p.color_contrast);
+        if (should_set(p, current, &preset::color_gamma, &gamma_control::gamma))
+            set_color_gamma(p.color_gamma);
+        if (should_set(p, current, &preset::color_hue, &hue_control::hue))
+            set_color_hue(p.color_hue);
+        if (should_set(p, current, &preset::color_saturation, &saturation_control::saturation))
+            set_color_saturation(p.color_saturation);
+        if (should_set(p, current, &preset::color_sharpness, &sharpness_control::sharpness))
+            set_color_sharpness(p.color_sharpness);
+
+        auto after_awb = current;
+        if (should_set(p, current, &preset::color_auto_white_balance, &auto_white_balance_control::auto_white_balance))
+        {
+            set_color_auto_white_balance(p.color_auto_white_balance);
+            after_awb = nullptr;
+        }
+        if (p.color_auto_white_balance.was_set && p.color_auto_white_balance.auto_white_balance == 0
+            && should_set(p, after_awb, &preset::color_white_balance, &white_balance_control::white_balance))
             set_color_white_balance(p.color_white_balance);
 
         // TODO: W/O due to a FW bug of power_line_frequency control on Windows OS
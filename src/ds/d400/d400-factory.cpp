@@ -865,6 +865,7 @@ namespace librealsense
                 {
                     LOG_ERROR("RGB Extrinsic recovery routine failed");
                     _color_extrinsic.get()->reset();
+                    environment::get_instance().get_extrinsics_graph().invalidate_cached_extrinsics();
                 }
             }
             catch (...)
@@ -67,6 +67,8 @@ namespace librealsense
 
         _extrinsics[from_idx][to_idx] = extr;
         _extrinsics[to_idx][from_idx] = std::shared_ptr< rsutils::lazy< rs2_extrinsics > >( nullptr );
+
+        invalidate_table();
     }
 
     void extrinsics_graph::register_extrinsics(const stream_interface & from, const stream_interface & to, rs2_extrinsics extr)
@@ -101,6 +103,14 @@ namespace librealsense
 
         auto & lazy_extr = *sp;
         lazy_extr = [=]() { return extr; };
+
+        invalidate_table();
+    }
+
+    void extrinsics_graph::invalidate_cached_extrinsics()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        invalidate_table();
     }
 
     void extrinsics_graph::cleanup_extrinsics()
@@ -133,7 +143,15 @@ namespace librealsense
         }
 
         if (!invalid_ids.empty())
+        {
+            invalidate_table();
             LOG_INFO("Found " << invalid_ids.size() << " unreachable streams, " << std::dec << counter << " extrinsics deleted");
+        }
+    }
+
+    void extrinsics_graph::invalidate_table()
+    {
+        std::atomic_store( &_table, std::shared_ptr< extrinsics_table >() );
     }
 
     int extrinsics_graph::find_stream_profile(const stream_interface& p, bool add_if_not_there)
@@ -149,12 +167,24 @@ namespace librealsense
         if( !add_if_not_there )
             return -1;
         _streams[max + 1] = sp;
+        invalidate_table();
         return max + 1;
 
     }
 
     bool extrinsics_graph::try_fetch_extrinsics(const stream_interface& from, const stream_interface& to, rs2_extrinsics* extr)
     {
+        if( &from == &to )
+        {
+            *extr = identity_matrix();
+            return true;
+        }
+
+        // Fast path: the pair was already resolved since the graph last changed
+        auto table = std::atomic_load( &_table );
+        if( table && table->try_get( from, to, extr ) )
+            return true;
+
         std::lock_guard<std::mutex> lock(_mutex);
         cleanup_extrinsics();
         auto from_idx = find_stream_profile(from);
@@ -167,7 +197,18 @@ namespace librealsense
         }
 
         std::set<int> visited;
-        return try_fetch_extrinsics(from_idx, to_idx, visited, extr);
+        if( ! try_fetch_extrinsics( from_idx, to_idx, visited, extr ) )
+            return false;
+
+        // Cache the result; the table is (re)built from the current streams if the graph changed since it was last used
+        table = std::atomic_load( &_table );
+        if( ! table )
+        {
+            table = std::make_shared< extrinsics_table >( _streams );
+            std::atomic_store( &_table, table );
+        }
+        table->set( from, to, *extr );
+        return true;
     }
 
     bool extrinsics_graph::try_fetch_extrinsics(int from, int to, std::set<int>& visited, rs2_extrinsics* extr)
@@ -238,6 +279,71 @@ namespace librealsense
     }
 
 
+    extrinsics_graph::extrinsics_table::extrinsics_table(
+        std::map< int, std::weak_ptr< const stream_interface > > const & streams )
+    {
+        for( auto && kvp : streams )
+        {
+            auto sp = kvp.second.lock();
+            if( ! sp )
+                continue;
+            _index[sp.get()] = int( _streams.size() );
+            _streams.push_back( kvp.second );
+        }
+
+        auto const n_cells = _streams.size() * _streams.size();
+        _resolved.reset( new std::atomic< bool >[n_cells] );
+        for( size_t i = 0; i < n_cells; ++i )
+            _resolved[i].store( false, std::memory_order_relaxed );
+        _extrinsics.reset( new rs2_extrinsics[n_cells] );
+    }
+
+    int extrinsics_graph::extrinsics_table::find( const stream_interface & p ) const
+    {
+        auto it = _index.find( &p );
+        if( it == _index.end() )
+            return -1;
+        // The address may belong to a new stream, allocated after the one we indexed was destroyed
+        if( _streams[it->second].expired() )
+            return -1;
+        return it->second;
+    }
+
+    bool extrinsics_graph::extrinsics_table::try_get( const stream_interface & from,
+                                                      const stream_interface & to,
+                                                      rs2_extrinsics * extr ) const
+    {
+        auto from_idx = find( from );
+        if( from_idx < 0 )
+            return false;
+        auto to_idx = find( to );
+        if( to_idx < 0 )
+            return false;
+
+        auto const cell = from_idx * _streams.size() + to_idx;
+        if( ! _resolved[cell].load( std::memory_order_acquire ) )
+            return false;
+        *extr = _extrinsics[cell];
+        return true;
+    }
+
+    void extrinsics_graph::extrinsics_table::set( const stream_interface & from,
+                                                  const stream_interface & to,
+                                                  rs2_extrinsics const & extr )
+    {
+        auto from_idx = find( from );
+        auto to_idx = find( to );
+        if( from_idx < 0 || to_idx < 0 )
+            return;
+
+        auto const cell = from_idx * _streams.size() + to_idx;
+        if( _resolved[cell].load( std::memory_order_relaxed ) )
+            return;
+        _extrinsics[cell] = extr;
+        _resolved[cell].store( true, std::memory_order_release );
+    }
+
+
     environment::environment()
         : _stream_id( 0 )
     {
@@ -8,6 +8,7 @@
 #include <mutex>
 #include <set>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <atomic>
 
@@ -41,6 +42,10 @@ namespace librealsense
     * 
     * 
     *        The search in the graph is implemented as DFS, and it is implemented in the try_fetch_extrinsics method
+    *
+    *        Since extrinsics are fetched per frame (align, pointcloud, etc.), resolved results are cached in a dense
+    *        from->to table indexed by stream. The table is published as an immutable snapshot and is discarded whenever
+    *        the graph changes (registration, override or cleanup), so lookups of already-resolved pairs need no lock.
     */
     class extrinsics_graph
     {
@@ -54,6 +59,8 @@ namespace librealsense
         void register_extrinsics(const stream_interface& from, const stream_interface& to, rs2_extrinsics extr);
         void override_extrinsics(const stream_interface& from, const stream_interface& to, rs2_extrinsics const & extr);
         bool try_fetch_extrinsics(const stream_interface& from, const stream_interface& to, rs2_extrinsics* extr);
+        // For when registered extrinsics are reset in place, so what was resolved from them is fetched again
+        void invalidate_cached_extrinsics();
 
         struct extrinsics_lock
         {
@@ -84,7 +91,27 @@ namespace librealsense
         std::map<int, std::weak_ptr<const stream_interface>> _streams;
 
     private:
+        // Snapshot of the streams in the graph, with a dense NxN matrix of resolved extrinsics between them.
+        // The shape (streams and their indices) never changes once published; each cell is written once, under
+        // _mutex, and then marked resolved so readers can access it without locking.
+        struct extrinsics_table
+        {
+            explicit extrinsics_table( std::map< int, std::weak_ptr< const stream_interface > > const & streams );
+
+            bool try_get( const stream_interface & from, const stream_interface & to, rs2_extrinsics * extr ) const;
+            void set( const stream_interface & from, const stream_interface & to, rs2_extrinsics const & extr );
+
+        private:
+            int find( const stream_interface & p ) const;
+
+            std::unordered_map< const stream_interface *, int > _index;
+            std::vector< std::weak_ptr< const stream_interface > > _streams;
+            std::unique_ptr< std::atomic< bool >[] > _resolved;
+            std::unique_ptr< rs2_extrinsics[] > _extrinsics;
+        };
+
         std::mutex _mutex;
+        std::shared_ptr< extrinsics_table > _table;  // Accessed only with std::atomic_load/store
         std::shared_ptr< rsutils::lazy< rs2_extrinsics > > _id;
         // Required by current implementation to hold the reference instead of the device for certain types. TODO
         std::vector< std::shared_ptr< rsutils::lazy< rs2_extrinsics > > > _external_extrinsics;
@@ -92,6 +119,7 @@ namespace librealsense
         std::shared_ptr< rsutils::lazy< rs2_extrinsics > > fetch_edge( int from, int to );
         bool try_fetch_extrinsics(int from, int to, std::set<int>& visited, rs2_extrinsics* extr);
         void cleanup_extrinsics();
+        void invalidate_table();
         int find_stream_profile(const stream_interface& p, bool add_if_not_there = true);
 
         std::atomic<int> _locks_count;
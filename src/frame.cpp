@@ -196,6 +196,33 @@ rs2_time_t frame::get_frame_system_time() const
     return additional_data.system_time;
 }
 
+void frame::get_view( rs2_frame_view & view ) const
+{
+    // Virtual calls, so a composite frame looks like its first frame
+    view.data = get_frame_data();
+    view.data_size = get_frame_data_size();
+    view.width = view.height = view.stride_in_bytes = view.bits_per_pixel = 0;
+    view.timestamp = get_frame_timestamp();
+    view.timestamp_domain = get_frame_timestamp_domain();
+    view.frame_number = get_frame_number();
+    view.depth_units = 0.f;
+    if( auto const & profile = get_stream() )
+    {
+        view.format = profile->get_format();
+        view.stream = profile->get_stream_type();
+        view.stream_index = profile->get_stream_index();
+        view.unique_id = profile->get_unique_id();
+        view.profile = profile->get_c_wrapper();
+    }
+    else
+    {
+        view.format = RS2_FORMAT_ANY;
+        view.stream = RS2_STREAM_ANY;
+        view.stream_index = view.unique_id = 0;
+        view.profile = nullptr;
+    }
+}
+
 float depth_frame::get_distance( int x, int y ) const
 {
     // If this frame does not itself contain Z16 depth data,
@@ -65,6 +65,10 @@ public:
     void release() override;
     void keep() override;
 
+    // True when the caller holds the only reference and the data is not borrowed from a backend or
+    // user buffer: the frame may then be written to and passed on in place of a new one
+    bool is_exclusive() const { return ref_count == 1 && ! on_release.get_data(); }
+
     frame_interface * publish( std::shared_ptr< archive_interface > new_owner ) override;
     void unpublish() override {}
     void attach_continuation( frame_continuation && continuation ) override
@@ -81,6 +85,8 @@ public:
     void mark_fixed() override { _fixed = true; }
     bool is_fixed() const override { return _fixed; }
 
+    void get_view( rs2_frame_view & view ) const override;
+
     void set_blocking( bool state ) override { additional_data.is_blocking = state; }
     bool is_blocking() const override { return additional_data.is_blocking; }
 
@@ -0,0 +1,218 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+#include "fw-log-templates.h"
+#include <rsutils/easylogging/easyloggingpp.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+using namespace std;
+
+namespace librealsense
+{
+    namespace fw_logs
+    {
+        namespace
+        {
+            void append_number(string& out, const char* format, uint32_t value)
+            {
+                char buf[16];
+                int n = snprintf(buf, sizeof(buf), format, value);
+                out.append(buf, n);
+            }
+
+            // Same as writing to a default ostream
+            void append_number(string& out, float value)
+            {
+                char buf[32];
+                int n = snprintf(buf, sizeof(buf), "%g", value);
+                out.append(buf, n);
+            }
+
+            const string unknown_name = "Unknown";
+        }
+
+
+        fw_log_templates::fw_log_templates(const fw_logs_formating_options& options)
+            : _enums(options._fw_logs_enum_names_list),
+            _file_names(options._fw_logs_file_names_list),
+            _thread_names(options._fw_logs_thread_names_list)
+        {
+            for (auto const& event : options._fw_logs_event_list)
+                _events[event.first] = compile(event.second.line, event.second.num_of_params);
+            _unrecognized = compile("! P1 = 0x{0:x}, P2 = 0x{1:x}, P3 = 0x{2:x}", 3);
+        }
+
+        fw_log_templates::event_slots fw_log_templates::compile(const string& line, size_t num_of_params)
+        {
+            event_slots event{ uint32_t(_slots.size()), 0 };
+            auto add_text = [&](size_t begin, size_t end) {
+                if (begin == end)
+                    return;
+                if (!_slots.empty() && _slots.size() > event.begin && _slots.back().kind == slot::text)
+                {
+                    _text.append(line, begin, end - begin);
+                    _slots.back().end = uint32_t(_text.size());
+                    return;
+                }
+                slot s{ slot::text, 0, uint32_t(_text.size()), 0, nullptr };
+                _text.append(line, begin, end - begin);
+                s.end = uint32_t(_text.size());
+                _slots.push_back(s);
+            };
+
+            size_t text_begin = 0;
+            size_t pos = 0;
+            while ((pos = line.find('{', pos)) != string::npos)
+            {
+                // The parameter number, as the regex \{\b(i)... matched it: no leading zeros
+                size_t p = pos + 1;
+                size_t digits_end = p;
+                while (digits_end < line.size() && isdigit((unsigned char)line[digits_end]))
+                    ++digits_end;
+                size_t const n_digits = digits_end - p;
+                if (!n_digits || (n_digits > 1 && line[p] == '0') || n_digits > 3)
+                {
+                    ++pos;
+                    continue;
+                }
+                size_t const param = stoul(line.substr(p, n_digits));
+                if (param >= num_of_params || param >= 3)
+                {
+                    ++pos;
+                    continue;
+                }
+
+                slot s{ slot::text, uint8_t(param), 0, 0, nullptr };
+                size_t end = string::npos;
+                if (line.compare(digits_end, 1, "}") == 0)
+                {
+                    s.kind = slot::decimal;
+                    end = digits_end + 1;
+                }
+                else if (line.compare(digits_end, 3, ":x}") == 0)
+                {
+                    s.kind = slot::hex;
+                    end = digits_end + 3;
+                }
+                else if (line.compare(digits_end, 3, ":f}") == 0)
+                {
+                    s.kind = slot::real;
+                    end = digits_end + 3;
+                }
+                else if (line.compare(digits_end, 1, ",") == 0)
+                {
+                    size_t name_end = digits_end + 1;
+                    while (name_end < line.size() && isalpha((unsigned char)line[name_end]))
+                        ++name_end;
+                    if (name_end > digits_end + 1 && line.compare(name_end, 1, "}") == 0)
+                    {
+                        auto it = _enums.find(line.substr(digits_end + 1, name_end - digits_end - 1));
+                        if (it != _enums.end())
+                        {
+                            s.kind = slot::enumerated;
+                            s.values = &it->second;
+                            s.begin = uint32_t(_text.size());
+                            _text.append(it->first);  // for the error message
+                            s.end = uint32_t(_text.size());
+                            end = name_end + 1;
+                        }
+                    }
+                }
+                if (end == string::npos)
+                {
+                    ++pos;
+                    continue;
+                }
+
+                add_text(text_begin, pos);
+                _slots.push_back(s);
+                text_begin = pos = end;
+            }
+            add_text(text_begin, line.size());
+
+            event.end = uint32_t(_slots.size());
+            return event;
+        }
+
+        void fw_log_templates::format(string& out, int event_id, const uint32_t params[3]) const
+        {
+            auto it = _events.find(event_id);
+            if (it != _events.end())
+                return format(out, it->second, params);
+
+            out.append("*** Unrecognized Log Id: ");
+            append_number(out, "%u", uint32_t(event_id));
+            format(out, _unrecognized, params);
+        }
+
+        void fw_log_templates::format(string& out, event_slots const& event, const uint32_t params[3]) const
+        {
+            for (auto i = event.begin; i < event.end; ++i)
+            {
+                auto& s = _slots[i];
+                auto value = params[s.param];
+                switch (s.kind)
+                {
+                case slot::text:
+                    out.append(_text, s.begin, s.end - s.begin);
+                    break;
+
+                case slot::decimal:
+                    append_number(out, "%u", value);
+                    break;
+
+                case slot::hex:
+                    append_number(out, "%02x", value);
+                    break;
+
+                case slot::real:
+                {
+                    // Parse int32_t as 4 raw bytes of float
+                    float tmp;
+                    memcpy(&tmp, &value, sizeof(tmp));
+                    if (std::isfinite(tmp))
+                        append_number(out, tmp);
+                    else
+                    {
+                        LOG_ERROR("Expecting a number, received infinite or NaN");
+                        out.append("0x");
+                        append_number(out, "%02x", value);
+                    }
+                    break;
+                }
+
+                case slot::enumerated:
+                {
+                    auto const& values = *s.values;
+                    auto v = std::find_if(values.begin(), values.end(), [value](const kvp& entry) { return entry.first == int(value); });
+                    if (v != values.end())
+                        out.append(v->second);
+                    else
+                    {
+                        LOG_ERROR("Protocol Error recognized! Improper log message received: invalid parameter "
+                                  << int(value) << " for " << _text.substr(s.begin, s.end - s.begin));
+                        append_number(out, "%u", value);
+                    }
+                    break;
+                }
+                }
+            }
+        }
+
+        const string& fw_log_templates::get_file_name(int id) const
+        {
+            auto it = _file_names.find(id);
+            return it != _file_names.end() ? it->second : unknown_name;
+        }
+
+        const string& fw_log_templates::get_thread_name(uint32_t thread_id) const
+        {
+            auto it = _thread_names.find(thread_id);
+            return it != _thread_names.end() ? it->second : unknown_name;
+        }
+    }
+}
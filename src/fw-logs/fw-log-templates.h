@@ -0,0 +1,61 @@
+/* License: Apache 2.0. See LICENSE file in root directory. */
+/* Copyright(c) 2024 Intel Corporation. All Rights Reserved. */
+#pragma once
+#include <string>
+#include <stdint.h>
+#include <vector>
+#include <unordered_map>
+#include "fw-logs-formating-options.h"
+
+namespace librealsense
+{
+    namespace fw_logs
+    {
+        // The event formats of the XML, compiled once into literal text and parameter slots, so a message
+        // is made by appending the pieces in order: no regex, and no allocation beyond the output's own.
+        // Parameter i, below the event's number of parameters, is written for "{i}" in decimal, for "{i:x}"
+        // in hex (2 digits at least), for "{i:f}" as the float of its bits, and for "{i,EnumName}" as the
+        // enum's name for it; anything else is kept as text.
+        class fw_log_templates
+        {
+        public:
+            explicit fw_log_templates(const fw_logs_formating_options& options);
+            fw_log_templates(const fw_log_templates&) = delete;
+            fw_log_templates& operator=(const fw_log_templates&) = delete;
+
+            // Appends the message of the event to 'out'; unknown events get a generic message with the
+            // raw parameters
+            void format(std::string& out, int event_id, const uint32_t params[3]) const;
+
+            const std::string& get_file_name(int id) const;
+            const std::string& get_thread_name(uint32_t thread_id) const;
+
+        private:
+            struct slot
+            {
+                enum kind_type : uint8_t { text, decimal, hex, real, enumerated };
+                kind_type kind;
+                uint8_t param;
+                uint32_t begin, end;                    // the text, in _text
+                const std::vector<kvp>* values;         // for enumerated
+            };
+
+            struct event_slots
+            {
+                uint32_t begin, end;                    // in _slots
+            };
+
+            event_slots compile(const std::string& line, size_t num_of_params);
+            void format(std::string& out, event_slots const& event, const uint32_t params[3]) const;
+
+            std::string _text;
+            std::vector<slot> _slots;
+            std::unordered_map<int, event_slots> _events;
+            event_slots _unrecognized;
+
+            std::unordered_map<std::string, std::vector<kvp>> _enums;
+            std::unordered_map<int, std::string> _file_names;
+            std::unordered_map<int, std::string> _thread_names;
+        };
+    }
+}
@@ -27,6 +27,7 @@ namespace librealsense
         typedef std::pair<int, std::string> kvp;     // XML key/value pair
 
         class fw_logs_xml_helper;
+        class fw_log_templates;
 
         class fw_logs_formating_options
         {
@@ -43,6 +44,7 @@ namespace librealsense
 
         private:
             friend fw_logs_xml_helper;
+            friend fw_log_templates;
             std::unordered_map<int, fw_log_event> _fw_logs_event_list;
             std::unordered_map<int, std::string> _fw_logs_file_names_list;
             std::unordered_map<int, std::string> _fw_logs_thread_names_list;
@@ -1,9 +1,6 @@
 // License: Apache 2.0. See LICENSE file in root directory.
 // Copyright(c) 2019 Intel Corporation. All Rights Reserved.
 #include "fw-logs-parser.h"
-#include <regex>
-#include <sstream>
-#include "fw-string-formatter.h"
 #include "stdint.h"
 
 using namespace std;
@@ -18,6 +15,7 @@ namespace librealsense
             _timestamp_factor(0.00001)
         {
             _fw_logs_formating_options.initialize_from_xml();
+            _templates.reset(new fw_log_templates(_fw_logs_formating_options));
         }
 
 
@@ -35,27 +33,60 @@ namespace librealsense
             log_data = fill_log_data(fw_log_msg);
 
             //message
-            fw_string_formatter reg_exp(_fw_logs_formating_options.get_enums());
-            fw_log_event log_event_data;
-            _fw_logs_formating_options.get_event_data(log_data._event_id, &log_event_data);
-
             uint32_t params[3] = { log_data._p1, log_data._p2, log_data._p3 };
-            reg_exp.generate_message(log_event_data.line, log_event_data.num_of_params, params, &log_data._message);
+            _templates->format(log_data._message, log_data._event_id, params);
 
             //file_name
-            _fw_logs_formating_options.get_file_name(log_data._file_id, &log_data._file_name);
+            log_data._file_name = _templates->get_file_name(log_data._file_id);
 
             //thread_name
-            _fw_logs_formating_options.get_thread_name(log_data._thread_id, &log_data._thread_name);
+            log_data._thread_name = _templates->get_thread_name(log_data._thread_id);
 
             return log_data;
         }
 
+        size_t fw_logs_parser::parse_fw_logs(const uint8_t* data, size_t size, std::vector<fw_log_entry>& entries, std::string& text)
+        {
+            entries.clear();
+            text.clear();
+            for (size_t offset = 0; offset + BINARY_DATA_SIZE <= size; offset += BINARY_DATA_SIZE)
+            {
+                // No strings in log_data are touched, so none are allocated
+                auto log_data = fill_log_data(data + offset);
+
+                fw_log_entry entry;
+                entry.severity = log_data._severity;
+                entry.file_id = log_data._file_id;
+                entry.group_id = log_data._group_id;
+                entry.event_id = log_data._event_id;
+                entry.line = log_data._line;
+                entry.sequence = log_data._sequence;
+                entry.thread_id = log_data._thread_id;
+                entry.timestamp = log_data._timestamp;
+                entry.delta = log_data._delta;
+
+                uint32_t params[3] = { log_data._p1, log_data._p2, log_data._p3 };
+                entry.message_begin = text.size();
+                _templates->format(text, log_data._event_id, params);
+                entry.message_end = text.size();
+
+                entry.file_name = &_templates->get_file_name(log_data._file_id);
+                entry.thread_name = &_templates->get_thread_name(log_data._thread_id);
+                entries.push_back(entry);
+            }
+            return entries.size();
+        }
+
         fw_log_data fw_logs_parser::fill_log_data(const fw_logs_binary_data* fw_log_msg)
+        {
+            return fill_log_data(fw_log_msg->logs_buffer.data());
+        }
+
+        fw_log_data fw_logs_parser::fill_log_data(const uint8_t* log)
         {
             fw_log_data log_data;
 
-            auto* log_binary = reinterpret_cast<const fw_logs::fw_log_binary*>(fw_log_msg->logs_buffer.data());
+            auto* log_binary = reinterpret_cast<const fw_logs::fw_log_binary*>(log);
 
             //parse first DWORD
             log_data._magic_number = static_cast<uint32_t>(log_binary->dword1.bits.magic_number);
@@ -5,12 +5,32 @@
 #include <vector>
 #include <memory>
 #include "fw-logs-formating-options.h"
+#include "fw-log-templates.h"
 #include "fw-log-data.h"
 
 namespace librealsense
 {
     namespace fw_logs
     {
+        // A log entry out of parse_fw_logs(): the message is in the text the batch was parsed into, and the
+        // names are the parser's
+        struct fw_log_entry
+        {
+            uint32_t severity;
+            uint32_t file_id;
+            uint32_t group_id;
+            uint32_t event_id;
+            uint32_t line;
+            uint32_t sequence;
+            uint32_t thread_id;
+            uint64_t timestamp;
+            double delta;
+
+            size_t message_begin, message_end;
+            const std::string* file_name;
+            const std::string* thread_name;
+        };
+
         class fw_logs_parser : public std::enable_shared_from_this<fw_logs_parser>
         {
         public:
@@ -19,11 +39,17 @@ namespace librealsense
 
             fw_log_data parse_fw_log(const fw_logs_binary_data* fw_log_msg);
 
+            // Parses a buffer of raw log entries, BINARY_DATA_SIZE bytes each, into 'entries' and their
+            // messages into 'text'. Both are cleared first: when reused, nothing is allocated once they
+            // have grown to size. Returns the number of entries.
+            size_t parse_fw_logs(const uint8_t* data, size_t size, std::vector<fw_log_entry>& entries, std::string& text);
 
         private:
             fw_log_data fill_log_data(const fw_logs_binary_data* fw_log_msg);
+            fw_log_data fill_log_data(const uint8_t* log);
 
             fw_logs_formating_options _fw_logs_formating_options;
+            std::unique_ptr<fw_log_templates> _templates;
             uint64_t _last_timestamp;
             const double _timestamp_factor;
         };
@@ -36,6 +36,7 @@ namespace librealsense
                 const rs2::frame& f) override;
 
             bool run__occlusion_filter(const rs2_extrinsics& extr) override;
+            bool map_texture_in_one_pass() const override { return false; }
 
             std::shared_ptr<rs2::visualizer_2d> _projection_renderer;
             std::shared_ptr<rs2::visualizer_2d> _occu_renderer;
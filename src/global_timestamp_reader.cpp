@@ -7,6 +7,19 @@ using namespace std::chrono;
 
 namespace librealsense
 {
+    static const double max_device_time(pow(2, 32) * TIMESTAMP_USEC_TO_MSEC);
+
+    // Device time is a 32-bit microsecond counter: returns what to add to x to bring it to the
+    // same side of a wraparound as ref
+    static double wraparound_offset(double x, double ref)
+    {
+        if ((ref - x) > max_device_time / 2)
+            return max_device_time;
+        if ((x - ref) > max_device_time / 2)
+            return -max_device_time;
+        return 0;
+    }
+
     CSample& CSample::operator-=(const CSample& other)
     {
         _x -= other._x;
@@ -103,43 +116,63 @@ namespace librealsense
         _prev_time = _last_request_time;
     }
 
-    void CLinearCoefficients::get_a_b(double x, double& a, double& b) const
+    void CLinearCoefficientsSnapshot::get_a_b(double x, double& a, double& b) const
     {
-        a = _dest_a;
-        b = _dest_b;
-        if (x - _prev_time < _time_span_ms)
+        a = dest_a;
+        b = dest_b;
+        if (x - prev_time < time_span_ms)
         {
-            double dt((x - _prev_time) / _time_span_ms);
-            a = _dest_a * dt + _prev_a * (1 - dt);
-            b = _dest_b * dt + _prev_b * (1 - dt);
+            double dt((x - prev_time) / time_span_ms);
+            a = dest_a * dt + prev_a * (1 - dt);
+            b = dest_b * dt + prev_b * (1 - dt);
         }
     }
 
-    double CLinearCoefficients::calc_value(double x) const
+    double CLinearCoefficientsSnapshot::calc_value(double x) const
     {
+        // The samples may not have been moved past a wraparound yet: evaluate x where they are
+        x += wraparound_offset(x, last_x);
         double a, b;
         get_a_b(x, a, b);
-        double y(a * (x - _base_sample._x) + b + _base_sample._y);
-        //LOG_DEBUG(__FUNCTION__ << ": " << x << " -> " << y << " with coefs:" << a << ", " << b << ", " << _base_sample._x << ", " << _base_sample._y);
+        double y(a * (x - base_sample._x) + b + base_sample._y);
+        //LOG_DEBUG(__FUNCTION__ << ": " << x << " -> " << y << " with coefs:" << a << ", " << b << ", " << base_sample._x << ", " << base_sample._y);
         return y;
     }
 
+    CLinearCoefficientsSnapshot CLinearCoefficients::get_snapshot() const
+    {
+        CLinearCoefficientsSnapshot snapshot;
+        snapshot.is_ready = ! _last_values.empty();
+        if (snapshot.is_ready)
+        {
+            snapshot.base_sample = _base_sample;
+            snapshot.prev_a = _prev_a;
+            snapshot.prev_b = _prev_b;
+            snapshot.dest_a = _dest_a;
+            snapshot.dest_b = _dest_b;
+            snapshot.prev_time = _prev_time;
+            snapshot.time_span_ms = _time_span_ms;
+            snapshot.last_x = _last_values.front()._x;
+        }
+        return snapshot;
+    }
+
+    double CLinearCoefficients::calc_value(double x) const
+    {
+        return get_snapshot().calc_value(x);
+    }
+
     bool CLinearCoefficients::update_samples_base(double x)
     {
-        static const double max_device_time(pow(2, 32) * TIMESTAMP_USEC_TO_MSEC);
-        double base_x;
         if (_last_values.empty())
             return false;
-        if ((_last_values.front()._x - x) > max_device_time / 2)
-            base_x = max_device_time;
-        else if ((x - _last_values.front()._x) > max_device_time / 2)
-            base_x = -max_device_time;
-        else
+        double base_x = wraparound_offset(x, _last_values.front()._x);
+        if (base_x == 0)
             return false;
         LOG_DEBUG(__FUNCTION__ << "(" << base_x << ")");
 
         double a, b;
-        get_a_b(x+base_x, a, b);
+        get_snapshot().get_a_b(x+base_x, a, b);
         for (auto &&sample : _last_values)
         {
             sample._x -= base_x;
@@ -151,6 +184,8 @@ namespace librealsense
 
     void CLinearCoefficients::update_last_sample_time(double x)
     {
+        if (! _last_values.empty())
+            x += wraparound_offset(x, _last_values.front()._x);
         _last_request_time = x;
     }
 
@@ -164,7 +199,8 @@ namespace librealsense
         _active_object([this](dispatcher::cancellable_timer cancellable_timer)
             {
                 polling(cancellable_timer);
-            })
+            }),
+        _last_request_time(-1)
     {
         //LOG_DEBUG("start new time_diff_keeper ");
     }
@@ -189,8 +225,11 @@ namespace librealsense
         {
             LOG_DEBUG("time_diff_keeper::stop: stop object.");
             _active_object.stop();
+            std::lock_guard<std::recursive_mutex> lock(_coefs_mtx);
             _coefs.reset();
             _is_ready = false;
+            _last_request_time = -1;
+            publish_coefs();
         }
     }
 
@@ -210,7 +249,7 @@ namespace librealsense
             double system_time_finish = duration<double, std::milli>(system_clock::now().time_since_epoch()).count();
             double command_delay = (system_time_finish-system_time_start)/2;
 
-            std::lock_guard<std::recursive_mutex> lock(_read_mtx);
+            std::lock_guard<std::recursive_mutex> lock(_coefs_mtx);
             if (command_delay < _min_command_delay)
             {
                 _coefs.add_const_y_coefs(command_delay - _min_command_delay);
@@ -220,10 +259,14 @@ namespace librealsense
             if (_is_ready)
             {
                 _coefs.update_samples_base(sample_hw_time);
+                double last_request_time = _last_request_time.load(std::memory_order_relaxed);
+                if (last_request_time >= 0)
+                    _coefs.update_last_sample_time(last_request_time);
             }
             CSample crnt_sample(sample_hw_time, system_time);
             _coefs.add_value(crnt_sample);
             _is_ready = true;
+            publish_coefs();
             return true;
         }
         catch (const io_exception& ex)
@@ -255,18 +298,24 @@ namespace librealsense
         }
     }
 
+    void time_diff_keeper::publish_coefs()
+    {
+        auto snapshot = _coefs.get_snapshot();
+        snapshot.is_ready = snapshot.is_ready && _is_ready;
+        _published_coefs.store(snapshot);
+    }
+
+    // Called on the frame path, for every frame: must not block on the polling thread
     double time_diff_keeper::get_system_hw_time(double crnt_hw_time, bool& is_ready)
     {
-        std::lock_guard<std::recursive_mutex> lock(_read_mtx);
-        is_ready = _is_ready;
-        if (_is_ready)
-        {
-            _coefs.update_samples_base(crnt_hw_time);
-            _coefs.update_last_sample_time(crnt_hw_time);
-            return _coefs.calc_value(crnt_hw_time);
-        }
-        else
+        auto coefs = _published_coefs.load();
+        is_ready = coefs.is_ready;
+        if (!is_ready)
             return crnt_hw_time;
+
+        // Only the most recent request is of interest to the polling thread
+        _last_request_time.store(crnt_hw_time, std::memory_order_relaxed);
+        return coefs.calc_value(crnt_hw_time);
     }
 
     global_timestamp_reader::global_timestamp_reader(std::unique_ptr<frame_timestamp_reader> device_timestamp_reader,
@@ -287,7 +336,11 @@ namespace librealsense
         {
             auto sp = _time_diff_keeper.lock();
             if (sp)
-                frame_time = sp->get_system_hw_time(frame_time, _ts_is_ready);
+            {
+                bool is_ready;
+                frame_time = sp->get_system_hw_time(frame_time, is_ready);
+                _ts_is_ready = is_ready;
+            }
             else
                 LOG_DEBUG("Notification: global_timestamp_reader - time_diff_keeper is being shut-down");
         }
@@ -6,7 +6,9 @@
 #include "sensor.h"
 #include "error-handling.h"
 #include "option.h"
+#include <rsutils/concurrency/seqlock.h>
 #include <deque>
+#include <atomic>
 
 namespace librealsense
 {
@@ -31,6 +33,22 @@ namespace librealsense
         double _y;
     };
 
+    // An immutable copy of the regression state: all that is needed to convert a device time to
+    // system time, without access to the samples
+    struct CLinearCoefficientsSnapshot
+    {
+        bool is_ready;
+        CSample base_sample;
+        double prev_a, prev_b, dest_a, dest_b;
+        double prev_time, time_span_ms;
+        double last_x;      // Device time of the latest sample, for wraparound detection
+
+        CLinearCoefficientsSnapshot() : is_ready(false), base_sample(0, 0),
+            prev_a(0), prev_b(0), dest_a(1), dest_b(0), prev_time(0), time_span_ms(1000), last_x(0) {}
+        void get_a_b(double x, double& a, double& b) const;
+        double calc_value(double x) const;
+    };
+
     class CLinearCoefficients
     {
     public:
@@ -42,10 +60,10 @@ namespace librealsense
         void update_last_sample_time(double x);
         double calc_value(double x) const;
         bool is_full() const;
+        CLinearCoefficientsSnapshot get_snapshot() const;
 
     private:
         void calc_linear_coefs();
-        void get_a_b(double x, double& a, double& b) const;
 
     private:
         unsigned int _buffer_size;
@@ -74,6 +92,7 @@ namespace librealsense
     private:
         bool update_diff_time();
         void polling(dispatcher::cancellable_timer cancellable_timer);
+        void publish_coefs();
 
     private:
         global_time_interface* _device;
@@ -81,11 +100,15 @@ namespace librealsense
         int             _users_count;
         std::shared_ptr<global_time_option> _option_is_enabled;
         active_object<> _active_object;
-        mutable std::recursive_mutex _read_mtx; // Watch only 1 reader at a time.
+        mutable std::recursive_mutex _coefs_mtx; // Watch only 1 writer of _coefs at a time.
         mutable std::recursive_mutex _enable_mtx; // Watch only 1 start/stop operation at a time.
         CLinearCoefficients _coefs;
         double _min_command_delay;
         bool _is_ready;
+        // What the frame path reads: published by the polling thread after every change to _coefs,
+        // so converting a frame timestamp never waits on the hardware-monitor round trip
+        rsutils::concurrency::seqlock< CLinearCoefficientsSnapshot > _published_coefs;
+        std::atomic< double > _last_request_time;
     };
 
     class global_timestamp_reader : public frame_timestamp_reader
@@ -103,9 +126,8 @@ namespace librealsense
     private:
         std::unique_ptr<frame_timestamp_reader> _device_timestamp_reader;
         std::weak_ptr<time_diff_keeper> _time_diff_keeper;
-        mutable std::recursive_mutex _mtx;
         std::shared_ptr<global_time_option> _option_is_enabled;
-        bool _ts_is_ready;
+        std::atomic< bool > _ts_is_ready;
     };
 
     class global_time_interface
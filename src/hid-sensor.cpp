@@ -5,6 +5,7 @@
 #include "device.h"
 #include "stream.h"
 #include "global_timestamp_reader.h"
+#include "async-log.h"
 #include "metadata.h"
 #include "platform/stream-profile-impl.h"
 #include "fourcc.h"
@@ -183,93 +184,96 @@ void hid_sensor::start( rs2_frame_callback_sptr callback )
     rs2_time_t last_timestamp = 0;
     raise_on_before_streaming_changes( true );  // Required to be just before actual start allow recording to work
 
-    _hid_device->start_capture(
-        [this, last_frame_number, last_timestamp]( const platform::sensor_data & sensor_data ) mutable
+    _hid_device->start_batch_capture(
+        [this, last_frame_number, last_timestamp]( const platform::sensor_data_batch & batch ) mutable
         {
-            const auto system_time = time_service::get_time();  // time frame was received from the backend
-            auto timestamp_reader = _hid_iio_timestamp_reader.get();
+            const auto system_time = time_service::get_time();  // time the batch was received from the backend
             static const std::string custom_sensor_name = "custom";
-            auto && sensor_name = sensor_data.sensor.name;
-            auto && request = _configured_profiles[sensor_name];
-            bool is_custom_sensor = false;
+            auto && sensor_name = batch.sensor.name;
+            auto && sensor_request = _configured_profiles[sensor_name];
+            bool const is_custom_sensor = ( sensor_name == custom_sensor_name );
             static const uint32_t custom_source_id_offset = 16;
-            uint8_t custom_gpio = 0;
-            auto custom_stream_type = RS2_STREAM_ANY;
-            if( sensor_name == custom_sensor_name )
-            {
-                custom_gpio = *(
-                    reinterpret_cast< uint8_t * >( (uint8_t *)( sensor_data.fo.pixels ) + custom_source_id_offset ) );
-                custom_stream_type = custom_gpio_to_stream_type( custom_gpio );
-
-                if( ! _is_configured_stream[custom_stream_type] )
-                {
-                    LOG_DEBUG( "Unrequested " << rs2_stream_to_string( custom_stream_type ) << " frame was dropped." );
-                    return;
-                }
-
-                is_custom_sensor = true;
-                timestamp_reader = _custom_hid_timestamp_reader.get();
-            }
 
             if( ! this->is_streaming() )
             {
-                auto stream_type = request->get_stream_type();
+                auto stream_type = sensor_request->get_stream_type();
                 LOG_INFO( "HID Frame received when Streaming is not active," << get_string( stream_type ) << ",Arrived,"
                                                                              << std::fixed << system_time );
                 return;
             }
 
-            const auto && fr = generate_frame_from_data( sensor_data.fo,
-                                                         system_time,
-                                                         timestamp_reader,
-                                                         last_timestamp,
-                                                         last_frame_number,
-                                                         request );
-            auto && frame_counter = fr->additional_data.frame_number;
-            const auto && timestamp_domain = timestamp_reader->get_frame_timestamp_domain( fr );
-            auto && timestamp = fr->additional_data.timestamp;
-            const auto && bpp = get_image_bpp( request->get_format() );
-            auto && data_size = sensor_data.fo.frame_size;
-
-            LOG_DEBUG( "FrameAccepted," << get_string( request->get_stream_type() ) << ",Counter," << std::dec
-                                        << frame_counter << ",Index,0"
-                                        << ",BackEndTS," << std::fixed << sensor_data.fo.backend_time << ",SystemTime,"
-                                        << std::fixed << system_time << " ,diff_ts[Sys-BE],"
-                                        << system_time - sensor_data.fo.backend_time << ",TS," << std::fixed
-                                        << timestamp << ",TS_Domain,"
-                                        << rs2_timestamp_domain_to_string( timestamp_domain ) << ",last_frame_number,"
-                                        << last_frame_number << ",last_timestamp," << last_timestamp );
-
-            last_frame_number = frame_counter;
-            last_timestamp = timestamp;
-            frame_holder frame = _source.alloc_frame(
-                { request->get_stream_type(), request->get_stream_index(), RS2_EXTENSION_MOTION_FRAME },
-                data_size,
-                std::move( fr->additional_data ),
-                true );
-            memcpy( (void *)frame->get_frame_data(),
-                    sensor_data.fo.pixels,
-                    sizeof( uint8_t ) * sensor_data.fo.frame_size );
-            if( ! frame )
+            // Everything above is done once per batch; the rest, for each report in it
+            for( size_t i = 0; i < batch.count; ++i )
             {
-                LOG_INFO( "Dropped frame. alloc_frame(...) returned nullptr" );
-                return;
-            }
-            frame->set_stream( request );
-            frame->set_timestamp_domain( timestamp_domain );
+                auto & fo = batch.reports[i];
+                auto & request = sensor_request;
+                auto timestamp_reader = _hid_iio_timestamp_reader.get();
+                if( is_custom_sensor )
+                {
+                    uint8_t custom_gpio
+                        = *( reinterpret_cast< uint8_t * >( (uint8_t *)( fo.pixels ) + custom_source_id_offset ) );
+                    auto custom_stream_type = custom_gpio_to_stream_type( custom_gpio );
 
-            // Gather info for logging the callback ended
-            auto fps = frame->get_stream()->get_framerate();
-            auto stream_type = frame->get_stream()->get_stream_type();
-            auto frame_number = frame->get_frame_number();
+                    if( ! _is_configured_stream[custom_stream_type] )
+                    {
+                        LOG_DEBUG( "Unrequested " << rs2_stream_to_string( custom_stream_type ) << " frame was dropped." );
+                        continue;
+                    }
 
-            // Invoke first callback
-            auto callback_start_time = time_service::get_time();
-            auto callback = frame->get_owner()->begin_callback();
-            _source.invoke_callback( std::move( frame ) );
+                    timestamp_reader = _custom_hid_timestamp_reader.get();
+                }
 
-            // Log callback ended
-            log_callback_end( fps, callback_start_time, time_service::get_time(), stream_type, frame_number );
+                const auto && fr = generate_frame_from_data( fo,
+                                                             system_time,
+                                                             timestamp_reader,
+                                                             last_timestamp,
+                                                             last_frame_number,
+                                                             request );
+                auto && frame_counter = fr->additional_data.frame_number;
+                const auto && timestamp_domain = timestamp_reader->get_frame_timestamp_domain( fr );
+                auto && timestamp = fr->additional_data.timestamp;
+                auto && data_size = fo.frame_size;
+
+                LOG_DEBUG_ASYNC( "FrameAccepted,", request->get_stream_type(),
+                                 ",Counter,", std::dec, frame_counter,
+                                 ",Index,", i,
+                                 ",BackEndTS,", std::fixed, fo.backend_time,
+                                 ",SystemTime,", std::fixed, system_time,
+                                 " ,diff_ts[Sys-BE],", system_time - fo.backend_time,
+                                 ",TS,", std::fixed, timestamp,
+                                 ",TS_Domain,", timestamp_domain,
+                                 ",last_frame_number,", last_frame_number,
+                                 ",last_timestamp,", last_timestamp );
+
+                last_frame_number = frame_counter;
+                last_timestamp = timestamp;
+                frame_holder frame = _source.alloc_frame(
+                    { request->get_stream_type(), request->get_stream_index(), RS2_EXTENSION_MOTION_FRAME },
+                    data_size,
+                    std::move( fr->additional_data ),
+                    true );
+                if( ! frame )
+                {
+                    LOG_INFO( "Dropped frame. alloc_frame(...) returned nullptr" );
+                    continue;
+                }
+                memcpy( (void *)frame->get_frame_data(), fo.pixels, sizeof( uint8_t ) * fo.frame_size );
+                frame->set_stream( request );
+                frame->set_timestamp_domain( timestamp_domain );
+
+                // Gather info for logging the callback ended
+                auto fps = frame->get_stream()->get_framerate();
+                auto stream_type = frame->get_stream()->get_stream_type();
+                auto frame_number = frame->get_frame_number();
+
+                // Invoke first callback
+                auto callback_start_time = time_service::get_time();
+                auto callback = frame->get_owner()->begin_callback();
+                _source.invoke_callback( std::move( frame ) );
+
+                // Log callback ended
+                log_callback_end( fps, callback_start_time, time_service::get_time(), stream_type, frame_number );
+            }
         } );
     _is_streaming = true;
 }
@@ -16,11 +16,15 @@ namespace librealsense
     namespace platform
     {
         std::vector<hid_device_info> query_hid_devices_info()
+        {
+            return query_hid_devices_info(platform::usb_enumerator::query_devices_info());
+        }
+
+        std::vector<hid_device_info> query_hid_devices_info(const std::vector<usb_device_info>& usb_devices)
         {
             std::vector<std::string> hid_sensors = { gyro, accel, custom };
 
             std::vector<hid_device_info> rv;
-            auto usb_devices = platform::usb_enumerator::query_devices_info();
             for (auto&& info : usb_devices) {
                 if(info.cls != RS2_USB_CLASS_HID)
                     continue;
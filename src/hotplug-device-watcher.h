@@ -0,0 +1,195 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "backend.h"
+#include "platform/device-watcher.h"
+#include "usb/usb-hotplug.h"
+#include "polling-device-watcher.h"
+#include <rsutils/concurrency/concurrency.h>
+#include <rsutils/easylogging/easyloggingpp.h>
+#include "callback-invocation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <mutex>
+
+
+namespace librealsense {
+
+
+// This device_watcher is driven by hotplug notifications rather than enumerating all devices every set amount of
+// time: only the devices that arrived or left are updated in the device list.
+//
+// A single plug generates notifications for the device and all its interfaces, and devices may bounce while
+// connecting. So, like the udev watcher, we collect events until things calm down (HOTPLUG_SETTLE_PERIOD_MS without
+// any new events) and then apply them all and report a single change.
+//
+// If the hotplug source cannot be started, we fall back to a polling_device_watcher.
+//
+class hotplug_device_watcher : public librealsense::platform::device_watcher
+{
+public:
+    // Converts the interfaces of an arriving device to the device infos the backend would have enumerated for it
+    typedef std::function< platform::backend_device_group( std::vector< platform::usb_device_info > const & ) >
+        device_group_factory;
+
+    hotplug_device_watcher( const platform::backend * backend_ref,
+                            std::shared_ptr< platform::usb_hotplug_source > source,
+                            device_group_factory to_device_group )
+        : _backend( backend_ref )
+        , _source( std::move( source ) )
+        , _to_device_group( std::move( to_device_group ) )
+        , _active_object( [this]( dispatcher::cancellable_timer cancellable_timer ) { process( cancellable_timer ); } )
+        , _devices_data()
+    {
+        // Events are only collected until we're started
+        if( ! _source
+            || ! _source->start( [this]( platform::usb_hotplug_event && event ) { on_event( std::move( event ) ); } ) )
+        {
+            LOG_WARNING( "USB hotplug notifications are not available; polling for devices instead" );
+            _source.reset();
+            _fallback = std::make_shared< polling_device_watcher >( _backend );
+            return;
+        }
+
+        // Only once events are collected, so a device that arrives meanwhile is not missed: if it is also in the
+        // snapshot, applying its event changes nothing
+        _devices_data = { _backend->query_uvc_devices(), _backend->query_usb_devices(), _backend->query_hid_devices() };
+    }
+
+    ~hotplug_device_watcher()
+    {
+        stop();
+        // No more events after this
+        if( _source )
+            _source->stop();
+    }
+
+    void start( platform::device_changed_callback callback ) override
+    {
+        if( _fallback )
+            return _fallback->start( std::move( callback ) );
+
+        stop();
+        _callback = std::move( callback );
+        _active_object.start();
+    }
+
+    void stop() override
+    {
+        if( _fallback )
+            return _fallback->stop();
+
+        _active_object.stop();
+
+        _callback_inflight.wait_until_empty();
+    }
+
+    bool is_stopped() const override
+    {
+        if( _fallback )
+            return _fallback->is_stopped();
+
+        return ! _active_object.is_active();
+    }
+
+    // Number of device-changed notifications raised (not counting the fallback)
+    size_t get_changes_count() const { return _changes_count; }
+
+private:
+    void on_event( platform::usb_hotplug_event && event )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _pending.push_back( std::move( event ) );
+        _last_event_time = std::chrono::steady_clock::now();
+    }
+
+    void process( dispatcher::cancellable_timer cancellable_timer )
+    {
+        auto const settle_period = std::chrono::milliseconds( HOTPLUG_SETTLE_PERIOD_MS );
+        if( ! cancellable_timer.try_sleep( settle_period ) )
+            return;
+
+        std::vector< platform::usb_hotplug_event > events;
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            if( _pending.empty() || std::chrono::steady_clock::now() - _last_event_time < settle_period )
+                return;
+            events.swap( _pending );
+        }
+
+        platform::backend_device_group curr = _devices_data;
+        for( auto & event : events )
+            apply( curr, event );
+
+        if( list_changed( _devices_data.uvc_devices, curr.uvc_devices )
+            || list_changed( _devices_data.usb_devices, curr.usb_devices )
+            || list_changed( _devices_data.hid_devices, curr.hid_devices ) )
+        {
+            callback_invocation_holder callback = { _callback_inflight.allocate(), &_callback_inflight };
+            if( ! callback || ! _callback )
+            {
+                // Not reported: keep the events, so the change is reported against what was, when it can be
+                std::lock_guard< std::mutex > lock( _mutex );
+                _pending.insert( _pending.begin(),
+                                 std::make_move_iterator( events.begin() ),
+                                 std::make_move_iterator( events.end() ) );
+                return;
+            }
+            LOG_DEBUG( "[hotplug] changed after " << events.size() << " events" );
+            ++_changes_count;
+            _callback( _devices_data, curr );
+        }
+        _devices_data = curr;
+    }
+
+    void apply( platform::backend_device_group & group, platform::usb_hotplug_event const & event ) const
+    {
+        auto const & path = event.device_path;
+
+        // Whether it arrived or left, anything we knew about the device is no longer valid
+        auto & uvc = group.uvc_devices;
+        uvc.erase( std::remove_if( uvc.begin(), uvc.end(),
+                                   [&]( platform::uvc_device_info const & info ) { return info.device_path == path; } ),
+                   uvc.end() );
+        auto & usb = group.usb_devices;
+        usb.erase( std::remove_if( usb.begin(), usb.end(),
+                                   [&]( platform::usb_device_info const & info ) { return info.id == path; } ),
+                   usb.end() );
+        auto & hid = group.hid_devices;
+        hid.erase( std::remove_if( hid.begin(), hid.end(),
+                                   [&]( platform::hid_device_info const & info ) { return info.device_path == path; } ),
+                   hid.end() );
+
+        if( event.arrived && ! event.interfaces.empty() )
+        {
+            auto added = _to_device_group( event.interfaces );
+            uvc.insert( uvc.end(), added.uvc_devices.begin(), added.uvc_devices.end() );
+            usb.insert( usb.end(), added.usb_devices.begin(), added.usb_devices.end() );
+            hid.insert( hid.end(), added.hid_devices.begin(), added.hid_devices.end() );
+        }
+    }
+
+    const platform::backend * _backend;
+    std::shared_ptr< platform::usb_hotplug_source > _source;
+    device_group_factory _to_device_group;
+    std::shared_ptr< polling_device_watcher > _fallback;
+
+    active_object<> _active_object;
+
+    callbacks_heap _callback_inflight;
+
+    std::mutex _mutex;
+    std::vector< platform::usb_hotplug_event > _pending;
+    std::chrono::steady_clock::time_point _last_event_time;
+
+    platform::backend_device_group _devices_data;
+    platform::device_changed_callback _callback;
+    std::atomic< size_t > _changes_count{ 0 };
+};
+
+
+}  // namespace librealsense
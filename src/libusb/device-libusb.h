@@ -9,6 +9,9 @@ namespace librealsense
 {
     namespace platform
     {
+        std::string get_device_path(libusb_device* usb_device);
+        std::vector<usb_device_info> get_subdevices(libusb_device* device, libusb_device_descriptor desc);
+
         class usb_device_libusb : public usb_device, public std::enable_shared_from_this<usb_device_libusb>
         {
         public:
@@ -0,0 +1,109 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "hotplug-libusb.h"
+#include "device-libusb.h"
+#include "types.h"
+
+namespace librealsense
+{
+    namespace platform
+    {
+        usb_hotplug_libusb::usb_hotplug_libusb() : _ctx(NULL), _handle(0), _stopping(false)
+        {
+        }
+
+        usb_hotplug_libusb::~usb_hotplug_libusb()
+        {
+            stop();
+        }
+
+        bool usb_hotplug_libusb::start(usb_hotplug_callback callback)
+        {
+            if (_ctx)
+                throw wrong_api_call_sequence_exception("hotplug notifications already started");
+
+            if (!libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG))
+            {
+                LOG_DEBUG("libusb does not support hotplug on this platform");
+                return false;
+            }
+
+            auto sts = libusb_init(&_ctx);
+            if (sts != LIBUSB_SUCCESS)
+            {
+                LOG_ERROR("libusb_init failed: " << libusb_error_name(sts));
+                _ctx = NULL;
+                return false;
+            }
+
+            _callback = std::move(callback);
+
+            // No LIBUSB_HOTPLUG_ENUMERATE: the watcher enumerates the devices already present by itself
+            sts = libusb_hotplug_register_callback(_ctx,
+                static_cast<libusb_hotplug_event>(LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT),
+                static_cast<libusb_hotplug_flag>(0),
+                LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY,
+                &usb_hotplug_libusb::on_hotplug, this, &_handle);
+            if (sts != LIBUSB_SUCCESS)
+            {
+                LOG_WARNING("libusb_hotplug_register_callback failed: " << libusb_error_name(sts));
+                libusb_exit(_ctx);
+                _ctx = NULL;
+                return false;
+            }
+
+            _stopping = false;
+            _event_handler = std::thread([this]() {
+                // Callbacks are called from inside the event handling; the timeout lets us notice stop() in time
+                timeval tv = { 0, 100 * 1000 };
+                while (!_stopping)
+                    libusb_handle_events_timeout_completed(_ctx, &tv, NULL);
+            });
+            return true;
+        }
+
+        void usb_hotplug_libusb::stop()
+        {
+            if (!_ctx)
+                return;
+
+            _stopping = true;
+            libusb_hotplug_deregister_callback(_ctx, _handle);
+            if (_event_handler.joinable())
+                _event_handler.join();
+            libusb_exit(_ctx);
+            _ctx = NULL;
+        }
+
+        int LIBUSB_CALL usb_hotplug_libusb::on_hotplug(libusb_context* ctx, libusb_device* device, libusb_hotplug_event event, void* user_data)
+        {
+            auto self = static_cast<usb_hotplug_libusb*>(user_data);
+            if (self->_stopping)
+                return 0;
+
+            usb_hotplug_event e;
+            e.arrived = event == LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED;
+            e.device_path = get_device_path(device);
+            if (e.arrived)
+            {
+                libusb_device_descriptor desc{};
+                auto ret = libusb_get_device_descriptor(device, &desc);
+                if (LIBUSB_SUCCESS == ret)
+                    e.interfaces = get_subdevices(device, desc);
+                else
+                    LOG_WARNING("failed to read USB device descriptor: error = " << std::dec << ret);
+            }
+
+            try
+            {
+                self->_callback(std::move(e));
+            }
+            catch (const std::exception& ex)
+            {
+                LOG_ERROR("USB hotplug callback failed: " << ex.what());
+            }
+            return 0; // Keep the callback registered
+        }
+    }
+}
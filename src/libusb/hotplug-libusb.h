@@ -0,0 +1,37 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "usb/usb-hotplug.h"
+
+#include <atomic>
+#include <thread>
+#include "libusb.h"
+
+namespace librealsense
+{
+    namespace platform
+    {
+        // Hotplug notifications through libusb_hotplug_register_callback(), handled on a dedicated libusb context so
+        // they do not depend on any device being open
+        class usb_hotplug_libusb : public usb_hotplug_source
+        {
+        public:
+            usb_hotplug_libusb();
+            ~usb_hotplug_libusb();
+
+            bool start(usb_hotplug_callback callback) override;
+            void stop() override;
+
+        private:
+            static int LIBUSB_CALL on_hotplug(libusb_context* ctx, libusb_device* device, libusb_hotplug_event event, void* user_data);
+
+            libusb_context* _ctx;
+            libusb_hotplug_callback_handle _handle;
+            usb_hotplug_callback _callback;
+            std::atomic<bool> _stopping;
+            std::thread _event_handler;
+        };
+    }
+}
@@ -3,8 +3,10 @@
 
 #include "rsusb-backend-linux.h"
 #include "types.h"
-#include "../polling-device-watcher.h"
+#include "../hotplug-device-watcher.h"
+#include "../libusb/hotplug-libusb.h"
 #include "../uvc/uvc-device.h"
+#include "../hid/hid-device.h"
 
 namespace librealsense
 {
@@ -17,7 +19,13 @@ namespace librealsense
 
         std::shared_ptr<device_watcher> rs_backend_linux::create_device_watcher() const
         {
-            return std::make_shared<polling_device_watcher>(this);
+            // Falls back to polling by itself if libusb hotplug is not available
+            return std::make_shared<hotplug_device_watcher>(this,
+                std::make_shared<usb_hotplug_libusb>(),
+                [](const std::vector<usb_device_info>& usb_devices) -> backend_device_group
+                {
+                    return { query_uvc_devices_info(usb_devices), usb_devices, query_hid_devices_info(usb_devices) };
+                });
         }
     }
 }
@@ -486,7 +486,7 @@ namespace librealsense
         }
 
         // start capturing and polling.
-        void iio_hid_sensor::start_capture(hid_callback sensor_callback)
+        void iio_hid_sensor::start_capture(hid_batch_callback sensor_callback)
         {
             if (_is_capturing)
                 return;
@@ -541,6 +541,12 @@ namespace librealsense
 
                 std::vector<uint8_t> raw_data(raw_data_size);
                 auto metadata = has_metadata();
+                auto hid_data_size = channel_size - (metadata ? HID_METADATA_SIZE : 0);
+
+                // Everything a batch points to is kept here, and never reallocated
+                std::vector<metadata_hid_raw> meta_data(hid_buf_len);
+                std::vector<frame_object> reports(hid_buf_len);
+                sensor_data_batch batch{ hid_sensor{ get_sensor_name() }, reports.data(), 0 };
 
                 do {
                     fd_set fds;
@@ -550,7 +556,7 @@ namespace librealsense
 
                     int max_fd = std::max(_stop_pipe_fd[0], _fd);
 
-                    ssize_t read_size = 0;
+                    size_t read_size = 0;
                     struct timeval tv = {5, 0};
                     LOG_DEBUG_HID("HID IIO Select initiated");
                     auto val = select(max_fd + 1, &fds, nullptr, nullptr, &tv);
@@ -574,8 +580,16 @@ namespace librealsense
                         }
                         else if (FD_ISSET(_fd, &fds))
                         {
-                            read_size = read(_fd, raw_data.data(), raw_data_size);
-                            if (read_size < 0 )
+                            // Drain everything that is pending (the fd is non-blocking), so all of it is handled in
+                            // one batch rather than a select() per few reports
+                            while (raw_data_size - read_size >= channel_size)
+                            {
+                                auto sz = read(_fd, raw_data.data() + read_size, raw_data_size - read_size);
+                                if (sz <= 0)
+                                    break;
+                                read_size += sz;
+                            }
+                            if (!read_size)
                                 continue;
                         }
                         else
@@ -585,51 +599,36 @@ namespace librealsense
                             continue;
                         }
 
-                        auto sz= read_size / channel_size;
+                        auto sz = read_size / channel_size;
                         if (sz > 2)
                         {
                             LOG_DEBUG("HID: Going to handle " <<  sz << " packets");
                         }
-                        // TODO: code refactoring to reduce latency
-                        for (auto i = 0; i < sz; ++i)
+
+                        auto now_ts = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
+                        for (size_t i = 0; i < sz; ++i)
                         {
-                            auto now_ts = std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
                             auto p_raw_data = raw_data.data() + channel_size * i;
-                            sensor_data sens_data{};
-                            sens_data.sensor = hid_sensor{get_sensor_name()};
 
-                            auto hid_data_size = channel_size - (metadata ? HID_METADATA_SIZE : 0);
                             // Populate HID IMU data - Header
-                            metadata_hid_raw meta_data{};
-                            meta_data.header.report_type = md_hid_report_type::hid_report_imu;
-                            meta_data.header.length = hid_header_size + metadata_imu_report_size;
-                            meta_data.header.timestamp = *(reinterpret_cast<uint64_t *>(&p_raw_data[16]));
-                            // Payload:
-                            meta_data.report_type.imu_report.header.md_type_id = md_type::META_DATA_HID_IMU_REPORT_ID;
-                            meta_data.report_type.imu_report.header.md_size = metadata_imu_report_size;
-//                            meta_data.report_type.imu_report.flags = static_cast<uint8_t>( md_hid_imu_attributes::custom_timestamp_attirbute |
-//                                                                                            md_hid_imu_attributes::imu_counter_attribute |
-//                                                                                            md_hid_imu_attributes::usb_counter_attribute);
-//                            meta_data.report_type.imu_report.custom_timestamp = meta_data.header.timestamp;
-//                            meta_data.report_type.imu_report.imu_counter = p_raw_data[30];
-//                            meta_data.report_type.imu_report.usb_counter = p_raw_data[31];
-
-                            sens_data.fo = {hid_data_size, metadata? meta_data.header.length: uint8_t(0),
-                                            p_raw_data,  metadata? &meta_data : nullptr, now_ts};
+                            auto & md = meta_data[i];
+                            md = {};
+                            md.header.report_type = md_hid_report_type::hid_report_imu;
+                            md.header.length = hid_header_size + metadata_imu_report_size;
+                            md.header.timestamp = *(reinterpret_cast<uint64_t *>(&p_raw_data[16]));
                             //Linux HID provides timestamps in nanosec. Convert to usec (FW default)
-                            if (metadata)
-                            {
-                                //auto* ts_nsec = reinterpret_cast<uint64_t*>(const_cast<void*>(sens_data.fo.metadata));
-                                //*ts_nsec /=1000;
-                                meta_data.header.timestamp /=1000;
-                            }
-
-//                            for (auto i=0ul; i<channel_size; i++)
-//                                std::cout << std::hex << int(p_raw_data[i]) << " ";
-//                            std::cout << std::dec << std::endl;
+                            md.header.timestamp /= 1000;
+                            // Payload:
+                            md.report_type.imu_report.header.md_type_id = md_type::META_DATA_HID_IMU_REPORT_ID;
+                            md.report_type.imu_report.header.md_size = metadata_imu_report_size;
 
-                            this->_callback(sens_data);
+                            reports[i] = { hid_data_size, metadata ? md.header.length : uint8_t(0),
+                                           p_raw_data, metadata ? &md : nullptr, now_ts };
                         }
+
+                        batch.count = sz;
+                        this->_callback(batch);
+
                         if (sz > 2)
                         {
                             LOG_DEBUG("HID: Finished to handle " <<  sz << " packets");
@@ -1114,6 +1113,15 @@ namespace librealsense
         }
 
         void v4l_hid_device::start_capture(hid_callback callback)
+        {
+            start_batch_capture([callback](const sensor_data_batch& batch)
+            {
+                for (size_t i = 0; i < batch.count; ++i)
+                    callback({ batch.sensor, batch.reports[i] });
+            });
+        }
+
+        void v4l_hid_device::start_batch_capture(hid_batch_callback callback)
         {
             for (auto& profile : _hid_profiles)
             {
@@ -1159,11 +1167,17 @@ namespace librealsense
 
             if (!_streaming_custom_sensors.empty())
             {
+                // Custom reports are read one at a time
+                hid_callback report_callback = [callback](const sensor_data& data)
+                {
+                    callback({ data.sensor, &data.fo, 1 });
+                };
+
                 std::vector<hid_custom_sensor*> captured_sensors;
                 try{
                 for (auto& elem : _streaming_custom_sensors)
                 {
-                    elem->start_capture(callback);
+                    elem->start_capture(report_callback);
                     captured_sensors.push_back(elem);
                 }
                 }
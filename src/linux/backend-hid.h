@@ -136,8 +136,8 @@ namespace librealsense
 
             ~iio_hid_sensor();
 
-            // start capturing and polling.
-            void start_capture(hid_callback sensor_callback);
+            // start capturing and polling. All the reports available on each read are delivered as one batch.
+            void start_capture(hid_batch_callback sensor_callback);
 
             void stop_capture();
 
@@ -183,7 +183,7 @@ namespace librealsense
             std::string _sensitivity_name;
             std::list<hid_input*> _inputs;
             std::list<hid_input*> _channels;
-            hid_callback _callback;
+            hid_batch_callback _callback;
             std::atomic<bool> _is_capturing;
             std::unique_ptr<std::thread> _hid_thread;
             std::unique_ptr<std::thread> _pm_thread;    // Delayed initialization due to power-up sequence
@@ -207,6 +207,8 @@ namespace librealsense
 
             void start_capture(hid_callback callback) override;
 
+            void start_batch_capture(hid_batch_callback callback) override;
+
             void stop_capture() override;
 
             std::vector<uint8_t> get_custom_report_data(const std::string& custom_sensor_name,
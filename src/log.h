@@ -3,12 +3,14 @@
 #pragma once
 
 #include "core/enum-helpers.h"
+#include "async-log.h"
 #include <librealsense2/hpp/rs_types.hpp>
 
 #include <rsutils/string/from.h>
 #include <rsutils/easylogging/easyloggingpp.h>
 #include <rsutils/os/ensure-console.h>
 
+#include <algorithm>
 #include <stdexcept>
 #include <mutex>
 #include <fstream>
@@ -55,9 +57,10 @@ namespace librealsense
     template<char const * NAME>
     class logger_type
     {
-        rs2_log_severity minimum_log_severity = RS2_LOG_SEVERITY_NONE;
+        rs2_log_severity minimum_log_severity = RS2_LOG_SEVERITY_NONE;  // of all the below
         rs2_log_severity minimum_console_severity = RS2_LOG_SEVERITY_NONE;
         rs2_log_severity minimum_file_severity = RS2_LOG_SEVERITY_NONE;
+        rs2_log_severity minimum_callback_severity = RS2_LOG_SEVERITY_NONE;
 
         std::mutex log_mutex;
         std::ofstream log_file;
@@ -132,6 +135,13 @@ namespace librealsense
             el::Loggers::reconfigureLogger(log_id, defaultConf);
         }
 
+        // Async logs are not even captured unless some output wants them
+        void update_minimum_severity()
+        {
+            minimum_log_severity = std::min( { minimum_console_severity, minimum_file_severity, minimum_callback_severity } );
+            async_log::set_min_severity( minimum_log_severity );
+        }
+
         void open_def() const
         {
             el::Configurations defaultConf;
@@ -190,6 +200,7 @@ namespace librealsense
             if( min_severity != RS2_LOG_SEVERITY_NONE )
                 rsutils::os::ensure_console( false );  // don't create if none available
             minimum_console_severity = min_severity;
+            update_minimum_severity();
             open();
         }
 
@@ -201,6 +212,7 @@ namespace librealsense
             if (file_path)
                 filename = file_path;
 
+            update_minimum_severity();
             open();
         }
 
@@ -255,6 +267,9 @@ namespace librealsense
                 auto dispatcher = el::Helpers::logDispatchCallback< elpp_dispatcher >( dispatch_name );
                 dispatcher->callback = callback;
                 dispatcher->min_severity = min_severity;
+
+                minimum_callback_severity = std::min( minimum_callback_severity, min_severity );
+                update_minimum_severity();
                 
                 // Remove the default logger (which will log to standard out/err) or it'll still be active
                 //el::Helpers::uninstallLogDispatchCallback< el::base::DefaultLogDispatchCallback >( "DefaultLogDispatchCallback" );
@@ -272,6 +287,8 @@ namespace librealsense
             minimum_log_severity = RS2_LOG_SEVERITY_NONE;
             minimum_console_severity = RS2_LOG_SEVERITY_NONE;
             minimum_file_severity = RS2_LOG_SEVERITY_NONE;
+            minimum_callback_severity = RS2_LOG_SEVERITY_NONE;
+            update_minimum_severity();
         }
 
         // Callback: called by EL++ when the current log file has reached a certain maximum size.
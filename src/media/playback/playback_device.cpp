@@ -136,6 +136,7 @@ std::map<uint32_t, std::shared_ptr<playback_sensor>> playback_device::create_pla
         {
             (*m_read_thread)->invoke([this, filters](dispatcher::cancellable_timer c)
             {
+                stop_read_ahead();
                 m_reader->enable_stream(filters);
             });
         } );
@@ -144,6 +145,7 @@ std::map<uint32_t, std::shared_ptr<playback_sensor>> playback_device::create_pla
         {
             (*m_read_thread)->invoke([this, filters](dispatcher::cancellable_timer c)
             {
+                stop_read_ahead();
                 m_reader->disable_stream(filters);
             });
         } );
@@ -281,6 +283,7 @@ void playback_device::seek_to_time(std::chrono::nanoseconds time)
     (*m_read_thread)->invoke([this, time](dispatcher::cancellable_timer t)
     {
         LOG_INFO("Seek to time: " << time.count());
+        discard_read_ahead();
         m_reader->seek_to_time(time);
         m_device_description = m_reader->query_device_description(time);
         update_extensions(m_device_description);
@@ -382,6 +385,7 @@ void playback_device::resume()
         auto total_duration = m_reader->query_duration();
         if (m_last_published_timestamp >= total_duration)
             m_last_published_timestamp = device_serializer::nanoseconds(0);
+        discard_read_ahead();
         m_reader->reset();
         m_reader->seek_to_time(m_last_published_timestamp);
         while (m_last_published_timestamp != device_serializer::nanoseconds(0) && !m_reader->read_next_data()->is<serialized_frame>());
@@ -513,6 +517,7 @@ void playback_device::stop_internal()
     m_is_started = false;
     m_is_paused = false;
 
+    discard_read_ahead();
     m_reader->reset();
     m_prev_timestamp = std::chrono::nanoseconds(0);
     catch_up();
@@ -584,6 +589,43 @@ bool playback_device::prefetch_done()
     return false;
 }
 
+// Called from the read thread
+// When not in real time, the data is read ahead, and frames decoded in parallel, so playback is not limited by
+// reading and decoding one frame at a time. Only RVL depth frames are decoded in parallel so far: see
+// playback_read_ahead.
+std::shared_ptr<serialized_data> playback_device::read_next_data()
+{
+    if (m_read_ahead)
+    {
+        // Back in real time, or reading ahead was stopped: what was already read is played first
+        if (m_real_time)
+            m_read_ahead->stop();
+        if (auto data = m_read_ahead->next())
+            return data;
+        m_read_ahead.reset();
+    }
+    if (m_real_time)
+        return m_reader->read_next_data();
+
+    auto const cores = std::max(std::thread::hardware_concurrency(), 2u);
+    m_read_ahead.reset(new playback_read_ahead(m_reader, 8, std::min(cores - 1, 4u)));
+    return m_read_ahead->next();
+}
+
+// Called from the read thread, before the reader is used other than to read the next data
+void playback_device::discard_read_ahead()
+{
+    m_read_ahead.reset();
+}
+
+// Called from the read thread, before the streams read change: what was already read is still played, and reading
+// ahead starts over once it was
+void playback_device::stop_read_ahead()
+{
+    if (m_read_ahead)
+        m_read_ahead->stop();
+}
+
 void playback_device::try_looping()
 {
     //try_looping is called from start() or resume()
@@ -606,7 +648,7 @@ void playback_device::try_looping()
 
         //Read next data from the serializer, on success: 'obj' will be a valid object that came from
         // sensor number 'sensor_index' with a timestamp equal to 'timestamp'
-        std::shared_ptr<serialized_data> data = m_reader->read_next_data();
+        std::shared_ptr<serialized_data> data = read_next_data();
         if (data->as<serialized_end_of_file>())
         {
             LOG_INFO("End of file reached");
@@ -639,6 +681,7 @@ void playback_device::try_looping()
 
         if (auto frame = data->as<serialized_frame>())
         {
+            frame->finish();
             frame->frame.frame->set_blocking(!m_real_time);
             if (frame->stream_id.device_index != get_device_index() || frame->stream_id.sensor_index >= m_sensors.size())
             {
@@ -10,6 +10,7 @@
 #include "../../archive.h"
 #include "../../sensor.h"
 #include "playback_sensor.h"
+#include "playback_read_ahead.h"
 
 #include <rsutils/lazy.h>
 #include <rsutils/signal.h>
@@ -77,11 +78,15 @@ namespace librealsense
         void register_extrinsics(const device_serializer::device_snapshot& device_description);
         void update_extensions(const device_serializer::device_snapshot& device_description);
         bool prefetch_done();
+        std::shared_ptr<device_serializer::serialized_data> read_next_data();
+        void discard_read_ahead();
+        void stop_read_ahead();
 
     private:
         rsutils::lazy< std::shared_ptr< dispatcher > > m_read_thread;
         std::shared_ptr< const device_info > m_device_info;
         std::shared_ptr<device_serializer::reader> m_reader;
+        std::unique_ptr<playback_read_ahead> m_read_ahead; // !< Reads ahead of the read thread when not in real time
         device_serializer::device_snapshot m_device_description;
         std::atomic_bool m_is_started;
         std::atomic_bool m_is_paused;
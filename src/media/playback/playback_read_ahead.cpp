@@ -0,0 +1,167 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "playback_read_ahead.h"
+
+#include <algorithm>
+
+
+namespace librealsense
+{
+    using namespace device_serializer;
+
+    playback_read_ahead::playback_read_ahead(std::shared_ptr<device_serializer::reader> reader, size_t capacity, size_t max_workers)
+        : _reader(std::move(reader))
+        , _max_workers(std::max<size_t>(max_workers, 1))
+        , _buffer(std::max<size_t>(capacity, 1))
+    {
+        _read_thread = std::thread([this]() { read(); });
+        LOG_DEBUG("Playback reading ahead " << _buffer.size() << " with up to " << _max_workers << " workers");
+    }
+
+    playback_read_ahead::~playback_read_ahead()
+    {
+        stop();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _decode_cv.notify_all();
+        for (auto&& worker : _workers)
+            worker.join();
+    }
+
+    void playback_read_ahead::stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _reading = false;
+        }
+        _read_cv.notify_all();
+        if (_read_thread.joinable())
+            _read_thread.join();
+        _out_cv.notify_all();
+    }
+
+    size_t playback_read_ahead::workers() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _workers.size();
+    }
+
+    std::shared_ptr<serialized_data> playback_read_ahead::next()
+    {
+        slot out;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _out_cv.wait(lock, [this]()
+            {
+                if (_next_out != _next_read)
+                    return at(_next_out).ready;
+                return !_reading;
+            });
+            if (_next_out == _next_read)
+                return nullptr;
+            out = std::move(at(_next_out));
+            at(_next_out) = slot();
+            ++_next_out;
+        }
+        _read_cv.notify_one();
+        if (out.error)
+            std::rethrow_exception(out.error);
+        return out.data;
+    }
+
+    void playback_read_ahead::read()
+    {
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _read_cv.wait(lock, [this]() { return !_reading || _next_read - _next_out < _buffer.size(); });
+                if (!_reading)
+                    return;
+            }
+
+            // Outside the lock, so what was read before is handed out meanwhile
+            std::shared_ptr<serialized_data> data;
+            std::exception_ptr error;
+            try
+            {
+                data = _reader->read_next_data();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            bool const last = error || !data || data->is<serialized_end_of_file>();
+            auto frame = data ? data->as<serialized_frame>() : nullptr;
+            bool const pending = frame && frame->pending;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto& s = at(_next_read);
+                s.data = std::move(data);
+                s.error = error;
+                s.ready = !pending;
+                if (pending)
+                    _to_decode.push_back(_next_read);
+                ++_next_read;
+                if (last)
+                    _reading = false;
+            }
+            if (pending)
+            {
+                if (_workers.empty())
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    for (size_t i = 0; i < _max_workers; ++i)
+                        _workers.emplace_back([this]() { decode(); });
+                }
+                _decode_cv.notify_one();
+            }
+            else
+                _out_cv.notify_one();
+            if (last)
+                return;
+        }
+    }
+
+    void playback_read_ahead::decode()
+    {
+        while (true)
+        {
+            uint64_t sequence;
+            std::shared_ptr<serialized_frame> frame;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _decode_cv.wait(lock, [this]() { return _stopping || !_to_decode.empty(); });
+                if (_stopping)
+                    return;
+                sequence = _to_decode.front();
+                _to_decode.pop_front();
+                frame = at(sequence).data->as<serialized_frame>();
+            }
+
+            // The slot is not handed out, or reused, until it is ready
+            std::exception_ptr error;
+            try
+            {
+                frame->finish();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                auto& s = at(sequence);
+                s.error = error;
+                s.ready = true;
+            }
+            // Workers finish out of order: whoever waits for the next data checks whether this was it
+            _out_cv.notify_all();
+        }
+    }
+}
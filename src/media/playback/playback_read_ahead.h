@@ -0,0 +1,72 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+#include "../../core/serialization.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace librealsense
+{
+    // Reads a recording ahead of playback, for when it is not played in real time: one thread reads the file (which
+    // cannot be read from more than one) while workers finish the frames it read (decompress them), and the data is
+    // handed out in the order it was read. Reading, decoding and dispatching to the sensors all overlap, so playback
+    // goes as fast as the slowest of them rather than their sum.
+    //
+    // Only frames the reader left work pending on are decoded by the workers, and today those are only RVL-compressed
+    // depth frames. Everything else (message deserialization, bag chunk decompression) is done by the read thread,
+    // so other recordings are still bound by how fast one thread parses them. The workers are started with the first
+    // frame that has work pending, so none are left idle for those.
+    //
+    // Frames read ahead are taken from the reader's frame pool: 'capacity' must leave enough of it to the frames that
+    // are being played.
+    class playback_read_ahead
+    {
+    public:
+        playback_read_ahead(std::shared_ptr<device_serializer::reader> reader, size_t capacity, size_t max_workers);
+        ~playback_read_ahead();
+
+        // The next data read, in order, once it is finished; throws what reading it threw. After stop(), returns
+        // whatever was read until then and then nullptr. After the end of the file is returned, there is no more.
+        std::shared_ptr<device_serializer::serialized_data> next();
+
+        // Stops reading: the reader is no longer used once this returns
+        void stop();
+
+        // How many workers were started so far
+        size_t workers() const;
+
+    private:
+        struct slot
+        {
+            std::shared_ptr<device_serializer::serialized_data> data;
+            std::exception_ptr error;
+            bool ready = false;
+        };
+
+        void read();
+        void decode();
+        slot& at(uint64_t sequence) { return _buffer[sequence % _buffer.size()]; }
+
+        std::shared_ptr<device_serializer::reader> _reader;
+        size_t const _max_workers;
+        std::vector<slot> _buffer;  // a ring of what was read and not yet handed out, by sequence
+        uint64_t _next_out = 0;     // the sequence of the next data handed out
+        uint64_t _next_read = 0;    // ... read
+        std::deque<uint64_t> _to_decode;  // read, with work pending, that no worker took yet
+        bool _reading = true;
+        bool _stopping = false;
+        mutable std::mutex _mutex;
+        std::condition_variable _read_cv;    // signaled when there is room to read into
+        std::condition_variable _decode_cv;  // ... a frame to decode
+        std::condition_variable _out_cv;     // ... the next data is ready
+        std::thread _read_thread;
+        std::vector<std::thread> _workers;  // only added to by the read thread, while it runs
+    };
+}
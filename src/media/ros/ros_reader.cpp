@@ -10,6 +10,7 @@
 #include <src/core/motion-frame.h>
 #include <src/core/video-frame.h>
 #include <src/color-sensor.h>
+#include <src/proc/rvl-codec.h>
 
 #include <rsutils/string/from.h>
 #include <cstring>
@@ -140,6 +141,7 @@ namespace librealsense
             rosbag::View view(m_file, rosbag::TopicQuery(topic), kvp.second, kvp.second);
             auto msg = view.begin();
             auto new_frame = create_frame(*msg);
+            new_frame->finish();
             result.push_back(new_frame);
         }
         return result;
@@ -260,9 +262,10 @@ namespace librealsense
             stream_id = ros_topic::get_stream_identifier(next_msg_topic);
         }
         frame_holder frame{ nullptr };
+        std::function<void()> pending;
         if (msg.isType<sensor_msgs::Image>())
         {
-            frame = create_image_from_message(msg);
+            frame = create_image_from_message(msg, pending);
         }
         else if (msg.isType<sensor_msgs::Imu>())
         {
@@ -284,7 +287,9 @@ namespace librealsense
         {
             return std::make_shared<serialized_invalid_frame>(timestamp, stream_id);
         }
-        return std::make_shared<serialized_frame>(timestamp, stream_id, std::move(frame));
+        auto result = std::make_shared<serialized_frame>(timestamp, stream_id, std::move(frame));
+        result->pending = std::move(pending);
+        return result;
     }
 
     nanoseconds ros_reader::get_file_duration(const rosbag::Bag& file, uint32_t version)
@@ -405,7 +410,7 @@ namespace librealsense
         return remaining;
     }
 
-    frame_holder ros_reader::create_image_from_message(const rosbag::MessageInstance &image_data) const
+    frame_holder ros_reader::create_image_from_message(const rosbag::MessageInstance &image_data, std::function<void()>& pending) const
     {
         LOG_DEBUG("Trying to create an image frame from message");
         auto msg = instantiate_msg<sensor_msgs::Image>(image_data);
@@ -434,9 +439,15 @@ namespace librealsense
             get_frame_metadata(m_file, info_topic, stream_id, image_data, additional_data);
         }
 
+        rs2_format stream_format;
+        convert(msg->encoding, stream_format);
+        // Compressed depth is played back as the Z16 it was compressed from
+        bool const compressed = stream_format == RS2_FORMAT_Z16RVL;
+        size_t const pixels = size_t( msg->width ) * msg->height;
+
         frame_interface * frame = m_frame_source->alloc_frame(
             { stream_id.stream_type, stream_id.stream_index, frame_source::stream_to_frame_types( stream_id.stream_type ) },
-            msg->data.size(),
+            compressed ? pixels * sizeof( uint16_t ) : msg->data.size(),
             std::move( additional_data ),
             true );
 
@@ -447,14 +458,24 @@ namespace librealsense
         }
         librealsense::video_frame* video_frame = static_cast<librealsense::video_frame*>(frame);
         video_frame->assign(msg->width, msg->height, msg->step, msg->step / msg->width * 8);
-        rs2_format stream_format;
-        convert(msg->encoding, stream_format);
+        if (compressed)
+        {
+            stream_format = RS2_FORMAT_Z16;
+            video_frame->data.resize(pixels * sizeof(uint16_t));
+            // Decompressing is most of the work of reading the frame: it is left for the player to do, after the
+            // message is read, so it can be done in parallel with reading the next ones
+            pending = [msg, video_frame, pixels]()
+            {
+                rvl::decompress(msg->data.data(), msg->data.size(), reinterpret_cast<uint16_t*>(video_frame->data.data()), pixels);
+            };
+        }
+        else
+            video_frame->data = std::move(msg->data);
         //attaching a temp stream to the frame. Playback sensor should assign the real stream
         frame->set_stream( std::make_shared< video_stream_profile >() );
         frame->get_stream()->set_format(stream_format);
         frame->get_stream()->set_stream_index(int(stream_id.stream_index));
         frame->get_stream()->set_stream_type(stream_id.stream_type);
-        video_frame->data = std::move(msg->data);
         librealsense::frame_holder fh{ video_frame };
         LOG_DEBUG("Created image frame: " << stream_id << " " << video_frame->get_width() << "x" << video_frame->get_height() << " " << stream_format);
 
@@ -78,7 +78,7 @@ namespace librealsense
             const device_serializer::stream_identifier& stream_id,
             const rosbag::MessageInstance &msg,
             frame_additional_data& additional_data);
-        frame_holder create_image_from_message(const rosbag::MessageInstance &image_data) const;
+        frame_holder create_image_from_message(const rosbag::MessageInstance &image_data, std::function<void()>& pending) const;
         frame_holder create_motion_sample(const rosbag::MessageInstance &motion_data) const;
         static inline float3 to_float3(const geometry_msgs::Vector3& v);
         static inline float4 to_float4(const geometry_msgs::Quaternion& q);
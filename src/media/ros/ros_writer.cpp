@@ -9,6 +9,7 @@
 #include "proc/hole-filling-filter.h"
 #include "proc/hdr-merge.h"
 #include "proc/sequence-id-filter.h"
+#include "proc/rvl-codec.h"
 #include "ros_writer.h"
 #include "core/pose-frame.h"
 #include "core/motion-frame.h"
@@ -21,9 +22,11 @@ namespace librealsense
 {
     using namespace device_serializer;
 
-    ros_writer::ros_writer(const std::string& file, bool compress_while_record) : m_file_path(file)
+    ros_writer::ros_writer(const std::string& file, bool compress_while_record, bool compress_depth)
+        : m_file_path(file), m_compress_depth(compress_depth)
     {
-        LOG_INFO("Compression while record is set to " << (compress_while_record ? "ON" : "OFF"));
+        LOG_INFO("Compression while record is set to " << (compress_while_record ? "ON" : "OFF")
+                 << ", depth compression to " << (compress_depth ? "ON" : "OFF"));
         m_bag.open(file, rosbag::BagMode::Write);
         if (compress_while_record)
         {
@@ -183,16 +186,28 @@ namespace librealsense
         image.width = static_cast<uint32_t>(vid_frame->get_width());
         image.height = static_cast<uint32_t>(vid_frame->get_height());
         image.step = static_cast<uint32_t>(vid_frame->get_stride());
-        convert(vid_frame->get_stream()->get_format(), image.encoding);
+        auto format = vid_frame->get_stream()->get_format();
         image.is_bigendian = is_big_endian();
-        auto size = vid_frame->get_stride() * vid_frame->get_height();
         auto p_data = vid_frame->get_frame_data();
-        image.data.assign(p_data, p_data + size);
+        auto df = dynamic_cast<librealsense::depth_frame*>(frame.frame);
+        if (df && m_compress_depth && format == RS2_FORMAT_Z16 && image.step == image.width * sizeof(uint16_t))
+        {
+            // The step is of the depth the image decompresses to
+            format = RS2_FORMAT_Z16RVL;
+            size_t pixels = size_t(image.width) * image.height;
+            image.data.resize(rvl::max_compressed_size(pixels));
+            image.data.resize(rvl::compress(reinterpret_cast<const uint16_t*>(p_data), pixels, image.data.data()));
+        }
+        else
+        {
+            auto size = vid_frame->get_stride() * vid_frame->get_height();
+            image.data.assign(p_data, p_data + size);
+        }
+        convert(format, image.encoding);
         image.header.seq = static_cast<uint32_t>(vid_frame->get_frame_number());
         std::chrono::duration<double, std::milli> timestamp_ms(vid_frame->get_frame_timestamp());
         image.header.stamp = rs2rosinternal::Time(std::chrono::duration<double>(timestamp_ms).count());
         image.header.version = "1"; // the field is unused and therefore assigned for ROSbag versions control
-        auto df = dynamic_cast<librealsense::depth_frame*>(frame.frame);
         if(df)
             image.depth_units = df->get_units();
         auto image_topic = ros_topic::frame_data_topic(stream_id);
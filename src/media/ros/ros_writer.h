@@ -17,7 +17,9 @@ namespace librealsense
     class ros_writer: public writer
     {
     public:
-        explicit ros_writer(const std::string& file, bool compress_while_record);
+        // With compress_depth, Z16 depth images are written RVL-compressed (RS2_FORMAT_Z16RVL), which ros_reader
+        // decompresses on playback
+        ros_writer(const std::string& file, bool compress_while_record, bool compress_depth = false);
         void write_device_description(const librealsense::device_snapshot& device_description) override;
         void write_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame) override;
         void write_snapshot(uint32_t device_index, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) override;
@@ -81,6 +83,7 @@ namespace librealsense
         std::map<stream_identifier, geometry_msgs::Transform> m_extrinsics_msgs;
         std::string m_file_path;
         rosbag::Bag m_bag;
+        bool m_compress_depth;
         std::map<uint32_t, std::set<rs2_option>> m_written_options_descriptions;
     };
 }
@@ -11,9 +11,61 @@ namespace librealsense
 {
     namespace pipeline
     {
-        aggregator::aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync) :
+        frame_mailbox::~frame_mailbox()
+        {
+            frame_holder last(_slot.exchange(nullptr));
+        }
+
+        void frame_mailbox::put(frame_holder frame)
+        {
+            if (!_accepting)
+                return;
+            frame_holder overwritten(_slot.exchange(frame.frame));
+            frame.frame = nullptr;
+
+            // A consumer that did not see the frame is already waiting, once we have the mutex
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+            }
+            _cv.notify_one();
+        }
+
+        bool frame_mailbox::take(frame_holder* frame)
+        {
+            auto f = _slot.exchange(nullptr);
+            if (!f)
+                return false;
+            *frame = frame_holder(f);
+            return true;
+        }
+
+        bool frame_mailbox::wait(frame_holder* frame, unsigned int timeout_ms)
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                [this]() { return !_accepting || _slot.load() != nullptr; });
+            return _accepting && take(frame);
+        }
+
+        void frame_mailbox::start()
+        {
+            _accepting = true;
+        }
+
+        void frame_mailbox::stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _accepting = false;
+            }
+            frame_holder last(_slot.exchange(nullptr));
+            _cv.notify_all();
+        }
+
+        aggregator::aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync, bool latest_only) :
             processing_block("aggregator"),
             _queue(new single_consumer_frame_queue<frame_holder>(1)),
+            _latest(latest_only ? new frame_mailbox() : nullptr),
             _streams_to_aggregate_ids(streams_to_aggregate),
             _streams_to_sync_ids(streams_to_sync),
             _accepting(true)
@@ -75,7 +127,7 @@ namespace librealsense
                 source->frame_ready(async_fref.clone());
 
                 // for sync pipeline usage - push the aggregated to the output queue
-                _queue->enqueue(sync_fref.clone());
+                publish(sync_fref.clone());
             }
             else
             {
@@ -95,30 +147,46 @@ namespace librealsense
                         return;
                     }
                     // for sync pipeline usage - push the aggregated to the output queue
-                    _queue->enqueue(sync_fref.clone());
+                    publish(sync_fref.clone());
                 }
             }
         }
 
+        void aggregator::publish(frame_holder frame)
+        {
+            if (_latest)
+                _latest->put(std::move(frame));
+            else
+                _queue->enqueue(std::move(frame));
+        }
+
         bool aggregator::dequeue(frame_holder* item, unsigned int timeout_ms)
         {
+            if (_latest)
+                return _latest->wait(item, timeout_ms);
             return _queue->dequeue(item, timeout_ms);
         }
 
         bool aggregator::try_dequeue(frame_holder* item)
         {
+            if (_latest)
+                return _latest->take(item);
             return _queue->try_dequeue(item);
         }
 
         void aggregator::start()
         {
             _accepting = true;
+            if (_latest)
+                _latest->start();
         }
 
         void aggregator::stop()
         {
             _accepting = false;
             _queue->stop();
+            if (_latest)
+                _latest->stop();
         }
     }
 }
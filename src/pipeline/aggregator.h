@@ -9,6 +9,7 @@
 #include <map>
 #include <mutex>
 #include <atomic>
+#include <condition_variable>
 
 
 namespace librealsense
@@ -18,17 +19,43 @@ namespace librealsense
 
     namespace pipeline
     {
+        // A single frame, which the next one overwrites: the producer never waits, and the consumer always gets the
+        // latest. An overwritten frame is released right away, so its buffer is back in its pool.
+        // The slot itself is an atomic pointer; the mutex is only for a consumer to wait on.
+        class frame_mailbox
+        {
+        public:
+            ~frame_mailbox();
+
+            void put(frame_holder frame);
+            bool take(frame_holder* frame);
+            bool wait(frame_holder* frame, unsigned int timeout_ms);
+
+            void start();
+            void stop();
+
+        private:
+            std::atomic<frame_interface*> _slot{ nullptr };
+            std::atomic<bool> _accepting{ true };
+            std::mutex _mutex;
+            std::condition_variable _cv;
+        };
+
         class aggregator : public processing_block
         {
             std::mutex _mutex;
             std::map<int /*stream_id*/, frame_holder> _last_set;
             std::unique_ptr<single_consumer_frame_queue<frame_holder>> _queue;
+            std::unique_ptr<frame_mailbox> _latest;  // instead of the queue, when only the latest frames are wanted
             std::vector<int> _streams_to_aggregate_ids;
             std::vector<int> _streams_to_sync_ids;
             std::atomic<bool> _accepting;
             void handle_frame(frame_holder frame, synthetic_source_interface* source);
+            void publish(frame_holder frame);
         public:
-            aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync);
+            // With latest_only, a frameset that was not dequeued yet is replaced by the next, even when it would
+            // otherwise block (as in non-real-time playback)
+            aggregator(const std::vector<int>& streams_to_aggregate, const std::vector<int>& streams_to_sync, bool latest_only = false);
             bool dequeue(frame_holder* item, unsigned int timeout_ms);
             bool try_dequeue(frame_holder* item);
             void start();
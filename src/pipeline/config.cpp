@@ -331,6 +331,12 @@ namespace librealsense
             return default_profiles;
         }
 
+        void config::enable_latest_frames_only(bool enable)
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _latest_frames_only = enable;
+        }
+
         bool config::get_repeat_playback() {
             return _playback_loop;
         }
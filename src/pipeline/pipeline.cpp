@@ -91,7 +91,7 @@ namespace librealsense
             if (!profile->_multistream.get_profiles().size())
                 throw librealsense::wrong_api_call_sequence_exception("No streams are selected!");
 
-            auto synced_streams_ids = on_start(profile);
+            auto synced_streams_ids = on_start(profile, conf->get_latest_frames_only());
 
             rs2_frame_callback_sptr callbacks = get_callback(synced_streams_ids);
 
@@ -173,7 +173,7 @@ namespace librealsense
             return _ctx;
         }
 
-        std::vector<int> pipeline::on_start(std::shared_ptr<profile> profile)
+        std::vector<int> pipeline::on_start(std::shared_ptr<profile> profile, bool latest_frames_only)
         {
             std::vector<int> _streams_to_aggregate_ids;
             std::vector<int> _streams_to_sync_ids;
@@ -192,7 +192,7 @@ namespace librealsense
             }
 
             _syncer = std::unique_ptr<syncer_process_unit>(new syncer_process_unit());
-            _aggregator = std::unique_ptr<aggregator>(new aggregator(_streams_to_aggregate_ids, _streams_to_sync_ids));
+            _aggregator = std::unique_ptr<aggregator>(new aggregator(_streams_to_aggregate_ids, _streams_to_sync_ids, latest_frames_only));
 
             if (_streams_callback)
                 _aggregator->set_output_callback(_streams_callback);
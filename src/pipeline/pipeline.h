@@ -39,7 +39,7 @@ namespace librealsense
 
         protected:
             rs2_frame_callback_sptr get_callback(std::vector<int> unique_ids);
-            std::vector<int> on_start(std::shared_ptr<profile> profile);
+            std::vector<int> on_start(std::shared_ptr<profile> profile, bool latest_frames_only);
 
             void unsafe_start(std::shared_ptr<config> conf);
             void unsafe_stop();
@@ -56,6 +56,18 @@ struct hid_sensor_data
 typedef std::function< void( const sensor_data & ) > hid_callback;
 
 
+// Consecutive reports from a single sensor, as read from the device in one go
+struct sensor_data_batch
+{
+    hid_sensor sensor;
+    const frame_object * reports;
+    size_t count;
+};
+
+
+typedef std::function< void( const sensor_data_batch & ) > hid_batch_callback;
+
+
 enum custom_sensor_report_field
 {
     minimum,
@@ -78,6 +90,16 @@ public:
     virtual void close() = 0;
     virtual void stop_capture() = 0;
     virtual void start_capture( hid_callback callback ) = 0;
+
+    // Same as start_capture(), but all the reports available when the device is read are delivered together. Backends
+    // that cannot read more than one report at a time deliver batches of one.
+    virtual void start_batch_capture( hid_batch_callback callback )
+    {
+        start_capture( [callback]( const sensor_data & data ) {
+            callback( { data.sensor, &data.fo, 1 } );
+        } );
+    }
+
     virtual std::vector< hid_sensor > get_sensors() = 0;
     virtual std::vector< uint8_t > get_custom_report_data( const std::string & custom_sensor_name,
                                                            const std::string & report_name,
@@ -107,6 +129,8 @@ public:
 
     void start_capture( hid_callback callback ) override { _dev.front()->start_capture( callback ); }
 
+    void start_batch_capture( hid_batch_callback callback ) override { _dev.front()->start_batch_capture( callback ); }
+
     std::vector< hid_sensor > get_sensors() override { return _dev.front()->get_sensors(); }
 
     explicit multi_pins_hid_device( const std::vector< std::shared_ptr< hid_device > > & dev )
@@ -8,6 +8,8 @@
 #include "librealsense-exception.h"
 #include <fstream>
 #include <cmath>
+#include <cstring>
+#include <memory>
 
 #define MIN_DISTANCE 1e-6
 
@@ -20,22 +22,45 @@ float3 * points::get_vertices()
     return xyz;
 }
 
-std::tuple< uint8_t, uint8_t, uint8_t >
-get_texcolor( const frame_holder & texture, float u, float v )
+namespace {
+
+// Resolves the texture once per export, rather than once per vertex
+class texture_sampler
 {
-    auto ptr = dynamic_cast< video_frame * >( texture.frame );
-    if( ptr == nullptr )
+    const uint8_t * _data;
+    int _width, _height, _bytes_per_pixel, _stride;
+
+public:
+    texture_sampler( const frame_holder & texture )
+    {
+        auto ptr = dynamic_cast< video_frame * >( texture.frame );
+        if( ptr == nullptr )
+            throw librealsense::invalid_value_exception( "frame must be video frame" );
+        _width = ptr->get_width();
+        _height = ptr->get_height();
+        _bytes_per_pixel = ptr->get_bpp() / 8;
+        _stride = ptr->get_stride();
+        _data = reinterpret_cast< const uint8_t * >( ptr->get_frame_data() );
+    }
+
+    const uint8_t * at( float u, float v ) const
     {
-        throw librealsense::invalid_value_exception( "frame must be video frame" );
+        int x = std::min( std::max( int( u * _width + .5f ), 0 ), _width - 1 );
+        int y = std::min( std::max( int( v * _height + .5f ), 0 ), _height - 1 );
+        return _data + x * _bytes_per_pixel + y * _stride;
     }
-    const int w = ptr->get_width(), h = ptr->get_height();
-    int x = std::min( std::max( int( u * w + .5f ), 0 ), w - 1 );
-    int y = std::min( std::max( int( v * h + .5f ), 0 ), h - 1 );
-    int idx = x * ptr->get_bpp() / 8 + y * ptr->get_stride();
-    const auto texture_data = reinterpret_cast< const uint8_t * >( ptr->get_frame_data() );
-    return std::make_tuple( texture_data[idx], texture_data[idx + 1], texture_data[idx + 2] );
+};
+
+template< class T >
+char * put( char * out, T const & value )
+{
+    // we assume little endian architecture on your device
+    memcpy( out, &value, sizeof( T ) );
+    return out + sizeof( T );
 }
 
+}  // namespace
+
 
 void points::export_to_ply( const std::string & fname, const frame_holder & texture )
 {
@@ -45,32 +70,47 @@ void points::export_to_ply( const std::string & fname, const frame_holder & text
         throw librealsense::invalid_value_exception( "stream must be video stream" );
     const auto vertices = get_vertices();
     const auto texcoords = get_texture_coordinates();
-    std::vector< float3 > new_vertices;
-    std::vector< std::tuple< uint8_t, uint8_t, uint8_t > > new_tex;
-    std::map< int, int > index2reducedIndex;
-
-    new_vertices.reserve( get_vertex_count() );
-    new_tex.reserve( get_vertex_count() );
-    assert( get_vertex_count() );
-    for( int i = 0; i < get_vertex_count(); ++i )
+    const auto vertex_count = get_vertex_count();
+    assert( vertex_count );
+
+    std::unique_ptr< texture_sampler > sampler;
+    if( texture )
+        sampler.reset( new texture_sampler( texture ) );
+
+    // Vertices are packed as they will appear in the file, in a single pass that also skips invalid
+    // points and samples the texture; the whole block is then written at once
+    const size_t vertex_size = 3 * sizeof( float ) + ( sampler ? 3 : 0 );
+    std::vector< char > vertex_data( vertex_count * vertex_size );
+    std::vector< int > index2reducedIndex( vertex_count, -1 );
+    char * out_vertex = vertex_data.data();
+    int valid_vertices = 0;
+    for( size_t i = 0; i < vertex_count; ++i )
         if( fabs( vertices[i].x ) >= MIN_DISTANCE || fabs( vertices[i].y ) >= MIN_DISTANCE
             || fabs( vertices[i].z ) >= MIN_DISTANCE )
         {
-            index2reducedIndex[i] = (int)new_vertices.size();
-            new_vertices.push_back( { vertices[i].x, -1 * vertices[i].y, -1 * vertices[i].z } );
-            if( texture )
+            index2reducedIndex[i] = valid_vertices++;
+            out_vertex = put( out_vertex, vertices[i].x );
+            out_vertex = put( out_vertex, -1 * vertices[i].y );
+            out_vertex = put( out_vertex, -1 * vertices[i].z );
+            if( sampler )
             {
-                auto color = get_texcolor( texture, texcoords[i].x, texcoords[i].y );
-                new_tex.push_back( color );
+                memcpy( out_vertex, sampler->at( texcoords[i].x, texcoords[i].y ), 3 );
+                out_vertex += 3;
             }
         }
 
     const auto threshold = 0.05f;
-    auto width = video_stream_profile->get_width();
-    std::vector< std::tuple< int, int, int > > faces;
-    for( uint32_t x = 0; x < width - 1; ++x )
+    const uint32_t width = video_stream_profile->get_width();
+    const uint32_t height = video_stream_profile->get_height();
+    const size_t face_size = sizeof( uint8_t ) + 3 * sizeof( int );
+    std::vector< char > face_data;
+    if( width > 1 && height > 1 )
+        face_data.resize( size_t( width - 1 ) * ( height - 1 ) * 2 * face_size );
+    char * out_face = face_data.data();
+    size_t faces = 0;
+    for( uint32_t x = 0; x + 1 < width; ++x )
     {
-        for( uint32_t y = 0; y < video_stream_profile->get_height() - 1; ++y )
+        for( uint32_t y = 0; y + 1 < height; ++y )
         {
             auto a = y * width + x, b = y * width + x + 1, c = ( y + 1 ) * width + x,
                  d = ( y + 1 ) * width + x + 1;
@@ -80,68 +120,46 @@ void points::export_to_ply( const std::string & fname, const frame_holder & text
                 && std::abs( vertices[b].z - vertices[d].z ) < threshold
                 && std::abs( vertices[c].z - vertices[d].z ) < threshold )
             {
-                if( index2reducedIndex.count( a ) == 0 || index2reducedIndex.count( b ) == 0
-                    || index2reducedIndex.count( c ) == 0 || index2reducedIndex.count( d ) == 0 )
+                auto ra = index2reducedIndex[a], rb = index2reducedIndex[b], rc = index2reducedIndex[c],
+                     rd = index2reducedIndex[d];
+                if( ra < 0 || rb < 0 || rc < 0 || rd < 0 )
                     continue;
 
-                faces.emplace_back( index2reducedIndex[a],
-                                    index2reducedIndex[d],
-                                    index2reducedIndex[b] );
-                faces.emplace_back( index2reducedIndex[d],
-                                    index2reducedIndex[a],
-                                    index2reducedIndex[c] );
+                out_face = put( out_face, uint8_t( 3 ) );
+                out_face = put( out_face, ra );
+                out_face = put( out_face, rd );
+                out_face = put( out_face, rb );
+                out_face = put( out_face, uint8_t( 3 ) );
+                out_face = put( out_face, rd );
+                out_face = put( out_face, ra );
+                out_face = put( out_face, rc );
+                faces += 2;
             }
         }
     }
 
-    std::ofstream out( fname );
+    std::ofstream out( fname, std::ios_base::binary );
     out << "ply\n";
     out << "format binary_little_endian 1.0\n";
     out << "comment pointcloud saved from Realsense Viewer\n";
-    out << "element vertex " << new_vertices.size() << "\n";
+    out << "element vertex " << valid_vertices << "\n";
     out << "property float" << sizeof( float ) * 8 << " x\n";
     out << "property float" << sizeof( float ) * 8 << " y\n";
     out << "property float" << sizeof( float ) * 8 << " z\n";
-    if( texture )
+    if( sampler )
     {
         out << "property uchar red\n";
         out << "property uchar green\n";
         out << "property uchar blue\n";
     }
-    out << "element face " << faces.size() << "\n";
+    out << "element face " << faces << "\n";
     out << "property list uchar int vertex_indices\n";
     out << "end_header\n";
-    out.close();
 
-    out.open( fname, std::ios_base::app | std::ios_base::binary );
-    for( int i = 0; i < new_vertices.size(); ++i )
-    {
-        // we assume little endian architecture on your device
-        out.write( reinterpret_cast< const char * >( &( new_vertices[i].x ) ), sizeof( float ) );
-        out.write( reinterpret_cast< const char * >( &( new_vertices[i].y ) ), sizeof( float ) );
-        out.write( reinterpret_cast< const char * >( &( new_vertices[i].z ) ), sizeof( float ) );
-
-        if( texture )
-        {
-            uint8_t x, y, z;
-            std::tie( x, y, z ) = new_tex[i];
-            out.write( reinterpret_cast< const char * >( &x ), sizeof( uint8_t ) );
-            out.write( reinterpret_cast< const char * >( &y ), sizeof( uint8_t ) );
-            out.write( reinterpret_cast< const char * >( &z ), sizeof( uint8_t ) );
-        }
-    }
-    auto size = faces.size();
-    for( int i = 0; i < size; ++i )
-    {
-        int three = 3;
-        out.write( reinterpret_cast< const char * >( &three ), sizeof( uint8_t ) );
-        out.write( reinterpret_cast< const char * >( &( std::get< 0 >( faces[i] ) ) ),
-                   sizeof( int ) );
-        out.write( reinterpret_cast< const char * >( &( std::get< 1 >( faces[i] ) ) ),
-                   sizeof( int ) );
-        out.write( reinterpret_cast< const char * >( &( std::get< 2 >( faces[i] ) ) ),
-                   sizeof( int ) );
-    }
+    out.write( vertex_data.data(), out_vertex - vertex_data.data() );
+    out.write( face_data.data(), out_face - face_data.data() );
+    if( ! out )
+        throw librealsense::io_exception( "failed to write " + fname );
 }
 
 size_t points::get_vertex_count() const
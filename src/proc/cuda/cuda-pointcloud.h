@@ -15,5 +15,6 @@ namespace librealsense
             rs2::points output,
             const rs2_intrinsics &depth_intrinsics,
             const rs2::depth_frame& depth_frame) override;
+        bool map_texture_in_one_pass() const override { return false; }
     };
 }
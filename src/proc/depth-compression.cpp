@@ -0,0 +1,112 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "stream.h"
+#include "core/video.h"
+#include "proc/synthetic-stream.h"
+#include "proc/depth-compression.h"
+#include "proc/rvl-codec.h"
+
+#include <librealsense2/hpp/rs_sensor.hpp>
+#include <librealsense2/hpp/rs_processing.hpp>
+
+#include <cstring>
+
+
+namespace librealsense
+{
+    namespace
+    {
+        // The same stream, in another format, of the same size and intrinsics
+        rs2::stream_profile clone_profile( const rs2::stream_profile & source, rs2_format format )
+        {
+            auto target = source.clone( source.stream_type(), source.stream_index(), format );
+            auto src_vspi = dynamic_cast< video_stream_profile_interface * >( source.get()->profile );
+            auto tgt_vspi = dynamic_cast< video_stream_profile_interface * >( target.get()->profile );
+            if( ! src_vspi || ! tgt_vspi )
+                throw std::runtime_error( "Stream profile is not video stream profile" );
+
+            auto const width = src_vspi->get_width(), height = src_vspi->get_height();
+            tgt_vspi->set_dims( width, height );
+            try
+            {
+                auto intrinsics = src_vspi->get_intrinsics();
+                tgt_vspi->set_intrinsics( [intrinsics]() { return intrinsics; } );
+            }
+            catch( ... )
+            {
+                // A stream that is not calibrated is still compressed
+            }
+            return target;
+        }
+    }
+
+
+    depth_encoder::depth_encoder()
+        : stream_filter_processing_block( "Depth Encoder" )
+    {
+        _stream_filter.format = RS2_FORMAT_Z16;
+        _stream_filter.stream = RS2_STREAM_DEPTH;
+    }
+
+    rs2::frame depth_encoder::process_frame( const rs2::frame_source & source, const rs2::frame & f )
+    {
+        auto vf = f.as< rs2::video_frame >();
+        if( ! vf )
+            return f;
+
+        if( f.get_profile().get() != _source_stream_profile.get() )
+        {
+            _source_stream_profile = f.get_profile();
+            _target_stream_profile = clone_profile( _source_stream_profile, RS2_FORMAT_Z16RVL );
+        }
+
+        int const width = vf.get_width(), height = vf.get_height();
+        if( vf.get_stride_in_bytes() != width * int( sizeof( uint16_t ) ) )
+            throw invalid_value_exception( "depth with row padding cannot be compressed" );
+        size_t const pixels = size_t( width ) * height;
+        _buffer.resize( rvl::max_compressed_size( pixels ) );
+        auto const size = rvl::compress( (const uint16_t *)vf.get_data(), pixels, _buffer.data() );
+
+        // Rows of the compressed data: it fits in a frame of the same height
+        int const stride = int( ( size + height - 1 ) / height );
+        auto tgt = source.allocate_video_frame( _target_stream_profile, f, int( sizeof( uint16_t ) ), width, height, stride,
+                                                RS2_EXTENSION_VIDEO_FRAME );
+        if( tgt )
+        {
+            auto data = (uint8_t *)tgt.get_data();
+            memcpy( data, _buffer.data(), size );
+            memset( data + size, 0, size_t( stride ) * height - size );
+        }
+        return tgt;
+    }
+
+
+    depth_decoder::depth_decoder()
+        : stream_filter_processing_block( "Depth Decoder" )
+    {
+        _stream_filter.format = RS2_FORMAT_Z16RVL;
+        _stream_filter.stream = RS2_STREAM_DEPTH;
+    }
+
+    rs2::frame depth_decoder::process_frame( const rs2::frame_source & source, const rs2::frame & f )
+    {
+        auto vf = f.as< rs2::video_frame >();
+        if( ! vf )
+            return f;
+
+        if( f.get_profile().get() != _source_stream_profile.get() )
+        {
+            _source_stream_profile = f.get_profile();
+            _target_stream_profile = clone_profile( _source_stream_profile, RS2_FORMAT_Z16 );
+        }
+
+        int const width = vf.get_width(), height = vf.get_height();
+        auto tgt = source.allocate_video_frame( _target_stream_profile, f, int( sizeof( uint16_t ) ), width, height,
+                                                width * int( sizeof( uint16_t ) ), RS2_EXTENSION_DEPTH_FRAME );
+        if( tgt )
+            rvl::decompress( (const uint8_t *)f.get_data(), f.get_data_size(), (uint16_t *)tgt.get_data(),
+                             size_t( width ) * height );
+        return tgt;
+    }
+}
@@ -0,0 +1,45 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+
+#include <vector>
+
+
+namespace librealsense
+{
+    // Compresses Z16 depth frames, losslessly, to RS2_FORMAT_Z16RVL video frames (see rvl-codec.h): the size of the
+    // image is kept, and the stride is whatever the compressed data needs. Depth units and metadata go along.
+    class depth_encoder : public stream_filter_processing_block
+    {
+    public:
+        depth_encoder();
+
+    protected:
+        rs2::frame process_frame( const rs2::frame_source & source, const rs2::frame & f ) override;
+
+    private:
+        rs2::stream_profile _source_stream_profile;
+        rs2::stream_profile _target_stream_profile;
+        std::vector< uint8_t > _buffer;  // the compressed data, before it is known how large a frame it needs
+    };
+    MAP_EXTENSION( RS2_EXTENSION_DEPTH_ENCODER, librealsense::depth_encoder );
+
+
+    // Decompresses RS2_FORMAT_Z16RVL frames back to Z16 depth frames
+    class depth_decoder : public stream_filter_processing_block
+    {
+    public:
+        depth_decoder();
+
+    protected:
+        rs2::frame process_frame( const rs2::frame_source & source, const rs2::frame & f ) override;
+
+    private:
+        rs2::stream_profile _source_stream_profile;
+        rs2::stream_profile _target_stream_profile;
+    };
+    MAP_EXTENSION( RS2_EXTENSION_DEPTH_DECODER, librealsense::depth_decoder );
+}
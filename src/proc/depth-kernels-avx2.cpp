@@ -0,0 +1,305 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "depth-kernels.h"
+
+#if defined __AVX2__ && ! defined ANDROID
+#include <immintrin.h>
+#include <cfloat>
+#endif
+
+
+namespace librealsense
+{
+namespace depth_kernels
+{
+#if defined __AVX2__ && ! defined ANDROID
+
+    namespace
+    {
+        inline __m256i load( const void * p ) { return _mm256_loadu_si256( reinterpret_cast< const __m256i * >( p ) ); }
+        inline __m128i load128( const void * p ) { return _mm_loadu_si128( reinterpret_cast< const __m128i * >( p ) ); }
+        inline void store( void * p, __m256i v ) { _mm256_storeu_si256( reinterpret_cast< __m256i * >( p ), v ); }
+
+        // Eight depth values, as floats
+        inline __m256 load_ps( const uint16_t * p ) { return _mm256_cvtepi32_ps( _mm256_cvtepu16_epi32( load128( p ) ) ); }
+
+        // packs_epi32 works within each lane: put the four quarters back in order
+        inline __m256i packs_in_order( __m256i lo, __m256i hi )
+        {
+            return _mm256_permute4x64_epi64( _mm256_packs_epi32( lo, hi ), _MM_SHUFFLE( 3, 1, 2, 0 ) );
+        }
+
+        inline __m256i in_range( __m256 d, __m256 lo, __m256 hi )
+        {
+            return _mm256_castps_si256( _mm256_and_ps( _mm256_cmp_ps( d, lo, _CMP_GE_OQ ), _mm256_cmp_ps( d, hi, _CMP_LE_OQ ) ) );
+        }
+
+        inline __m256 disparity( __m256 d, __m256 factor )
+        {
+            __m256 valid = _mm256_cmp_ps( d, _mm256_setzero_ps(), _CMP_NEQ_OQ );
+            return _mm256_and_ps( _mm256_add_ps( _mm256_div_ps( factor, d ), _mm256_setzero_ps() ), valid );
+        }
+
+        // Sign-extends the low 16 bits, so the saturating pack keeps them as they are
+        inline __m256i low_16( __m256i v ) { return _mm256_srai_epi32( _mm256_slli_epi32( v, 16 ), 16 ); }
+
+        inline __m256i depth( __m256 d, __m256 factor )
+        {
+            __m256 abs = _mm256_andnot_ps( _mm256_set1_ps( -0.f ), d );
+            __m256 normal = _mm256_and_ps( _mm256_cmp_ps( abs, _mm256_set1_ps( FLT_MIN ), _CMP_GE_OQ ),
+                                           _mm256_cmp_ps( abs, _mm256_set1_ps( FLT_MAX ), _CMP_LE_OQ ) );
+            __m256i z = _mm256_cvttps_epi32( _mm256_add_ps( _mm256_div_ps( factor, d ), _mm256_set1_ps( 0.5f ) ) );
+            return low_16( _mm256_and_si256( z, _mm256_castps_si256( normal ) ) );
+        }
+
+        inline __m256i load_ir( const uint8_t * p ) { return _mm256_cvtepu8_epi16( load128( p ) ); }
+        inline __m256i load_ir( const uint16_t * p ) { return load( p ); }
+
+        template< class T >
+        int merge_using_ir( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                            const T * ir0, const T * ir1, int count, int ir_min, int ir_max )
+        {
+            // Unsigned comparison, by flipping the sign bits
+            const __m256i sign = _mm256_set1_epi16( -0x8000 );
+            const __m256i lo = _mm256_xor_si256( _mm256_set1_epi16( short( ir_min ) ), sign );
+            const __m256i hi = _mm256_xor_si256( _mm256_set1_epi16( short( ir_max ) ), sign );
+            const __m256i zero = _mm256_setzero_si256();
+            int i = 0;
+            for( ; i + 16 <= count; i += 16 )
+            {
+                __m256i a = load( d0 + i ), b = load( d1 + i );
+                __m256i x0 = _mm256_xor_si256( load_ir( ir0 + i ), sign );
+                __m256i x1 = _mm256_xor_si256( load_ir( ir1 + i ), sign );
+                __m256i use_a = _mm256_andnot_si256( _mm256_cmpeq_epi16( a, zero ),
+                                                     _mm256_and_si256( _mm256_cmpgt_epi16( x0, lo ), _mm256_cmpgt_epi16( hi, x0 ) ) );
+                __m256i use_b = _mm256_andnot_si256( _mm256_cmpeq_epi16( b, zero ),
+                                                     _mm256_and_si256( _mm256_cmpgt_epi16( x1, lo ), _mm256_cmpgt_epi16( hi, x1 ) ) );
+                store( out + i, _mm256_blendv_epi8( _mm256_and_si256( use_b, b ), a, use_a ) );
+            }
+            return i;
+        }
+    }  // namespace
+
+    bool avx2_compiled() { return true; }
+
+    int threshold_avx2( uint16_t * out, const uint16_t * depth, int count, float units, float min, float max )
+    {
+        const __m256 u = _mm256_set1_ps( units ), lo = _mm256_set1_ps( min ), hi = _mm256_set1_ps( max );
+        int i = 0;
+        for( ; i + 16 <= count; i += 16 )
+        {
+            __m256i v = load( depth + i );
+            __m256i in0 = in_range( _mm256_mul_ps( load_ps( depth + i ), u ), lo, hi );
+            __m256i in1 = in_range( _mm256_mul_ps( load_ps( depth + i + 8 ), u ), lo, hi );
+            store( out + i, _mm256_and_si256( v, packs_in_order( in0, in1 ) ) );
+        }
+        return i;
+    }
+
+    int to_meters_avx2( float * out, const uint16_t * depth, int count, float units )
+    {
+        const __m256 u = _mm256_set1_ps( units );
+        int i = 0;
+        for( ; i + 8 <= count; i += 8 )
+            _mm256_storeu_ps( out + i, _mm256_mul_ps( load_ps( depth + i ), u ) );
+        return i;
+    }
+
+    int to_disparity_avx2( float * out, const uint16_t * depth, int count, float factor )
+    {
+        const __m256 f = _mm256_set1_ps( factor );
+        int i = 0;
+        for( ; i + 8 <= count; i += 8 )
+            _mm256_storeu_ps( out + i, disparity( load_ps( depth + i ), f ) );
+        return i;
+    }
+
+    int to_depth_avx2( uint16_t * out, const float * disparity, int count, float factor )
+    {
+        const __m256 f = _mm256_set1_ps( factor );
+        int i = 0;
+        for( ; i + 16 <= count; i += 16 )
+            store( out + i, packs_in_order( depth( _mm256_loadu_ps( disparity + i ), f ),
+                                            depth( _mm256_loadu_ps( disparity + i + 8 ), f ) ) );
+        return i;
+    }
+
+    int hdr_merge_avx2( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count )
+    {
+        int i = 0;
+        for( ; i + 16 <= count; i += 16 )
+        {
+            __m256i a = load( d0 + i );
+            __m256i no_a = _mm256_cmpeq_epi16( a, _mm256_setzero_si256() );
+            store( out + i, _mm256_blendv_epi8( a, load( d1 + i ), no_a ) );
+        }
+        return i;
+    }
+
+    int hdr_merge_avx2( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                        const uint8_t * ir0, const uint8_t * ir1, int count, int ir_min, int ir_max )
+    {
+        return merge_using_ir( out, d0, d1, ir0, ir1, count, ir_min, ir_max );
+    }
+
+    int hdr_merge_avx2( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                        const uint16_t * ir0, const uint16_t * ir1, int count, int ir_min, int ir_max )
+    {
+        return merge_using_ir( out, d0, d1, ir0, ir1, count, ir_min, ir_max );
+    }
+
+    // Stops at the first vector with a hole in it
+    int find_hole_avx2( const uint16_t * data, int count )
+    {
+        int i = 0;
+        for( ; i + 16 <= count; i += 16 )
+            if( _mm256_movemask_epi8( _mm256_cmpeq_epi16( load( data + i ), _mm256_setzero_si256() ) ) )
+                break;
+        return i;
+    }
+
+    int find_hole_avx2( const uint32_t * data, int count )
+    {
+        int i = 0;
+        for( ; i + 8 <= count; i += 8 )
+            if( _mm256_movemask_epi8( _mm256_cmpeq_epi32( load( data + i ), _mm256_setzero_si256() ) ) )
+                break;
+        return i;
+    }
+
+    // Holes are at z=0, so they add nothing to any sum but the count
+    int point_moments_avx2( double sums[10], const uint16_t * depth, const float * ray_x, const float * ray_y,
+                            int count, float units )
+    {
+        const __m256 u = _mm256_set1_ps( units );
+        const __m256i zero = _mm256_setzero_si256();
+        __m256d acc[9];
+        for( auto & a : acc )
+            a = _mm256_setzero_pd();
+        __m256i n = zero;
+        auto add = [&acc]( __m256d x, __m256d y, __m256d z ) {
+            acc[0] = _mm256_add_pd( acc[0], x );
+            acc[1] = _mm256_add_pd( acc[1], y );
+            acc[2] = _mm256_add_pd( acc[2], z );
+            acc[3] = _mm256_add_pd( acc[3], _mm256_mul_pd( x, x ) );
+            acc[4] = _mm256_add_pd( acc[4], _mm256_mul_pd( x, y ) );
+            acc[5] = _mm256_add_pd( acc[5], _mm256_mul_pd( x, z ) );
+            acc[6] = _mm256_add_pd( acc[6], _mm256_mul_pd( y, y ) );
+            acc[7] = _mm256_add_pd( acc[7], _mm256_mul_pd( y, z ) );
+            acc[8] = _mm256_add_pd( acc[8], _mm256_mul_pd( z, z ) );
+        };
+        int i = 0;
+        for( ; i + 8 <= count; i += 8 )
+        {
+            __m256i d = _mm256_cvtepu16_epi32( load128( depth + i ) );
+            n = _mm256_sub_epi32( n, _mm256_cmpgt_epi32( d, zero ) );
+            __m256 z = _mm256_mul_ps( _mm256_cvtepi32_ps( d ), u );
+            __m256 x = _mm256_mul_ps( _mm256_loadu_ps( ray_x + i ), z );
+            __m256 y = _mm256_mul_ps( _mm256_loadu_ps( ray_y + i ), z );
+            add( _mm256_cvtps_pd( _mm256_castps256_ps128( x ) ), _mm256_cvtps_pd( _mm256_castps256_ps128( y ) ),
+                 _mm256_cvtps_pd( _mm256_castps256_ps128( z ) ) );
+            add( _mm256_cvtps_pd( _mm256_extractf128_ps( x, 1 ) ), _mm256_cvtps_pd( _mm256_extractf128_ps( y, 1 ) ),
+                 _mm256_cvtps_pd( _mm256_extractf128_ps( z, 1 ) ) );
+        }
+        int32_t lanes[8];
+        store( lanes, n );
+        for( auto lane : lanes )
+            sums[0] += lane;
+        for( int k = 0; k < 9; ++k )
+        {
+            double d[4];
+            _mm256_storeu_pd( d, acc[k] );
+            sums[k + 1] += ( d[0] + d[1] ) + ( d[2] + d[3] );
+        }
+        return i;
+    }
+
+    namespace
+    {
+        // Four points, from their coordinates to x,y,z,x,y,z...
+        inline void store_xyz( float * p, __m128 x, __m128 y, __m128 z )
+        {
+            __m128 x_y = _mm_shuffle_ps( x, y, _MM_SHUFFLE( 2, 0, 2, 0 ) );  // x0 x2 y0 y2
+            __m128 z_x = _mm_shuffle_ps( z, x, _MM_SHUFFLE( 3, 1, 2, 0 ) );  // z0 z2 x1 x3
+            __m128 y_z = _mm_shuffle_ps( y, z, _MM_SHUFFLE( 3, 1, 3, 1 ) );  // y1 y3 z1 z3
+            _mm_storeu_ps( p, _mm_shuffle_ps( x_y, z_x, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+            _mm_storeu_ps( p + 4, _mm_shuffle_ps( y_z, x_y, _MM_SHUFFLE( 3, 1, 2, 0 ) ) );
+            _mm_storeu_ps( p + 8, _mm_shuffle_ps( z_x, y_z, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+        }
+    }
+
+    int texture_map_avx2( float * vertices, float * texcoords, const uint16_t * depth, const texture_mapping & m,
+                          int count, float units )
+    {
+        auto const & texture = m.texture;
+        // Brown-Conrady has the tangential terms of the undistorted point; the others, of the scaled one
+        bool const distorted = texture.model != RS2_DISTORTION_NONE;
+        bool const brown = texture.model == RS2_DISTORTION_BROWN_CONRADY;
+        const __m256 u = _mm256_set1_ps( units ), zero = _mm256_setzero_ps(), one = _mm256_set1_ps( 1.f ),
+                     two = _mm256_set1_ps( 2.f );
+        const __m256 t0 = _mm256_set1_ps( m.translation[0] ), t1 = _mm256_set1_ps( m.translation[1] ),
+                     t2 = _mm256_set1_ps( m.translation[2] );
+        // Straight to texture coordinates
+        const __m256 fx = _mm256_set1_ps( texture.fx / texture.width ), fy = _mm256_set1_ps( texture.fy / texture.height );
+        const __m256 ppx = _mm256_set1_ps( texture.ppx / texture.width ), ppy = _mm256_set1_ps( texture.ppy / texture.height );
+        __m256 c[5];
+        for( int k = 0; k < 5; ++k )
+            c[k] = _mm256_set1_ps( texture.coeffs[k] );
+        int i = 0;
+        for( ; i + 8 <= count; i += 8 )
+        {
+            __m256 z = _mm256_mul_ps( load_ps( depth + i ), u );
+            __m256 vx = _mm256_mul_ps( _mm256_loadu_ps( m.ray_x + i ), z );
+            __m256 vy = _mm256_mul_ps( _mm256_loadu_ps( m.ray_y + i ), z );
+            store_xyz( vertices + 3 * i, _mm256_castps256_ps128( vx ), _mm256_castps256_ps128( vy ),
+                       _mm256_castps256_ps128( z ) );
+            store_xyz( vertices + 3 * i + 12, _mm256_extractf128_ps( vx, 1 ), _mm256_extractf128_ps( vy, 1 ),
+                       _mm256_extractf128_ps( z, 1 ) );
+
+            __m256 inv_z = _mm256_div_ps( one, _mm256_add_ps( _mm256_mul_ps( _mm256_loadu_ps( m.to_z + i ), z ), t2 ) );
+            __m256 x = _mm256_mul_ps( _mm256_add_ps( _mm256_mul_ps( _mm256_loadu_ps( m.to_x + i ), z ), t0 ), inv_z );
+            __m256 y = _mm256_mul_ps( _mm256_add_ps( _mm256_mul_ps( _mm256_loadu_ps( m.to_y + i ), z ), t1 ), inv_z );
+            if( distorted )
+            {
+                __m256 r2 = _mm256_add_ps( _mm256_mul_ps( x, x ), _mm256_mul_ps( y, y ) );
+                __m256 f = _mm256_add_ps( one, _mm256_mul_ps( r2, _mm256_add_ps( c[0], _mm256_mul_ps( r2, _mm256_add_ps( c[1], _mm256_mul_ps( r2, c[4] ) ) ) ) ) );
+                __m256 xf = _mm256_mul_ps( x, f ), yf = _mm256_mul_ps( y, f );
+                if( ! brown )
+                    x = xf, y = yf;
+                __m256 xy2 = _mm256_mul_ps( two, _mm256_mul_ps( x, y ) );
+                __m256 dx = _mm256_add_ps( xf, _mm256_add_ps( _mm256_mul_ps( c[2], xy2 ), _mm256_mul_ps( c[3], _mm256_add_ps( r2, _mm256_mul_ps( two, _mm256_mul_ps( x, x ) ) ) ) ) );
+                __m256 dy = _mm256_add_ps( yf, _mm256_add_ps( _mm256_mul_ps( c[3], xy2 ), _mm256_mul_ps( c[2], _mm256_add_ps( r2, _mm256_mul_ps( two, _mm256_mul_ps( y, y ) ) ) ) ) );
+                x = dx;
+                y = dy;
+            }
+            __m256 valid = _mm256_cmp_ps( z, zero, _CMP_NEQ_OQ );
+            __m256 s = _mm256_and_ps( _mm256_add_ps( _mm256_mul_ps( x, fx ), ppx ), valid );
+            __m256 t = _mm256_and_ps( _mm256_add_ps( _mm256_mul_ps( y, fy ), ppy ), valid );
+            // unpack works within each lane: st0 st1 st4 st5, st2 st3 st6 st7
+            __m256 lo = _mm256_unpacklo_ps( s, t ), hi = _mm256_unpackhi_ps( s, t );
+            _mm256_storeu_ps( texcoords + 2 * i, _mm256_permute2f128_ps( lo, hi, 0x20 ) );
+            _mm256_storeu_ps( texcoords + 2 * i + 8, _mm256_permute2f128_ps( lo, hi, 0x31 ) );
+        }
+        return i;
+    }
+
+#else
+
+    // Not compiled with AVX2: is_supported( isa::avx2 ) is false, and nothing is done here
+    bool avx2_compiled() { return false; }
+    int threshold_avx2( uint16_t *, const uint16_t *, int, float, float, float ) { return 0; }
+    int to_meters_avx2( float *, const uint16_t *, int, float ) { return 0; }
+    int to_disparity_avx2( float *, const uint16_t *, int, float ) { return 0; }
+    int to_depth_avx2( uint16_t *, const float *, int, float ) { return 0; }
+    int hdr_merge_avx2( uint16_t *, const uint16_t *, const uint16_t *, int ) { return 0; }
+    int hdr_merge_avx2( uint16_t *, const uint16_t *, const uint16_t *, const uint8_t *, const uint8_t *, int, int, int ) { return 0; }
+    int hdr_merge_avx2( uint16_t *, const uint16_t *, const uint16_t *, const uint16_t *, const uint16_t *, int, int, int ) { return 0; }
+    int find_hole_avx2( const uint16_t *, int ) { return 0; }
+    int find_hole_avx2( const uint32_t *, int ) { return 0; }
+    int point_moments_avx2( double *, const uint16_t *, const float *, const float *, int, float ) { return 0; }
+    int texture_map_avx2( float *, float *, const uint16_t *, const texture_mapping &, int, float ) { return 0; }
+
+#endif
+}  // namespace depth_kernels
+}
@@ -0,0 +1,876 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "depth-kernels.h"
+
+#include <librealsense2/rsutil.h>
+
+#include <cfloat>
+#include <cmath>
+
+#if defined __SSSE3__ && ! defined ANDROID
+#define RS2_KERNELS_SSSE3
+#include <tmmintrin.h>
+#endif
+
+#if defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#define RS2_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace librealsense
+{
+namespace depth_kernels
+{
+    namespace
+    {
+        //
+        // The scalar loops, as they were in the filters; each continues from where the vector loop
+        // left off
+        //
+        void scalar_threshold( uint16_t * out, const uint16_t * depth, int i, int count, float units, float min, float max )
+        {
+            for( ; i < count; ++i )
+            {
+                auto dist = units * depth[i];
+                out[i] = ( dist >= min && dist <= max ) ? depth[i] : 0;
+            }
+        }
+
+        void scalar_to_meters( float * out, const uint16_t * depth, int i, int count, float units )
+        {
+            for( ; i < count; ++i )
+                out[i] = units * depth[i];
+        }
+
+        void scalar_to_disparity( float * out, const uint16_t * depth, int i, int count, float factor )
+        {
+            for( ; i < count; ++i )
+            {
+                float input = depth[i];
+                out[i] = std::isnormal( input ) ? ( factor / input ) + 0.f : 0.f;
+            }
+        }
+
+        void scalar_to_depth( uint16_t * out, const float * disparity, int i, int count, float factor )
+        {
+            for( ; i < count; ++i )
+            {
+                float input = disparity[i];
+                out[i] = std::isnormal( input ) ? static_cast< uint16_t >( ( factor / input ) + 0.5f ) : 0;
+            }
+        }
+
+        void scalar_hdr_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int i, int count )
+        {
+            for( ; i < count; ++i )
+            {
+                if( d0[i] )
+                    out[i] = d0[i];
+                else if( d1[i] )
+                    out[i] = d1[i];
+                else
+                    out[i] = 0;
+            }
+        }
+
+        template< class T >
+        void scalar_hdr_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                               const T * ir0, const T * ir1, int i, int count, int ir_min, int ir_max )
+        {
+            for( ; i < count; ++i )
+            {
+                if( ir0[i] > ir_min && ir0[i] < ir_max && d0[i] )
+                    out[i] = d0[i];
+                else if( ir1[i] > ir_min && ir1[i] < ir_max && d1[i] )
+                    out[i] = d1[i];
+                else
+                    out[i] = 0;
+            }
+        }
+
+        template< class T >
+        int scalar_find_hole( const T * data, int i, int count )
+        {
+            for( ; i < count; ++i )
+                if( ! data[i] )
+                    return i;
+            return i;
+        }
+
+        void scalar_point_moments( double sums[10], const uint16_t * depth, const float * ray_x, const float * ray_y,
+                                   int i, int count, float units )
+        {
+            for( ; i < count; ++i )
+            {
+                if( ! depth[i] )
+                    continue;
+                float z = units * depth[i];
+                double x = ray_x[i] * z, y = ray_y[i] * z;
+                sums[0] += 1;
+                sums[1] += x;
+                sums[2] += y;
+                sums[3] += z;
+                sums[4] += x * x;
+                sums[5] += x * y;
+                sums[6] += x * z;
+                sums[7] += y * y;
+                sums[8] += y * z;
+                sums[9] += double( z ) * z;
+            }
+        }
+
+        void scalar_texture_map( float * vertices, float * texcoords, const uint16_t * depth, const texture_mapping & m,
+                                 int i, int count, float units )
+        {
+            auto const & texture = m.texture;
+            for( ; i < count; ++i )
+            {
+                float z = units * depth[i];
+                vertices[3 * i] = m.ray_x[i] * z;
+                vertices[3 * i + 1] = m.ray_y[i] * z;
+                vertices[3 * i + 2] = z;
+                if( ! z )
+                {
+                    texcoords[2 * i] = texcoords[2 * i + 1] = 0.f;
+                    continue;
+                }
+                const float point[] = { m.to_x[i] * z + m.translation[0],
+                                        m.to_y[i] * z + m.translation[1],
+                                        m.to_z[i] * z + m.translation[2] };
+                float pixel[2];
+                rs2_project_point_to_pixel( pixel, &texture, point );
+                texcoords[2 * i] = pixel[0] / texture.width;
+                texcoords[2 * i + 1] = pixel[1] / texture.height;
+            }
+        }
+
+        // The models whose projection is a polynomial, which the vector versions do
+        bool vectorized_distortion( rs2_distortion model )
+        {
+            return model == RS2_DISTORTION_NONE || model == RS2_DISTORTION_BROWN_CONRADY
+                || model == RS2_DISTORTION_MODIFIED_BROWN_CONRADY || model == RS2_DISTORTION_INVERSE_BROWN_CONRADY;
+        }
+
+#ifdef RS2_KERNELS_SSSE3
+        inline __m128i load( const void * p ) { return _mm_loadu_si128( reinterpret_cast< const __m128i * >( p ) ); }
+        inline void store( void * p, __m128i v ) { _mm_storeu_si128( reinterpret_cast< __m128i * >( p ), v ); }
+
+        // Low and high four depth values, as floats
+        inline __m128 low_ps( __m128i v ) { return _mm_cvtepi32_ps( _mm_unpacklo_epi16( v, _mm_setzero_si128() ) ); }
+        inline __m128 high_ps( __m128i v ) { return _mm_cvtepi32_ps( _mm_unpackhi_epi16( v, _mm_setzero_si128() ) ); }
+
+        // Keeps the low 16 bits of each 32-bit value, as a static_cast would
+        inline __m128i pack_low_16( __m128i lo, __m128i hi )
+        {
+            return _mm_packs_epi32( _mm_srai_epi32( _mm_slli_epi32( lo, 16 ), 16 ), _mm_srai_epi32( _mm_slli_epi32( hi, 16 ), 16 ) );
+        }
+
+        int ssse3_threshold( uint16_t * out, const uint16_t * depth, int count, float units, float min, float max )
+        {
+            const __m128 u = _mm_set1_ps( units ), lo = _mm_set1_ps( min ), hi = _mm_set1_ps( max );
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                __m128i v = load( depth + i );
+                __m128 d0 = _mm_mul_ps( low_ps( v ), u );
+                __m128 d1 = _mm_mul_ps( high_ps( v ), u );
+                __m128i in0 = _mm_castps_si128( _mm_and_ps( _mm_cmpge_ps( d0, lo ), _mm_cmple_ps( d0, hi ) ) );
+                __m128i in1 = _mm_castps_si128( _mm_and_ps( _mm_cmpge_ps( d1, lo ), _mm_cmple_ps( d1, hi ) ) );
+                store( out + i, _mm_and_si128( v, _mm_packs_epi32( in0, in1 ) ) );
+            }
+            return i;
+        }
+
+        int ssse3_to_meters( float * out, const uint16_t * depth, int count, float units )
+        {
+            const __m128 u = _mm_set1_ps( units );
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                __m128i v = load( depth + i );
+                _mm_storeu_ps( out + i, _mm_mul_ps( low_ps( v ), u ) );
+                _mm_storeu_ps( out + i + 4, _mm_mul_ps( high_ps( v ), u ) );
+            }
+            return i;
+        }
+
+        inline __m128 disparity( __m128 d, __m128 factor )
+        {
+            __m128 valid = _mm_cmpneq_ps( d, _mm_setzero_ps() );
+            return _mm_and_ps( _mm_add_ps( _mm_div_ps( factor, d ), _mm_setzero_ps() ), valid );
+        }
+
+        int ssse3_to_disparity( float * out, const uint16_t * depth, int count, float factor )
+        {
+            const __m128 f = _mm_set1_ps( factor );
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                __m128i v = load( depth + i );
+                _mm_storeu_ps( out + i, disparity( low_ps( v ), f ) );
+                _mm_storeu_ps( out + i + 4, disparity( high_ps( v ), f ) );
+            }
+            return i;
+        }
+
+        // std::isnormal: FLT_MIN <= |x| <= FLT_MAX, which is false for NaN
+        inline __m128i depth( __m128 d, __m128 factor )
+        {
+            __m128 abs = _mm_andnot_ps( _mm_set1_ps( -0.f ), d );
+            __m128 normal = _mm_and_ps( _mm_cmpge_ps( abs, _mm_set1_ps( FLT_MIN ) ), _mm_cmple_ps( abs, _mm_set1_ps( FLT_MAX ) ) );
+            __m128i z = _mm_cvttps_epi32( _mm_add_ps( _mm_div_ps( factor, d ), _mm_set1_ps( 0.5f ) ) );
+            return _mm_and_si128( z, _mm_castps_si128( normal ) );
+        }
+
+        int ssse3_to_depth( uint16_t * out, const float * disparity, int count, float factor )
+        {
+            const __m128 f = _mm_set1_ps( factor );
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+                store( out + i, pack_low_16( depth( _mm_loadu_ps( disparity + i ), f ),
+                                             depth( _mm_loadu_ps( disparity + i + 4 ), f ) ) );
+            return i;
+        }
+
+        int ssse3_hdr_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count )
+        {
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                __m128i a = load( d0 + i ), b = load( d1 + i );
+                __m128i no_a = _mm_cmpeq_epi16( a, _mm_setzero_si128() );
+                store( out + i, _mm_or_si128( _mm_andnot_si128( no_a, a ), _mm_and_si128( no_a, b ) ) );
+            }
+            return i;
+        }
+
+        inline __m128i load_ir( const uint8_t * p ) { return _mm_unpacklo_epi8( _mm_loadl_epi64( reinterpret_cast< const __m128i * >( p ) ), _mm_setzero_si128() ); }
+        inline __m128i load_ir( const uint16_t * p ) { return load( p ); }
+
+        template< class T >
+        int ssse3_hdr_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                             const T * ir0, const T * ir1, int count, int ir_min, int ir_max )
+        {
+            // Unsigned comparison, by flipping the sign bits
+            const __m128i sign = _mm_set1_epi16( -0x8000 );
+            const __m128i lo = _mm_xor_si128( _mm_set1_epi16( short( ir_min ) ), sign );
+            const __m128i hi = _mm_xor_si128( _mm_set1_epi16( short( ir_max ) ), sign );
+            const __m128i zero = _mm_setzero_si128();
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                __m128i a = load( d0 + i ), b = load( d1 + i );
+                __m128i x0 = _mm_xor_si128( load_ir( ir0 + i ), sign );
+                __m128i x1 = _mm_xor_si128( load_ir( ir1 + i ), sign );
+                __m128i use_a = _mm_andnot_si128( _mm_cmpeq_epi16( a, zero ),
+                                                  _mm_and_si128( _mm_cmpgt_epi16( x0, lo ), _mm_cmplt_epi16( x0, hi ) ) );
+                __m128i use_b = _mm_andnot_si128( _mm_cmpeq_epi16( b, zero ),
+                                                  _mm_and_si128( _mm_cmpgt_epi16( x1, lo ), _mm_cmplt_epi16( x1, hi ) ) );
+                store( out + i, _mm_or_si128( _mm_and_si128( use_a, a ), _mm_andnot_si128( use_a, _mm_and_si128( use_b, b ) ) ) );
+            }
+            return i;
+        }
+
+        // Stops at the first vector with a hole in it
+        int ssse3_find_hole( const uint16_t * data, int count )
+        {
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+                if( _mm_movemask_epi8( _mm_cmpeq_epi16( load( data + i ), _mm_setzero_si128() ) ) )
+                    break;
+            return i;
+        }
+
+        int ssse3_find_hole( const uint32_t * data, int count )
+        {
+            int i = 0;
+            for( ; i + 4 <= count; i += 4 )
+                if( _mm_movemask_epi8( _mm_cmpeq_epi32( load( data + i ), _mm_setzero_si128() ) ) )
+                    break;
+            return i;
+        }
+
+        // acc[] += { x, y, z, xx, xy, xz, yy, yz, zz }
+        inline void add_moments( __m128d acc[9], __m128d x, __m128d y, __m128d z )
+        {
+            acc[0] = _mm_add_pd( acc[0], x );
+            acc[1] = _mm_add_pd( acc[1], y );
+            acc[2] = _mm_add_pd( acc[2], z );
+            acc[3] = _mm_add_pd( acc[3], _mm_mul_pd( x, x ) );
+            acc[4] = _mm_add_pd( acc[4], _mm_mul_pd( x, y ) );
+            acc[5] = _mm_add_pd( acc[5], _mm_mul_pd( x, z ) );
+            acc[6] = _mm_add_pd( acc[6], _mm_mul_pd( y, y ) );
+            acc[7] = _mm_add_pd( acc[7], _mm_mul_pd( y, z ) );
+            acc[8] = _mm_add_pd( acc[8], _mm_mul_pd( z, z ) );
+        }
+
+        // Holes are at z=0, so they add nothing to any sum but the count
+        int ssse3_point_moments( double sums[10], const uint16_t * depth, const float * ray_x, const float * ray_y,
+                                 int count, float units )
+        {
+            const __m128 u = _mm_set1_ps( units );
+            const __m128i zero = _mm_setzero_si128();
+            __m128d acc[9];
+            for( auto & a : acc )
+                a = _mm_setzero_pd();
+            __m128i n = zero;
+            int i = 0;
+            for( ; i + 4 <= count; i += 4 )
+            {
+                __m128i d = _mm_unpacklo_epi16( _mm_loadl_epi64( reinterpret_cast< const __m128i * >( depth + i ) ), zero );
+                n = _mm_sub_epi32( n, _mm_cmpgt_epi32( d, zero ) );
+                __m128 z = _mm_mul_ps( _mm_cvtepi32_ps( d ), u );
+                __m128 x = _mm_mul_ps( _mm_loadu_ps( ray_x + i ), z );
+                __m128 y = _mm_mul_ps( _mm_loadu_ps( ray_y + i ), z );
+                add_moments( acc, _mm_cvtps_pd( x ), _mm_cvtps_pd( y ), _mm_cvtps_pd( z ) );
+                add_moments( acc, _mm_cvtps_pd( _mm_movehl_ps( x, x ) ), _mm_cvtps_pd( _mm_movehl_ps( y, y ) ),
+                             _mm_cvtps_pd( _mm_movehl_ps( z, z ) ) );
+            }
+            int32_t lanes[4];
+            store( lanes, n );
+            sums[0] += double( lanes[0] ) + lanes[1] + lanes[2] + lanes[3];
+            for( int k = 0; k < 9; ++k )
+            {
+                double d[2];
+                _mm_storeu_pd( d, acc[k] );
+                sums[k + 1] += d[0] + d[1];
+            }
+            return i;
+        }
+
+        // Four points, from their coordinates to x,y,z,x,y,z...
+        inline void store_xyz( float * p, __m128 x, __m128 y, __m128 z )
+        {
+            __m128 x_y = _mm_shuffle_ps( x, y, _MM_SHUFFLE( 2, 0, 2, 0 ) );  // x0 x2 y0 y2
+            __m128 z_x = _mm_shuffle_ps( z, x, _MM_SHUFFLE( 3, 1, 2, 0 ) );  // z0 z2 x1 x3
+            __m128 y_z = _mm_shuffle_ps( y, z, _MM_SHUFFLE( 3, 1, 3, 1 ) );  // y1 y3 z1 z3
+            _mm_storeu_ps( p, _mm_shuffle_ps( x_y, z_x, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+            _mm_storeu_ps( p + 4, _mm_shuffle_ps( y_z, x_y, _MM_SHUFFLE( 3, 1, 2, 0 ) ) );
+            _mm_storeu_ps( p + 8, _mm_shuffle_ps( z_x, y_z, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+        }
+
+        int ssse3_texture_map( float * vertices, float * texcoords, const uint16_t * depth, const texture_mapping & m,
+                               int count, float units )
+        {
+            auto const & texture = m.texture;
+            // Brown-Conrady has the tangential terms of the undistorted point; the others, of the scaled one
+            bool const distorted = texture.model != RS2_DISTORTION_NONE;
+            bool const brown = texture.model == RS2_DISTORTION_BROWN_CONRADY;
+            const __m128 u = _mm_set1_ps( units ), zero = _mm_setzero_ps(), one = _mm_set1_ps( 1.f ), two = _mm_set1_ps( 2.f );
+            const __m128 t0 = _mm_set1_ps( m.translation[0] ), t1 = _mm_set1_ps( m.translation[1] ),
+                         t2 = _mm_set1_ps( m.translation[2] );
+            // Straight to texture coordinates
+            const __m128 fx = _mm_set1_ps( texture.fx / texture.width ), fy = _mm_set1_ps( texture.fy / texture.height );
+            const __m128 ppx = _mm_set1_ps( texture.ppx / texture.width ), ppy = _mm_set1_ps( texture.ppy / texture.height );
+            __m128 c[5];
+            for( int k = 0; k < 5; ++k )
+                c[k] = _mm_set1_ps( texture.coeffs[k] );
+            const __m128i zi = _mm_setzero_si128();
+            int i = 0;
+            for( ; i + 4 <= count; i += 4 )
+            {
+                __m128i d = _mm_unpacklo_epi16( _mm_loadl_epi64( reinterpret_cast< const __m128i * >( depth + i ) ), zi );
+                __m128 z = _mm_mul_ps( _mm_cvtepi32_ps( d ), u );
+                store_xyz( vertices + 3 * i, _mm_mul_ps( _mm_loadu_ps( m.ray_x + i ), z ),
+                           _mm_mul_ps( _mm_loadu_ps( m.ray_y + i ), z ), z );
+
+                __m128 inv_z = _mm_div_ps( one, _mm_add_ps( _mm_mul_ps( _mm_loadu_ps( m.to_z + i ), z ), t2 ) );
+                __m128 x = _mm_mul_ps( _mm_add_ps( _mm_mul_ps( _mm_loadu_ps( m.to_x + i ), z ), t0 ), inv_z );
+                __m128 y = _mm_mul_ps( _mm_add_ps( _mm_mul_ps( _mm_loadu_ps( m.to_y + i ), z ), t1 ), inv_z );
+                if( distorted )
+                {
+                    __m128 r2 = _mm_add_ps( _mm_mul_ps( x, x ), _mm_mul_ps( y, y ) );
+                    __m128 f = _mm_add_ps( one, _mm_mul_ps( r2, _mm_add_ps( c[0], _mm_mul_ps( r2, _mm_add_ps( c[1], _mm_mul_ps( r2, c[4] ) ) ) ) ) );
+                    __m128 xf = _mm_mul_ps( x, f ), yf = _mm_mul_ps( y, f );
+                    if( ! brown )
+                        x = xf, y = yf;
+                    __m128 xy2 = _mm_mul_ps( two, _mm_mul_ps( x, y ) );
+                    __m128 dx = _mm_add_ps( xf, _mm_add_ps( _mm_mul_ps( c[2], xy2 ), _mm_mul_ps( c[3], _mm_add_ps( r2, _mm_mul_ps( two, _mm_mul_ps( x, x ) ) ) ) ) );
+                    __m128 dy = _mm_add_ps( yf, _mm_add_ps( _mm_mul_ps( c[3], xy2 ), _mm_mul_ps( c[2], _mm_add_ps( r2, _mm_mul_ps( two, _mm_mul_ps( y, y ) ) ) ) ) );
+                    x = dx;
+                    y = dy;
+                }
+                __m128 valid = _mm_cmpneq_ps( z, zero );
+                __m128 s = _mm_and_ps( _mm_add_ps( _mm_mul_ps( x, fx ), ppx ), valid );
+                __m128 t = _mm_and_ps( _mm_add_ps( _mm_mul_ps( y, fy ), ppy ), valid );
+                _mm_storeu_ps( texcoords + 2 * i, _mm_unpacklo_ps( s, t ) );
+                _mm_storeu_ps( texcoords + 2 * i + 4, _mm_unpackhi_ps( s, t ) );
+            }
+            return i;
+        }
+#else
+        int ssse3_threshold( uint16_t *, const uint16_t *, int, float, float, float ) { return 0; }
+        int ssse3_to_meters( float *, const uint16_t *, int, float ) { return 0; }
+        int ssse3_to_disparity( float *, const uint16_t *, int, float ) { return 0; }
+        int ssse3_to_depth( uint16_t *, const float *, int, float ) { return 0; }
+        int ssse3_hdr_merge( uint16_t *, const uint16_t *, const uint16_t *, int ) { return 0; }
+        template< class T > int ssse3_hdr_merge( uint16_t *, const uint16_t *, const uint16_t *, const T *, const T *, int, int, int ) { return 0; }
+        int ssse3_find_hole( const uint16_t *, int ) { return 0; }
+        int ssse3_find_hole( const uint32_t *, int ) { return 0; }
+        int ssse3_point_moments( double *, const uint16_t *, const float *, const float *, int, float ) { return 0; }
+        int ssse3_texture_map( float *, float *, const uint16_t *, const texture_mapping &, int, float ) { return 0; }
+#endif
+
+#ifdef RS2_KERNELS_NEON
+        inline float32x4_t low_f32( uint16x8_t v ) { return vcvtq_f32_u32( vmovl_u16( vget_low_u16( v ) ) ); }
+        inline float32x4_t high_f32( uint16x8_t v ) { return vcvtq_f32_u32( vmovl_u16( vget_high_u16( v ) ) ); }
+
+        int neon_threshold( uint16_t * out, const uint16_t * depth, int count, float units, float min, float max )
+        {
+            const float32x4_t lo = vdupq_n_f32( min ), hi = vdupq_n_f32( max );
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                uint16x8_t v = vld1q_u16( depth + i );
+                float32x4_t d0 = vmulq_n_f32( low_f32( v ), units );
+                float32x4_t d1 = vmulq_n_f32( high_f32( v ), units );
+                uint32x4_t in0 = vandq_u32( vcgeq_f32( d0, lo ), vcleq_f32( d0, hi ) );
+                uint32x4_t in1 = vandq_u32( vcgeq_f32( d1, lo ), vcleq_f32( d1, hi ) );
+                vst1q_u16( out + i, vandq_u16( v, vcombine_u16( vmovn_u32( in0 ), vmovn_u32( in1 ) ) ) );
+            }
+            return i;
+        }
+
+        int neon_to_meters( float * out, const uint16_t * depth, int count, float units )
+        {
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                uint16x8_t v = vld1q_u16( depth + i );
+                vst1q_f32( out + i, vmulq_n_f32( low_f32( v ), units ) );
+                vst1q_f32( out + i + 4, vmulq_n_f32( high_f32( v ), units ) );
+            }
+            return i;
+        }
+
+#if defined( __aarch64__ )  // ARMv7 NEON has no division
+        inline float32x4_t disparity( float32x4_t d, float32x4_t factor )
+        {
+            uint32x4_t valid = vmvnq_u32( vceqq_f32( d, vdupq_n_f32( 0.f ) ) );
+            float32x4_t z = vaddq_f32( vdivq_f32( factor, d ), vdupq_n_f32( 0.f ) );
+            return vreinterpretq_f32_u32( vandq_u32( vreinterpretq_u32_f32( z ), valid ) );
+        }
+
+        int neon_to_disparity( float * out, const uint16_t * depth, int count, float factor )
+        {
+            const float32x4_t f = vdupq_n_f32( factor );
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                uint16x8_t v = vld1q_u16( depth + i );
+                vst1q_f32( out + i, disparity( low_f32( v ), f ) );
+                vst1q_f32( out + i + 4, disparity( high_f32( v ), f ) );
+            }
+            return i;
+        }
+
+        // Converting to unsigned and narrowing is what a static_cast< uint16_t > does on ARM
+        inline uint16x4_t depth( float32x4_t d, float32x4_t factor )
+        {
+            float32x4_t abs = vabsq_f32( d );
+            uint32x4_t normal = vandq_u32( vcgeq_f32( abs, vdupq_n_f32( FLT_MIN ) ), vcleq_f32( abs, vdupq_n_f32( FLT_MAX ) ) );
+            uint32x4_t z = vcvtq_u32_f32( vaddq_f32( vdivq_f32( factor, d ), vdupq_n_f32( 0.5f ) ) );
+            return vmovn_u32( vandq_u32( z, normal ) );
+        }
+
+        int neon_to_depth( uint16_t * out, const float * disparity, int count, float factor )
+        {
+            const float32x4_t f = vdupq_n_f32( factor );
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+                vst1q_u16( out + i, vcombine_u16( depth( vld1q_f32( disparity + i ), f ), depth( vld1q_f32( disparity + i + 4 ), f ) ) );
+            return i;
+        }
+
+        // acc[] += { x, y, z, xx, xy, xz, yy, yz, zz }
+        inline void add_moments( float64x2_t acc[9], float64x2_t x, float64x2_t y, float64x2_t z )
+        {
+            acc[0] = vaddq_f64( acc[0], x );
+            acc[1] = vaddq_f64( acc[1], y );
+            acc[2] = vaddq_f64( acc[2], z );
+            acc[3] = vaddq_f64( acc[3], vmulq_f64( x, x ) );
+            acc[4] = vaddq_f64( acc[4], vmulq_f64( x, y ) );
+            acc[5] = vaddq_f64( acc[5], vmulq_f64( x, z ) );
+            acc[6] = vaddq_f64( acc[6], vmulq_f64( y, y ) );
+            acc[7] = vaddq_f64( acc[7], vmulq_f64( y, z ) );
+            acc[8] = vaddq_f64( acc[8], vmulq_f64( z, z ) );
+        }
+
+        // Holes are at z=0, so they add nothing to any sum but the count
+        int neon_point_moments( double sums[10], const uint16_t * depth, const float * ray_x, const float * ray_y,
+                                int count, float units )
+        {
+            float64x2_t acc[9];
+            for( auto & a : acc )
+                a = vdupq_n_f64( 0. );
+            uint32x4_t n = vdupq_n_u32( 0 );
+            int i = 0;
+            for( ; i + 4 <= count; i += 4 )
+            {
+                uint32x4_t d = vmovl_u16( vld1_u16( depth + i ) );
+                n = vsubq_u32( n, vtstq_u32( d, d ) );
+                float32x4_t z = vmulq_n_f32( vcvtq_f32_u32( d ), units );
+                float32x4_t x = vmulq_f32( vld1q_f32( ray_x + i ), z );
+                float32x4_t y = vmulq_f32( vld1q_f32( ray_y + i ), z );
+                add_moments( acc, vcvt_f64_f32( vget_low_f32( x ) ), vcvt_f64_f32( vget_low_f32( y ) ),
+                             vcvt_f64_f32( vget_low_f32( z ) ) );
+                add_moments( acc, vcvt_high_f64_f32( x ), vcvt_high_f64_f32( y ), vcvt_high_f64_f32( z ) );
+            }
+            sums[0] += vaddvq_u32( n );
+            for( int k = 0; k < 9; ++k )
+                sums[k + 1] += vaddvq_f64( acc[k] );
+            return i;
+        }
+
+        int neon_texture_map( float * vertices, float * texcoords, const uint16_t * depth, const texture_mapping & m,
+                              int count, float units )
+        {
+            auto const & texture = m.texture;
+            // Brown-Conrady has the tangential terms of the undistorted point; the others, of the scaled one
+            bool const distorted = texture.model != RS2_DISTORTION_NONE;
+            bool const brown = texture.model == RS2_DISTORTION_BROWN_CONRADY;
+            const float32x4_t zero = vdupq_n_f32( 0.f ), one = vdupq_n_f32( 1.f );
+            const float32x4_t t0 = vdupq_n_f32( m.translation[0] ), t1 = vdupq_n_f32( m.translation[1] ),
+                              t2 = vdupq_n_f32( m.translation[2] );
+            // Straight to texture coordinates
+            const float fx = texture.fx / texture.width, fy = texture.fy / texture.height;
+            const float32x4_t ppx = vdupq_n_f32( texture.ppx / texture.width ), ppy = vdupq_n_f32( texture.ppy / texture.height );
+            const float32x4_t c0 = vdupq_n_f32( texture.coeffs[0] ), c1 = vdupq_n_f32( texture.coeffs[1] ),
+                              c4 = vdupq_n_f32( texture.coeffs[4] );
+            int i = 0;
+            for( ; i + 4 <= count; i += 4 )
+            {
+                float32x4_t z = vmulq_n_f32( vcvtq_f32_u32( vmovl_u16( vld1_u16( depth + i ) ) ), units );
+                float32x4x3_t xyz = { { vmulq_f32( vld1q_f32( m.ray_x + i ), z ), vmulq_f32( vld1q_f32( m.ray_y + i ), z ), z } };
+                vst3q_f32( vertices + 3 * i, xyz );
+
+                float32x4_t inv_z = vdivq_f32( one, vaddq_f32( vmulq_f32( vld1q_f32( m.to_z + i ), z ), t2 ) );
+                float32x4_t x = vmulq_f32( vaddq_f32( vmulq_f32( vld1q_f32( m.to_x + i ), z ), t0 ), inv_z );
+                float32x4_t y = vmulq_f32( vaddq_f32( vmulq_f32( vld1q_f32( m.to_y + i ), z ), t1 ), inv_z );
+                if( distorted )
+                {
+                    float32x4_t r2 = vaddq_f32( vmulq_f32( x, x ), vmulq_f32( y, y ) );
+                    float32x4_t f = vaddq_f32( one, vmulq_f32( r2, vaddq_f32( c0, vmulq_f32( r2, vaddq_f32( c1, vmulq_f32( r2, c4 ) ) ) ) ) );
+                    float32x4_t xf = vmulq_f32( x, f ), yf = vmulq_f32( y, f );
+                    if( ! brown )
+                        x = xf, y = yf;
+                    float32x4_t xy2 = vmulq_n_f32( vmulq_f32( x, y ), 2.f );
+                    float32x4_t dx = vaddq_f32( xf, vaddq_f32( vmulq_n_f32( xy2, texture.coeffs[2] ),
+                                                               vmulq_n_f32( vaddq_f32( r2, vmulq_n_f32( vmulq_f32( x, x ), 2.f ) ), texture.coeffs[3] ) ) );
+                    float32x4_t dy = vaddq_f32( yf, vaddq_f32( vmulq_n_f32( xy2, texture.coeffs[3] ),
+                                                               vmulq_n_f32( vaddq_f32( r2, vmulq_n_f32( vmulq_f32( y, y ), 2.f ) ), texture.coeffs[2] ) ) );
+                    x = dx;
+                    y = dy;
+                }
+                uint32x4_t valid = vmvnq_u32( vceqq_f32( z, zero ) );
+                float32x4_t s = vaddq_f32( vmulq_n_f32( x, fx ), ppx );
+                float32x4_t t = vaddq_f32( vmulq_n_f32( y, fy ), ppy );
+                float32x4x2_t st = { { vreinterpretq_f32_u32( vandq_u32( vreinterpretq_u32_f32( s ), valid ) ),
+                                       vreinterpretq_f32_u32( vandq_u32( vreinterpretq_u32_f32( t ), valid ) ) } };
+                vst2q_f32( texcoords + 2 * i, st );
+            }
+            return i;
+        }
+#else
+        int neon_to_disparity( float *, const uint16_t *, int, float ) { return 0; }
+        int neon_to_depth( uint16_t *, const float *, int, float ) { return 0; }
+        int neon_point_moments( double *, const uint16_t *, const float *, const float *, int, float ) { return 0; }  // no doubles
+        int neon_texture_map( float *, float *, const uint16_t *, const texture_mapping &, int, float ) { return 0; }
+#endif
+
+        int neon_hdr_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count )
+        {
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                uint16x8_t a = vld1q_u16( d0 + i );
+                vst1q_u16( out + i, vbslq_u16( vceqq_u16( a, vdupq_n_u16( 0 ) ), vld1q_u16( d1 + i ), a ) );
+            }
+            return i;
+        }
+
+        inline uint16x8_t load_ir( const uint8_t * p ) { return vmovl_u8( vld1_u8( p ) ); }
+        inline uint16x8_t load_ir( const uint16_t * p ) { return vld1q_u16( p ); }
+
+        template< class T >
+        int neon_hdr_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                            const T * ir0, const T * ir1, int count, int ir_min, int ir_max )
+        {
+            const uint16x8_t lo = vdupq_n_u16( uint16_t( ir_min ) ), hi = vdupq_n_u16( uint16_t( ir_max ) );
+            const uint16x8_t zero = vdupq_n_u16( 0 );
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                uint16x8_t a = vld1q_u16( d0 + i ), b = vld1q_u16( d1 + i );
+                uint16x8_t x0 = load_ir( ir0 + i ), x1 = load_ir( ir1 + i );
+                uint16x8_t use_a = vandq_u16( vmvnq_u16( vceqq_u16( a, zero ) ), vandq_u16( vcgtq_u16( x0, lo ), vcltq_u16( x0, hi ) ) );
+                uint16x8_t use_b = vandq_u16( vmvnq_u16( vceqq_u16( b, zero ) ), vandq_u16( vcgtq_u16( x1, lo ), vcltq_u16( x1, hi ) ) );
+                vst1q_u16( out + i, vbslq_u16( use_a, a, vandq_u16( use_b, b ) ) );
+            }
+            return i;
+        }
+
+        inline bool any( uint64x2_t m ) { return ( vgetq_lane_u64( m, 0 ) | vgetq_lane_u64( m, 1 ) ) != 0; }
+
+        int neon_find_hole( const uint16_t * data, int count )
+        {
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+                if( any( vreinterpretq_u64_u16( vceqq_u16( vld1q_u16( data + i ), vdupq_n_u16( 0 ) ) ) ) )
+                    break;
+            return i;
+        }
+
+        int neon_find_hole( const uint32_t * data, int count )
+        {
+            int i = 0;
+            for( ; i + 4 <= count; i += 4 )
+                if( any( vreinterpretq_u64_u32( vceqq_u32( vld1q_u32( data + i ), vdupq_n_u32( 0 ) ) ) ) )
+                    break;
+            return i;
+        }
+#else
+        int neon_threshold( uint16_t *, const uint16_t *, int, float, float, float ) { return 0; }
+        int neon_to_meters( float *, const uint16_t *, int, float ) { return 0; }
+        int neon_to_disparity( float *, const uint16_t *, int, float ) { return 0; }
+        int neon_to_depth( uint16_t *, const float *, int, float ) { return 0; }
+        int neon_hdr_merge( uint16_t *, const uint16_t *, const uint16_t *, int ) { return 0; }
+        template< class T > int neon_hdr_merge( uint16_t *, const uint16_t *, const uint16_t *, const T *, const T *, int, int, int ) { return 0; }
+        int neon_find_hole( const uint16_t *, int ) { return 0; }
+        int neon_find_hole( const uint32_t *, int ) { return 0; }
+        int neon_point_moments( double *, const uint16_t *, const float *, const float *, int, float ) { return 0; }
+        int neon_texture_map( float *, float *, const uint16_t *, const texture_mapping &, int, float ) { return 0; }
+#endif
+
+        isa best_isa()
+        {
+            static const isa best = is_supported( isa::avx2 ) ? isa::avx2
+                                  : is_supported( isa::ssse3 ) ? isa::ssse3
+                                  : is_supported( isa::neon ) ? isa::neon
+                                                              : isa::scalar;
+            return best;
+        }
+    }  // namespace
+
+    bool is_supported( isa which )
+    {
+        if( which == isa::avx2 && ! avx2_compiled() )
+            return false;
+        return cpu_supports( which );
+    }
+
+    void threshold( isa which, uint16_t * out, const uint16_t * depth, int count, float units, float min, float max )
+    {
+        int done = 0;
+        switch( which )
+        {
+        case isa::avx2: done = threshold_avx2( out, depth, count, units, min, max ); break;
+        case isa::ssse3: done = ssse3_threshold( out, depth, count, units, min, max ); break;
+        case isa::neon: done = neon_threshold( out, depth, count, units, min, max ); break;
+        case isa::scalar: break;
+        }
+        scalar_threshold( out, depth, done, count, units, min, max );
+    }
+
+    void to_meters( isa which, float * out, const uint16_t * depth, int count, float units )
+    {
+        int done = 0;
+        switch( which )
+        {
+        case isa::avx2: done = to_meters_avx2( out, depth, count, units ); break;
+        case isa::ssse3: done = ssse3_to_meters( out, depth, count, units ); break;
+        case isa::neon: done = neon_to_meters( out, depth, count, units ); break;
+        case isa::scalar: break;
+        }
+        scalar_to_meters( out, depth, done, count, units );
+    }
+
+    void to_disparity( isa which, float * out, const uint16_t * depth, int count, float factor )
+    {
+        int done = 0;
+        switch( which )
+        {
+        case isa::avx2: done = to_disparity_avx2( out, depth, count, factor ); break;
+        case isa::ssse3: done = ssse3_to_disparity( out, depth, count, factor ); break;
+        case isa::neon: done = neon_to_disparity( out, depth, count, factor ); break;
+        case isa::scalar: break;
+        }
+        scalar_to_disparity( out, depth, done, count, factor );
+    }
+
+    void to_depth( isa which, uint16_t * out, const float * disparity, int count, float factor )
+    {
+        int done = 0;
+        switch( which )
+        {
+        case isa::avx2: done = to_depth_avx2( out, disparity, count, factor ); break;
+        case isa::ssse3: done = ssse3_to_depth( out, disparity, count, factor ); break;
+        case isa::neon: done = neon_to_depth( out, disparity, count, factor ); break;
+        case isa::scalar: break;
+        }
+        scalar_to_depth( out, disparity, done, count, factor );
+    }
+
+    void hdr_merge( isa which, uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count )
+    {
+        int done = 0;
+        switch( which )
+        {
+        case isa::avx2: done = hdr_merge_avx2( out, d0, d1, count ); break;
+        case isa::ssse3: done = ssse3_hdr_merge( out, d0, d1, count ); break;
+        case isa::neon: done = neon_hdr_merge( out, d0, d1, count ); break;
+        case isa::scalar: break;
+        }
+        scalar_hdr_merge( out, d0, d1, done, count );
+    }
+
+    namespace
+    {
+        template< class T >
+        void hdr_merge_using_ir( isa which, uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                                 const T * ir0, const T * ir1, int count, int ir_min, int ir_max )
+        {
+            int done = 0;
+            switch( which )
+            {
+            case isa::avx2: done = hdr_merge_avx2( out, d0, d1, ir0, ir1, count, ir_min, ir_max ); break;
+            case isa::ssse3: done = ssse3_hdr_merge( out, d0, d1, ir0, ir1, count, ir_min, ir_max ); break;
+            case isa::neon: done = neon_hdr_merge( out, d0, d1, ir0, ir1, count, ir_min, ir_max ); break;
+            case isa::scalar: break;
+            }
+            scalar_hdr_merge( out, d0, d1, ir0, ir1, done, count, ir_min, ir_max );
+        }
+    }
+
+    void hdr_merge( isa which, uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                    const uint8_t * ir0, const uint8_t * ir1, int count, int ir_min, int ir_max )
+    {
+        hdr_merge_using_ir( which, out, d0, d1, ir0, ir1, count, ir_min, ir_max );
+    }
+
+    void hdr_merge( isa which, uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                    const uint16_t * ir0, const uint16_t * ir1, int count, int ir_min, int ir_max )
+    {
+        hdr_merge_using_ir( which, out, d0, d1, ir0, ir1, count, ir_min, ir_max );
+    }
+
+    int find_hole( isa which, const uint16_t * data, int count )
+    {
+        int done = 0;
+        switch( which )
+        {
+        case isa::avx2: done = find_hole_avx2( data, count ); break;
+        case isa::ssse3: done = ssse3_find_hole( data, count ); break;
+        case isa::neon: done = neon_find_hole( data, count ); break;
+        case isa::scalar: break;
+        }
+        return scalar_find_hole( data, done, count );
+    }
+
+    int find_hole( isa which, const uint32_t * data, int count )
+    {
+        int done = 0;
+        switch( which )
+        {
+        case isa::avx2: done = find_hole_avx2( data, count ); break;
+        case isa::ssse3: done = ssse3_find_hole( data, count ); break;
+        case isa::neon: done = neon_find_hole( data, count ); break;
+        case isa::scalar: break;
+        }
+        return scalar_find_hole( data, done, count );
+    }
+
+    void point_moments( isa which, double sums[10], const uint16_t * depth, const float * ray_x, const float * ray_y,
+                        int count, float units )
+    {
+        int done = 0;
+        switch( which )
+        {
+        case isa::avx2: done = point_moments_avx2( sums, depth, ray_x, ray_y, count, units ); break;
+        case isa::ssse3: done = ssse3_point_moments( sums, depth, ray_x, ray_y, count, units ); break;
+        case isa::neon: done = neon_point_moments( sums, depth, ray_x, ray_y, count, units ); break;
+        case isa::scalar: break;
+        }
+        scalar_point_moments( sums, depth, ray_x, ray_y, done, count, units );
+    }
+
+    void texture_map( isa which, float * vertices, float * texcoords, const uint16_t * depth,
+                      const texture_mapping & mapping, int count, float units )
+    {
+        int done = 0;
+        if( vectorized_distortion( mapping.texture.model ) )
+        {
+            switch( which )
+            {
+            case isa::avx2: done = texture_map_avx2( vertices, texcoords, depth, mapping, count, units ); break;
+            case isa::ssse3: done = ssse3_texture_map( vertices, texcoords, depth, mapping, count, units ); break;
+            case isa::neon: done = neon_texture_map( vertices, texcoords, depth, mapping, count, units ); break;
+            case isa::scalar: break;
+            }
+        }
+        scalar_texture_map( vertices, texcoords, depth, mapping, done, count, units );
+    }
+
+
+    void threshold( uint16_t * out, const uint16_t * depth, int count, float units, float min, float max )
+    {
+        threshold( best_isa(), out, depth, count, units, min, max );
+    }
+
+    void to_meters( float * out, const uint16_t * depth, int count, float units )
+    {
+        to_meters( best_isa(), out, depth, count, units );
+    }
+
+    void to_disparity( float * out, const uint16_t * depth, int count, float factor )
+    {
+        to_disparity( best_isa(), out, depth, count, factor );
+    }
+
+    void to_depth( uint16_t * out, const float * disparity, int count, float factor )
+    {
+        to_depth( best_isa(), out, disparity, count, factor );
+    }
+
+    void hdr_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count )
+    {
+        hdr_merge( best_isa(), out, d0, d1, count );
+    }
+
+    void hdr_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                    const uint8_t * ir0, const uint8_t * ir1, int count, int ir_min, int ir_max )
+    {
+        hdr_merge( best_isa(), out, d0, d1, ir0, ir1, count, ir_min, ir_max );
+    }
+
+    void hdr_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                    const uint16_t * ir0, const uint16_t * ir1, int count, int ir_min, int ir_max )
+    {
+        hdr_merge( best_isa(), out, d0, d1, ir0, ir1, count, ir_min, ir_max );
+    }
+
+    int find_hole( const uint16_t * data, int count )
+    {
+        return find_hole( best_isa(), data, count );
+    }
+
+    int find_hole( const uint32_t * data, int count )
+    {
+        return find_hole( best_isa(), data, count );
+    }
+
+    void point_moments( double sums[10], const uint16_t * depth, const float * ray_x, const float * ray_y,
+                        int count, float units )
+    {
+        point_moments( best_isa(), sums, depth, ray_x, ray_y, count, units );
+    }
+
+    void texture_map( float * vertices, float * texcoords, const uint16_t * depth, const texture_mapping & mapping,
+                      int count, float units )
+    {
+        texture_map( best_isa(), vertices, texcoords, depth, mapping, count, units );
+    }
+}  // namespace depth_kernels
+}
@@ -0,0 +1,116 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "simd-isa.h"
+
+#include <librealsense2/h/rs_types.h>
+
+#include <cstdint>
+
+
+namespace librealsense
+{
+    // The per-pixel loops of the depth post-processing filters. Each kernel produces exactly what the
+    // scalar loop it replaces did, with whichever instruction set is best for the CPU (selected once,
+    // at runtime). 'out' may be the same as the input, for filters that process in place.
+    //
+    namespace depth_kernels
+    {
+        // Depth that is not within [min, max] meters is zeroed
+        void threshold( uint16_t * out, const uint16_t * depth, int count, float units, float min, float max );
+
+        // Depth to meters
+        void to_meters( float * out, const uint16_t * depth, int count, float units );
+
+        // Depth to disparity: factor / depth, or 0 for no depth
+        void to_disparity( float * out, const uint16_t * depth, int count, float factor );
+
+        // Disparity to depth: factor / disparity, rounded, or 0 where the disparity is not a normal float
+        void to_depth( uint16_t * out, const float * disparity, int count, float factor );
+
+        // Merge of two exposures: the first depth, where there is any, or the second
+        void hdr_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count );
+
+        // Same, but only where the matching IR value is within (ir_min, ir_max)
+        void hdr_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                        const uint8_t * ir0, const uint8_t * ir1, int count, int ir_min, int ir_max );
+        void hdr_merge( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                        const uint16_t * ir0, const uint16_t * ir1, int count, int ir_min, int ir_max );
+
+        // Index of the first zero (a hole), or count if there is none. Hole filling is a recurrence, so
+        // only the search for the next hole can be vectorized. Float data is searched by bit pattern.
+        int find_hole( const uint16_t * data, int count );
+        int find_hole( const uint32_t * data, int count );
+
+        // Adds the moments of the points of the depth pixels to 'sums': each pixel with depth is a point
+        // along its ray (the point it would be at 1 meter), and sums[] += { 1, x, y, z, xx, xy, xz, yy,
+        // yz, zz }. The sums are in double, so the vector versions differ only in the order of additions.
+        void point_moments( double sums[10], const uint16_t * depth, const float * ray_x, const float * ray_y,
+                            int count, float units );
+
+        // What maps depth pixels to another sensor's image, computed once per calibration: each pixel's ray
+        // (its point at 1 meter), and the same ray rotated into the other sensor, so that a pixel's point is
+        // at z * to + translation there
+        struct texture_mapping
+        {
+            const float * ray_x;
+            const float * ray_y;
+            const float * to_x;
+            const float * to_y;
+            const float * to_z;
+            float translation[3];
+            rs2_intrinsics texture;
+        };
+
+        // Deprojection, transformation, projection and texture coordinates in one pass: the vertices are
+        // the points of the depth, and the texture coordinates those of their pixels in the texture (as
+        // rs2_project_point_to_pixel has them), normalized to its size, or 0 where there is no depth.
+        // Only the Brown-Conrady distortion models, or none, are vectorized.
+        void texture_map( float * vertices, float * texcoords, const uint16_t * depth, const texture_mapping & mapping,
+                          int count, float units );
+
+
+        // Each of the implementations, for testing against each other
+        using isa = simd_isa;
+
+        // Whether the implementation was compiled in and can run on this CPU
+        bool is_supported( isa );
+
+        void threshold( isa, uint16_t * out, const uint16_t * depth, int count, float units, float min, float max );
+        void to_meters( isa, float * out, const uint16_t * depth, int count, float units );
+        void to_disparity( isa, float * out, const uint16_t * depth, int count, float factor );
+        void to_depth( isa, uint16_t * out, const float * disparity, int count, float factor );
+        void hdr_merge( isa, uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count );
+        void hdr_merge( isa, uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                        const uint8_t * ir0, const uint8_t * ir1, int count, int ir_min, int ir_max );
+        void hdr_merge( isa, uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                        const uint16_t * ir0, const uint16_t * ir1, int count, int ir_min, int ir_max );
+        int find_hole( isa, const uint16_t * data, int count );
+        int find_hole( isa, const uint32_t * data, int count );
+        void point_moments( isa, double sums[10], const uint16_t * depth, const float * ray_x, const float * ray_y,
+                            int count, float units );
+        void texture_map( isa, float * vertices, float * texcoords, const uint16_t * depth,
+                          const texture_mapping & mapping, int count, float units );
+
+        // Implemented in depth-kernels-avx2.cpp, which is compiled with AVX2 enabled when the compiler
+        // allows it: each handles as many pixels as fit in whole vectors, and returns how many it did
+        bool avx2_compiled();
+        int threshold_avx2( uint16_t * out, const uint16_t * depth, int count, float units, float min, float max );
+        int to_meters_avx2( float * out, const uint16_t * depth, int count, float units );
+        int to_disparity_avx2( float * out, const uint16_t * depth, int count, float factor );
+        int to_depth_avx2( uint16_t * out, const float * disparity, int count, float factor );
+        int hdr_merge_avx2( uint16_t * out, const uint16_t * d0, const uint16_t * d1, int count );
+        int hdr_merge_avx2( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                            const uint8_t * ir0, const uint8_t * ir1, int count, int ir_min, int ir_max );
+        int hdr_merge_avx2( uint16_t * out, const uint16_t * d0, const uint16_t * d1,
+                            const uint16_t * ir0, const uint16_t * ir1, int count, int ir_min, int ir_max );
+        int find_hole_avx2( const uint16_t * data, int count );
+        int find_hole_avx2( const uint32_t * data, int count );
+        int point_moments_avx2( double sums[10], const uint16_t * depth, const float * ray_x, const float * ray_y,
+                                int count, float units );
+        int texture_map_avx2( float * vertices, float * texcoords, const uint16_t * depth,
+                              const texture_mapping & mapping, int count, float units );
+    }
+}
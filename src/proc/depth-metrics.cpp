@@ -0,0 +1,319 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+//
+// Plane Fit follows http://www.ilikebigbits.com/blog/2015/3/2/plane-from-points, as in the Depth Quality Tool
+
+#include "option.h"
+#include "environment.h"
+#include "software-sensor.h"
+#include <src/depth-sensor.h>
+#include "proc/synthetic-stream.h"
+#include "proc/depth-metrics.h"
+#include "proc/depth-kernels.h"
+
+#include <librealsense2/hpp/rs_sensor.hpp>
+#include <librealsense2/hpp/rs_processing.hpp>
+#include <librealsense2/rsutil.h>
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace librealsense
+{
+    namespace
+    {
+        struct plane
+        {
+            float a, b, c, d;
+        };
+
+        // From the sums of { 1, x, y, z, xx, xy, xz, yy, yz, zz }; false if the points do not span a plane
+        bool plane_from_moments( double const s[10], plane & p )
+        {
+            double const n = s[0];
+            float const cx = float( s[1] / n ), cy = float( s[2] / n ), cz = float( s[3] / n );
+
+            // Sums of the products of the points less the centroid
+            double const xx = s[4] - s[1] * s[1] / n;
+            double const xy = s[5] - s[1] * s[2] / n;
+            double const xz = s[6] - s[1] * s[3] / n;
+            double const yy = s[7] - s[2] * s[2] / n;
+            double const yz = s[8] - s[2] * s[3] / n;
+            double const zz = s[9] - s[3] * s[3] / n;
+
+            double const det_x = yy * zz - yz * yz;
+            double const det_y = xx * zz - xz * xz;
+            double const det_z = xx * yy - xy * xy;
+
+            // Unlike sums of centered points, these are not exactly zero when the points are on a line: anything
+            // within their rounding is as good as zero
+            double const det_max = std::max( { det_x, det_y, det_z } );
+            double const trace = xx + yy + zz;
+            if( det_max <= 1e-9 * trace * trace )
+                return false;
+
+            float dir[3];
+            if( det_max == det_x )
+            {
+                dir[0] = 1;
+                dir[1] = static_cast< float >( ( xz * yz - xy * zz ) / det_x );
+                dir[2] = static_cast< float >( ( xy * yz - xz * yy ) / det_x );
+            }
+            else if( det_max == det_y )
+            {
+                dir[0] = static_cast< float >( ( yz * xz - xy * zz ) / det_y );
+                dir[1] = 1;
+                dir[2] = static_cast< float >( ( xy * xz - yz * xx ) / det_y );
+            }
+            else
+            {
+                dir[0] = static_cast< float >( ( yz * xy - xz * yy ) / det_z );
+                dir[1] = static_cast< float >( ( xz * xy - yz * xx ) / det_z );
+                dir[2] = 1;
+            }
+            float const length = std::sqrt( dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2] );
+            p.a = dir[0] / length;
+            p.b = dir[1] / length;
+            p.c = dir[2] / length;
+            p.d = -( p.a * cx + p.b * cy + p.c * cz );
+            return true;
+        }
+
+        inline float length( float x, float y, float z )
+        {
+            return std::sqrt( x * x + y * y + z * z );
+        }
+    }
+
+    void plane_metrics::set_geometry( rs2_intrinsics const & intrinsics, region roi )
+    {
+        roi.min_x = std::max( roi.min_x, 0 );
+        roi.min_y = std::max( roi.min_y, 0 );
+        roi.max_x = std::max( std::min( roi.max_x, intrinsics.width ), roi.min_x );
+        roi.max_y = std::max( std::min( roi.max_y, intrinsics.height ), roi.min_y );
+        _intrinsics = intrinsics;
+        _roi = roi;
+
+        size_t const area = size_t( roi.max_x - roi.min_x ) * ( roi.max_y - roi.min_y );
+        _ray_x.resize( area );
+        _ray_y.resize( area );
+        _deviations.clear();
+        _deviations.reserve( area );
+
+        size_t i = 0;
+        for( int y = roi.min_y; y < roi.max_y; ++y )
+            for( int x = roi.min_x; x < roi.max_x; ++x, ++i )
+            {
+                float pixel[2] = { float( x ), float( y ) };
+                float ray[3];
+                rs2_deproject_pixel_to_point( ray, &intrinsics, pixel, 1.f );
+                _ray_x[i] = ray[0];
+                _ray_y[i] = ray[1];
+            }
+
+        // The plane fit is checked against ground truth where it meets the center ray
+        float center[2] = { intrinsics.width / 2.f, intrinsics.height / 2.f };
+        float ray[3];
+        rs2_deproject_pixel_to_point( ray, &intrinsics, center, 1.f );
+        _center_ray[0] = ray[0];
+        _center_ray[1] = ray[1];
+    }
+
+    void plane_metrics::measure( rs2_depth_metrics & metrics, const uint16_t * depth, int stride, float units,
+                                 float baseline_mm, float ground_truth_mm )
+    {
+        metrics.fill_rate = 0.f;
+        metrics.plane_fit = 0;
+        metrics.distance_mm = metrics.angle = 0.f;
+        metrics.plane_fit_rms_mm = metrics.plane_fit_rms = metrics.subpixel_rms = metrics.z_accuracy = 0.f;
+
+        int const width = _roi.max_x - _roi.min_x;
+        int const height = _roi.max_y - _roi.min_y;
+        if( width <= 0 || height <= 0 )
+            return;
+
+        double sums[10] = {};
+        for( int y = 0; y < height; ++y )
+            depth_kernels::point_moments( sums,
+                                          depth + ( _roi.min_y + y ) * stride + _roi.min_x,
+                                          _ray_x.data() + y * width,
+                                          _ray_y.data() + y * width,
+                                          width,
+                                          units );
+        metrics.fill_rate = float( sums[0] / ( double( width ) * height ) * 100 );
+
+        plane p;
+        if( sums[0] < 3 || ! plane_from_moments( sums, p ) )
+            return;
+
+        metrics.plane_fit = 1;
+        // The distance from the camera to the plane, along its normal, is in D; the angle in C
+        metrics.distance_mm = -p.d * 1000;
+        metrics.angle = float( std::acos( std::abs( p.c ) ) * 180. / 3.14159265358979323846 );
+
+        // Deviation of each point from the plane, and of its disparity from that of its projection on it
+        float const bf_factor = baseline_mm * _intrinsics.fx * units;
+        _deviations.clear();
+        for( int y = 0; y < height; ++y )
+        {
+            auto row = depth + ( _roi.min_y + y ) * stride + _roi.min_x;
+            auto ray_x = _ray_x.data() + y * width;
+            auto ray_y = _ray_y.data() + y * width;
+            for( int x = 0; x < width; ++x )
+            {
+                if( ! row[x] )
+                    continue;
+                float const z = units * row[x];
+                float const px = ray_x[x] * z, py = ray_y[x] * z;
+                float const dist2plane = p.a * px + p.b * py + p.c * z + p.d;
+                float disparity = 0.f;
+                if( bf_factor > 0 )
+                    disparity = bf_factor / length( px, py, z )
+                              - bf_factor / length( px - dist2plane * p.a, py - dist2plane * p.b, z - dist2plane * p.c );
+                _deviations.push_back( { z, dist2plane * 1000, disparity } );
+            }
+        }
+
+        // Remove outliers: the 0.5% closest and the 0.5% farthest
+        auto by_z = []( deviation const & a, deviation const & b ) { return a.z < b.z; };
+        size_t const outliers = _deviations.size() / 200;
+        auto const first = _deviations.begin() + outliers;
+        auto const last = _deviations.end() - outliers;
+        std::nth_element( _deviations.begin(), first, _deviations.end(), by_z );
+        std::nth_element( first, last, _deviations.end(), by_z );
+
+        double distance_sqr_sum = 0, disparity_sqr_sum = 0;
+        for( auto it = first; it != last; ++it )
+        {
+            distance_sqr_sum += double( it->distance_mm ) * it->distance_mm;
+            disparity_sqr_sum += double( it->disparity ) * it->disparity;
+        }
+        auto const n = double( last - first );
+        metrics.plane_fit_rms_mm = float( std::sqrt( distance_sqr_sum / n ) );
+        metrics.plane_fit_rms = 100.f * ( metrics.plane_fit_rms_mm / metrics.distance_mm );
+        metrics.subpixel_rms = float( std::sqrt( disparity_sqr_sum / n ) );
+
+        if( ground_truth_mm > 0 )
+        {
+            // Where the center ray meets the plane; the tool searches for it up to 1000m
+            float const along_ray = p.a * _center_ray[0] + p.b * _center_ray[1] + p.c;
+            float pivot_z = along_ray != 0 ? -p.d / along_ray : 0.f;
+            if( pivot_z < 0 || pivot_z > 1000 )
+                pivot_z = 0;
+            float const offset_mm = pivot_z * 1000 - ground_truth_mm;
+
+            // The GT error of each point is the offset plus its distance from the plane
+            auto const median = first + ( last - first ) / 2;
+            std::nth_element( first, median, last, []( deviation const & a, deviation const & b ) {
+                return a.distance_mm < b.distance_mm;
+            } );
+            metrics.z_accuracy = 100.f * ( ( offset_mm + median->distance_mm ) / ground_truth_mm );
+        }
+    }
+
+
+    depth_metrics::depth_metrics()
+        : stream_filter_processing_block( "Depth Metrics" )
+    {
+        _stream_filter.format = RS2_FORMAT_Z16;
+        _stream_filter.stream = RS2_STREAM_DEPTH;
+    }
+
+    void depth_metrics::set_roi( int min_x, int min_y, int max_x, int max_y )
+    {
+        if( min_x < 0 || min_y < 0 || max_x <= min_x || max_y <= min_y )
+            throw invalid_value_exception( "invalid ROI" );
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        _roi = { min_x, min_y, max_x, max_y };
+        _roi_set = true;
+    }
+
+    void depth_metrics::set_ground_truth( float mm )
+    {
+        if( ! ( mm >= 0 ) )
+            throw invalid_value_exception( "invalid ground truth" );
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        _ground_truth_mm = mm;
+    }
+
+    rs2_depth_metrics depth_metrics::get_metrics() const
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        return _metrics;
+    }
+
+    void depth_metrics::update_stream( const rs2::frame & f )
+    {
+        _source_stream_profile = f.get_profile();
+
+        // Check if the new frame originated from stereo-based depth sensor
+        // and retrieve the stereo baseline parameter, for the subpixel RMS
+        auto snr = ( (frame_interface *)f.get() )->get_sensor().get();
+        _stereo_baseline_mm = 0.f;
+
+        // Playback sensor
+        if( auto a = As< librealsense::extendable_interface >( snr ) )
+        {
+            librealsense::depth_stereo_sensor * ptr;
+            if( a->extend_to( TypeToExtension< librealsense::depth_stereo_sensor >::value, (void **)&ptr ) )
+                _stereo_baseline_mm = ptr->get_stereo_baseline_mm();
+        }
+        else if( auto depth_emul = As< librealsense::software_sensor >( snr ) )
+        {
+            // Software device can obtain these options via Options interface
+            if( depth_emul->supports_option( RS2_OPTION_STEREO_BASELINE ) )
+                _stereo_baseline_mm = depth_emul->get_option( RS2_OPTION_STEREO_BASELINE ).query() * 1000.f;
+        }
+        else if( auto dss = As< librealsense::depth_stereo_sensor >( snr ) )  // Live sensor
+        {
+            _stereo_baseline_mm = dss->get_stereo_baseline_mm();
+        }
+    }
+
+    rs2::frame depth_metrics::process_frame( const rs2::frame_source & source, const rs2::frame & f )
+    {
+        auto df = f.as< rs2::depth_frame >();
+        if( ! df )
+            return f;
+
+        plane_metrics::region roi;
+        bool roi_set;
+        float ground_truth_mm;
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            roi = _roi;
+            roi_set = _roi_set;
+            ground_truth_mm = _ground_truth_mm;
+        }
+        int const width = df.get_width(), height = df.get_height();
+        if( ! roi_set )
+            roi = { int( width * 0.3f ), int( height * 0.3f ), int( width * 0.7f ), int( height * 0.7f ) };
+
+        if( f.get_profile().get() != _source_stream_profile.get() || roi != _geometry_roi )
+        {
+            update_stream( f );
+            auto intrinsics = f.get_profile().as< rs2::video_stream_profile >().get_intrinsics();
+            intrinsics.width = width;
+            intrinsics.height = height;
+            _plane.set_geometry( intrinsics, roi );
+            _geometry_roi = roi;
+        }
+
+        rs2_depth_metrics metrics{};
+        metrics.frame_number = df.get_frame_number();
+        metrics.timestamp = df.get_timestamp();
+        _plane.measure( metrics,
+                        reinterpret_cast< const uint16_t * >( df.get_data() ),
+                        df.get_stride_in_bytes() / int( sizeof( uint16_t ) ),
+                        df.get_units(),
+                        _stereo_baseline_mm,
+                        ground_truth_mm );
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        _metrics = metrics;
+        return f;
+    }
+}
@@ -0,0 +1,95 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+
+#include <librealsense2/h/rs_processing.h>
+
+#include <mutex>
+#include <vector>
+
+
+namespace librealsense
+{
+    // The metrics of the Depth Quality Tool, for a flat target facing the camera: a plane is fit to the
+    // points of the region of interest, and the metrics describe how the depth deviates from it.
+    // The points are never gathered: the plane comes from the moments of the points, which are summed
+    // (vectorized) straight from the depth, and only the deviations are kept, in buffers that are reused
+    // from frame to frame.
+    class plane_metrics
+    {
+    public:
+        struct region
+        {
+            int min_x, min_y, max_x, max_y;  // max exclusive
+
+            bool operator==( region const & other ) const
+            {
+                return min_x == other.min_x && min_y == other.min_y && max_x == other.max_x && max_y == other.max_y;
+            }
+            bool operator!=( region const & other ) const { return ! ( *this == other ); }
+        };
+
+        // The rays of the ROI pixels, computed once for the intrinsics and ROI. The ROI is clipped to the
+        // image.
+        void set_geometry( rs2_intrinsics const & intrinsics, region roi );
+        region get_roi() const { return _roi; }
+
+        // Measures depth of the geometry last set, 'stride' in pixels. Without a baseline, there is no
+        // subpixel RMS; without ground truth, no Z accuracy.
+        void measure( rs2_depth_metrics & metrics, const uint16_t * depth, int stride, float units,
+                      float baseline_mm, float ground_truth_mm );
+
+    private:
+        struct deviation
+        {
+            float z;             // for removing outliers
+            float distance_mm;   // from the plane
+            float disparity;     // of the point, less that of its projection on the plane
+        };
+
+        rs2_intrinsics _intrinsics{};
+        region _roi{};
+        float _center_ray[2]{};         // of the image center
+        std::vector< float > _ray_x;    // per ROI pixel, row by row
+        std::vector< float > _ray_y;
+        std::vector< deviation > _deviations;
+    };
+
+
+    // Measures the depth quality of every frame, which is passed through as is. The metrics of the latest
+    // frame are available at any time, so the health of the depth can be tracked at full frame rate.
+    class depth_metrics : public stream_filter_processing_block
+    {
+    public:
+        depth_metrics();
+
+        // Max exclusive; when none is set, the center 40% of the frame, as the Depth Quality Tool does
+        void set_roi( int min_x, int min_y, int max_x, int max_y );
+
+        // Distance to the target, in mm, for Z accuracy; 0 for none
+        void set_ground_truth( float mm );
+
+        rs2_depth_metrics get_metrics() const;
+
+    protected:
+        rs2::frame process_frame( const rs2::frame_source & source, const rs2::frame & f ) override;
+
+    private:
+        void update_stream( const rs2::frame & f );
+
+        mutable std::mutex _mutex;  // for the settings and results, which are used from other threads
+        bool _roi_set = false;
+        plane_metrics::region _roi{};
+        float _ground_truth_mm = 0.f;
+        rs2_depth_metrics _metrics{};
+
+        plane_metrics _plane;
+        rs2::stream_profile _source_stream_profile;
+        plane_metrics::region _geometry_roi{};  // as requested, before clipping
+        float _stereo_baseline_mm = 0.f;
+    };
+    MAP_EXTENSION( RS2_EXTENSION_DEPTH_METRICS_FILTER, librealsense::depth_metrics );
+}
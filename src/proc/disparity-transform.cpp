@@ -10,6 +10,7 @@
 #include "core/video.h"
 #include "proc/synthetic-stream.h"
 #include "proc/disparity-transform.h"
+#include "proc/depth-kernels.h"
 #include "software-device.h"
 #include "environment.h"
 
@@ -57,10 +58,11 @@ namespace librealsense
         {
             auto src = f.as<rs2::video_frame>();
 
+            auto count = int(_width * _height);
             if (_transform_to_disparity)
-                convert<uint16_t, float>(src.get_data(), const_cast<void*>(tgt.get_data()));
+                depth_kernels::to_disparity((float*)tgt.get_data(), (const uint16_t*)src.get_data(), count, _d2d_convert_factor);
             else
-                convert<float, uint16_t>(src.get_data(), const_cast<void*>(tgt.get_data()));
+                depth_kernels::to_depth((uint16_t*)tgt.get_data(), (const float*)src.get_data(), count, _d2d_convert_factor);
         }
 
         return tgt;
@@ -24,32 +24,6 @@ namespace librealsense
     protected:
         rs2::frame prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source);
 
-        template<typename Tin, typename Tout>
-        void convert(const void* in_data, void* out_data)
-        {
-            static_assert((std::is_arithmetic<Tin>::value), "disparity transform requires numeric type for input data");
-            static_assert((std::is_arithmetic<Tout>::value), "disparity transform requires numeric type for output data");
-
-            auto in = reinterpret_cast<const Tin*>(in_data);
-            auto out = reinterpret_cast<Tout*>(out_data);
-
-            const bool fp = (std::is_floating_point<Tin>::value);
-            const float round = fp ? 0.5f : 0.f;
-
-            float input{};
-            //TODO SSE optimize
-            for (size_t i = 0; i < _height; i++)
-                for (size_t j = 0; j < _width; j++)
-                {
-                    input = *in;
-                    if (std::isnormal(input))
-                        *out++ = static_cast<Tout>((_d2d_convert_factor / input)+round);
-                    else
-                        *out++ = 0;
-                    in++;
-                }
-        }
-
     private:
         void    update_transformation_profile(const rs2::frame& f);
 
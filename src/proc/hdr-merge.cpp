@@ -2,6 +2,7 @@
 // Copyright(c) 2020 Intel Corporation. All Rights Reserved.
 
 #include "hdr-merge.h"
+#include "depth-kernels.h"
 #include <src/core/depth-frame.h>
 
 namespace librealsense
@@ -235,15 +236,7 @@ namespace librealsense
 
     void hdr_merge::merge_frames_using_only_depth(uint16_t* new_data, uint16_t* d0, uint16_t* d1, int width_height_prod) const
     {
-        for (int i = 0; i < width_height_prod; i++)
-        {
-            if (d0[i])
-                new_data[i] = d0[i];
-            else if (d1[i])
-                new_data[i] = d1[i];
-            else
-                new_data[i] = 0;
-        }
+        depth_kernels::hdr_merge(new_data, d0, d1, width_height_prod);
     }
 
     bool hdr_merge::should_ir_be_used_for_merging(const rs2::depth_frame& first_depth, const rs2::video_frame& first_ir,
@@ -6,6 +6,7 @@ Copyright(c) 2020 Intel Corporation. All Rights Reserved. */
 
 #include "synthetic-stream.h"
 #include "option.h"
+#include "depth-kernels.h"
 
 namespace librealsense
 {
@@ -39,8 +40,6 @@ namespace librealsense
         rs2::frame merging_algorithm(const rs2::frame_source& source, const rs2::frameset first_fs,
             const rs2::frameset second_fs, const bool use_ir) const;
         template <typename T>
-        bool is_infrared_valid(T ir_value, rs2_format ir_format) const;
-        template <typename T>
         void merge_frames_using_ir(uint16_t* new_data, uint16_t* d0, uint16_t* d1,
             const rs2::video_frame& first_ir, const rs2::video_frame& second_ir, int width_height_prod) const;
         void merge_frames_using_only_depth(uint16_t* new_data, uint16_t* d0, uint16_t* d1, int width_height_prod) const;
@@ -59,29 +58,20 @@ namespace librealsense
         auto i0 = (T*)first_ir.get_data();
         auto i1 = (T*)second_ir.get_data();
 
+        // Only IR values within (under, over) are valid
+        int under = 0, over = 0;
         auto format = first_ir.get_profile().format();
-
-        for (int i = 0; i < width_height_prod; i++)
+        if (format == RS2_FORMAT_Y8)
         {
-            if (is_infrared_valid<T>(i0[i], format) && d0[i])
-                new_data[i] = d0[i];
-            else if (is_infrared_valid<T>(i1[i], format) && d1[i])
-                new_data[i] = d1[i];
-            else
-                new_data[i] = 0;
+            under = IR_UNDER_SATURATED_VALUE_Y8;
+            over = IR_OVER_SATURATED_VALUE_Y8;
+        }
+        else if (format == RS2_FORMAT_Y16)
+        {
+            under = IR_UNDER_SATURATED_VALUE_Y16;
+            over = IR_OVER_SATURATED_VALUE_Y16;
         }
-    }
 
-    template <typename T>
-    bool hdr_merge::is_infrared_valid(T ir_value, rs2_format ir_format) const
-    {
-        bool result = false;
-        if (ir_format == RS2_FORMAT_Y8)
-            result = (ir_value > IR_UNDER_SATURATED_VALUE_Y8) && (ir_value < IR_OVER_SATURATED_VALUE_Y8);
-        else if (ir_format == RS2_FORMAT_Y16)
-            result = (ir_value > IR_UNDER_SATURATED_VALUE_Y16) && (ir_value < IR_OVER_SATURATED_VALUE_Y16);
-        else
-            result = false;
-        return result;
+        depth_kernels::hdr_merge(new_data, d0, d1, i0, i1, width_height_prod, under, over);
     }
 }
@@ -95,9 +95,10 @@ namespace librealsense
     rs2::frame hole_filling_filter::prepare_target_frame(const rs2::frame& f, const rs2::frame_source& source)
     {
         // Allocate and copy the content of the input data to the target
-        rs2::frame tgt = source.allocate_video_frame(_target_stream_profile, f, int(_bpp), int(_width), int(_height), int(_stride), _extension_type);
+        rs2::frame tgt = allocate_output_frame(source, _target_stream_profile, f, int(_bpp), int(_width), int(_height), int(_stride), _extension_type);
 
-        memmove(const_cast<void*>(tgt.get_data()), f.get_data(), _current_frm_size_pixels * _bpp);
+        if (tgt.get() != f.get())
+            memmove(const_cast<void*>(tgt.get_data()), f.get_data(), _current_frm_size_pixels * _bpp);
         return tgt;
     }
 
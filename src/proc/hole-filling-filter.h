@@ -3,6 +3,8 @@
 // Enhancing the input video frame by filling missing data.
 #pragma once
 
+#include "depth-kernels.h"
+
 #include <rsutils/string/from.h>
 
 namespace librealsense
@@ -50,67 +52,63 @@ namespace librealsense
             }
         }
 
-        // Implementations of the hole-filling methods
+        // Implementations of the hole-filling methods. Each hole depends on the holes filled before
+        // it, so only the search for the next hole is vectorized; valid pixels are skipped in bulk.
+        // Float data is empty when all its bits are zero.
+        static bool is_empty(const uint16_t* p) { return !*p; }
+        static bool is_empty(const float* p) { return !*((int *)p); }
+
+        // The first hole in row[from, width), or width if there is none
+        static size_t next_hole(const uint16_t* row, size_t from, size_t width)
+        {
+            return from + depth_kernels::find_hole(row + from, int(width - from));
+        }
+        static size_t next_hole(const float* row, size_t from, size_t width)
+        {
+            return from + depth_kernels::find_hole(reinterpret_cast<const uint32_t*>(row + from), int(width - from));
+        }
+
         template<typename T>
         inline void holes_fill_left(T* image_data, size_t width, size_t height, size_t stride)
         {
-            std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
-            std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
-            auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
-
             T* p = image_data;
 
-            for (size_t j = 0; j < height; ++j)
+            for (size_t j = 0; j < height; ++j, p += width)
             {
-                ++p;
-                for (size_t i = 1; i < width; ++i)
-                {
-                    if (empty(p))
-                        *p = *(p - 1);
-                    ++p;
-                }
+                for (size_t i = next_hole(p, 1, width); i < width; i = next_hole(p, i + 1, width))
+                    p[i] = p[i - 1];
             }
         }
 
         template<typename T>
         inline void holes_fill_farest(T* image_data, size_t width, size_t height, size_t stride)
         {
-            std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
-            std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
-            auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
-
             T tmp = 0;
             T * p = image_data + width;
             T * q = nullptr;
-            for (int j = 1; j < height - 1; ++j)
+            for (size_t j = 1; j + 1 < height; ++j, p += width)
             {
-                ++p;
-                for (size_t i = 1; i < width; ++i)
+                for (size_t i = next_hole(p, 1, width); i < width; i = next_hole(p, i + 1, width))
                 {
-                    if (empty(p))
-                    {
-                        tmp = *(p - width);
+                    tmp = *(p + i - width);
 
-                        q = p - width - 1;
-                        if (*q > tmp)
-                            tmp = *q;
+                    q = p + i - width - 1;
+                    if (*q > tmp)
+                        tmp = *q;
 
-                        q = p - 1;
-                        if (*q > tmp)
-                            tmp = *q;
+                    q = p + i - 1;
+                    if (*q > tmp)
+                        tmp = *q;
 
-                        q = p + width - 1;
-                        if (*q > tmp)
-                            tmp = *q;
+                    q = p + i + width - 1;
+                    if (*q > tmp)
+                        tmp = *q;
 
-                        q = p + width;
-                        if (*q > tmp)
-                            tmp = *q;
+                    q = p + i + width;
+                    if (*q > tmp)
+                        tmp = *q;
 
-                        *p = tmp;
-                    }
-
-                    p++;
+                    p[i] = tmp;
                 }
             }
         }
@@ -118,42 +116,32 @@ namespace librealsense
         template<typename T>
         inline void holes_fill_nearest(T* image_data, size_t width, size_t height, size_t stride)
         {
-            std::function<bool(T*)> fp_oper = [](T* ptr) { return !*((int *)ptr); };
-            std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
-            auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
-
             T tmp = 0;
             T * p = image_data + width;
             T * q = nullptr;
-            for (int j = 1; j < height - 1; ++j)
+            for (size_t j = 1; j + 1 < height; ++j, p += width)
             {
-                ++p;
-                for (size_t i = 1; i < width; ++i)
+                for (size_t i = next_hole(p, 1, width); i < width; i = next_hole(p, i + 1, width))
                 {
-                    if (empty(p))
-                    {
-                        tmp = *(p - width);
-
-                        q = p - width - 1;
-                        if (!empty(q) && (*q < tmp))
-                            tmp = *q;
+                    tmp = *(p + i - width);
 
-                        q = p - 1;
-                        if (!empty(q) && (*q < tmp))
-                            tmp = *q;
+                    q = p + i - width - 1;
+                    if (!is_empty(q) && (*q < tmp))
+                        tmp = *q;
 
-                        q = p + width - 1;
-                        if (!empty(q) && (*q < tmp))
-                            tmp = *q;
+                    q = p + i - 1;
+                    if (!is_empty(q) && (*q < tmp))
+                        tmp = *q;
 
-                        q = p + width;
-                        if (!empty(q) && (*q < tmp))
-                            tmp = *q;
+                    q = p + i + width - 1;
+                    if (!is_empty(q) && (*q < tmp))
+                        tmp = *q;
 
-                        *p = tmp;
-                    }
+                    q = p + i + width;
+                    if (!is_empty(q) && (*q < tmp))
+                        tmp = *q;
 
-                    p++;
+                    p[i] = tmp;
                 }
             }
         }
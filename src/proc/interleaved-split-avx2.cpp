@@ -0,0 +1,128 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "interleaved-split.h"
+
+#if defined __AVX2__ && ! defined ANDROID
+#include <immintrin.h>
+#endif
+
+
+namespace librealsense
+{
+namespace interleaved
+{
+#if defined __AVX2__ && ! defined ANDROID
+
+    namespace
+    {
+        inline __m256i load( const uint8_t * p ) { return _mm256_loadu_si256( reinterpret_cast< const __m256i * >( p ) ); }
+        inline void store( uint8_t * p, __m256i v ) { _mm256_storeu_si256( reinterpret_cast< __m256i * >( p ), v ); }
+        inline __m256i expand( __m256i x ) { return _mm256_or_si256( _mm256_slli_epi16( x, 6 ), _mm256_srli_epi16( x, 4 ) ); }
+
+        // Two 16-byte loads, one per lane
+        inline __m256i load2( const uint8_t * lo, const uint8_t * hi )
+        {
+            return _mm256_inserti128_si256( _mm256_castsi128_si256( _mm_loadu_si128( reinterpret_cast< const __m128i * >( lo ) ) ),
+                                            _mm_loadu_si128( reinterpret_cast< const __m128i * >( hi ) ),
+                                            1 );
+        }
+
+        // Given a and b, each with [left | right] halves in each lane, stores all the lefts and all the rights
+        inline void store_halves( __m256i a, __m256i b, uint8_t * left, uint8_t * right, bool expanded )
+        {
+            a = _mm256_permute4x64_epi64( a, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+            b = _mm256_permute4x64_epi64( b, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+            __m256i l = _mm256_permute2x128_si256( a, b, 0x20 );
+            __m256i r = _mm256_permute2x128_si256( a, b, 0x31 );
+            store( left, expanded ? expand( l ) : l );
+            store( right, expanded ? expand( r ) : r );
+        }
+
+        template< int STRIDE >
+        void avx2_y12i( uint8_t * const dest[], const uint8_t * source, int count, void ( *rest )( isa, uint8_t * const[], const uint8_t *, int ) )
+        {
+            const __m256i right_words = _mm256_setr_epi8(
+                0, 1, STRIDE, STRIDE + 1, 2 * STRIDE, 2 * STRIDE + 1, 3 * STRIDE, 3 * STRIDE + 1, -1, -1, -1, -1, -1, -1, -1, -1,
+                0, 1, STRIDE, STRIDE + 1, 2 * STRIDE, 2 * STRIDE + 1, 3 * STRIDE, 3 * STRIDE + 1, -1, -1, -1, -1, -1, -1, -1, -1 );
+            const __m256i left_words = _mm256_setr_epi8(
+                1, 2, STRIDE + 1, STRIDE + 2, 2 * STRIDE + 1, 2 * STRIDE + 2, 3 * STRIDE + 1, 3 * STRIDE + 2, -1, -1, -1, -1, -1, -1, -1, -1,
+                1, 2, STRIDE + 1, STRIDE + 2, 2 * STRIDE + 1, 2 * STRIDE + 2, 3 * STRIDE + 1, 3 * STRIDE + 2, -1, -1, -1, -1, -1, -1, -1, -1 );
+            const __m256i low_12 = _mm256_set1_epi16( 0x0fff );
+            // Each 16-byte load uses only 4 pixels: don't read past the end
+            int const overread = ( 16 - 4 * STRIDE + STRIDE - 1 ) / STRIDE;
+            int i = 0;
+            for( ; i + 16 + overread <= count; i += 16 )
+            {
+                // Pixels 0-3 and 8-11, then 4-7 and 12-15, so the unpack leaves them in order
+                __m256i a = load2( source + STRIDE * i, source + STRIDE * ( i + 8 ) );
+                __m256i b = load2( source + STRIDE * ( i + 4 ), source + STRIDE * ( i + 12 ) );
+                __m256i r = _mm256_unpacklo_epi64( _mm256_shuffle_epi8( a, right_words ), _mm256_shuffle_epi8( b, right_words ) );
+                __m256i l = _mm256_unpacklo_epi64( _mm256_shuffle_epi8( a, left_words ), _mm256_shuffle_epi8( b, left_words ) );
+                store( dest[0] + 2 * i, expand( _mm256_srli_epi16( l, 4 ) ) );
+                store( dest[1] + 2 * i, expand( _mm256_and_si256( r, low_12 ) ) );
+            }
+            if( i < count )
+            {
+                uint8_t * const tail[] = { dest[0] + 2 * i, dest[1] + 2 * i };
+                rest( isa::ssse3, tail, source + STRIDE * i, count - i );
+            }
+        }
+    }  // namespace
+
+    bool avx2_compiled() { return true; }
+
+    void split_y8i_avx2( uint8_t * const dest[], const uint8_t * source, int count )
+    {
+        const __m256i evens_odds = _mm256_setr_epi8( 0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
+                                                     0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15 );
+        int i = 0;
+        for( ; i + 32 <= count; i += 32 )
+            store_halves( _mm256_shuffle_epi8( load( source + 2 * i ), evens_odds ),
+                          _mm256_shuffle_epi8( load( source + 2 * i + 32 ), evens_odds ),
+                          dest[0] + i, dest[1] + i, false );
+        if( i < count )
+        {
+            uint8_t * const tail[] = { dest[0] + i, dest[1] + i };
+            split_y8i( isa::ssse3, tail, source + 2 * i, count - i );
+        }
+    }
+
+    void split_y12i_avx2( uint8_t * const dest[], const uint8_t * source, int count )
+    {
+        avx2_y12i< 3 >( dest, source, count, split_y12i );
+    }
+
+    void split_y12i_mipi_avx2( uint8_t * const dest[], const uint8_t * source, int count )
+    {
+        avx2_y12i< 4 >( dest, source, count, split_y12i_mipi );
+    }
+
+    void split_y16i_avx2( uint8_t * const dest[], const uint8_t * source, int count )
+    {
+        const __m256i split_words = _mm256_setr_epi8( 0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+                                                      0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15 );
+        int i = 0;
+        for( ; i + 16 <= count; i += 16 )
+            store_halves( _mm256_shuffle_epi8( load( source + 4 * i ), split_words ),
+                          _mm256_shuffle_epi8( load( source + 4 * i + 32 ), split_words ),
+                          dest[0] + 2 * i, dest[1] + 2 * i, true );
+        if( i < count )
+        {
+            uint8_t * const tail[] = { dest[0] + 2 * i, dest[1] + 2 * i };
+            split_y16i( isa::ssse3, tail, source + 4 * i, count - i );
+        }
+    }
+
+#else
+
+    // Not compiled with AVX2: is_supported( isa::avx2 ) is false, but just in case
+    bool avx2_compiled() { return false; }
+    void split_y8i_avx2( uint8_t * const dest[], const uint8_t * source, int count ) { split_y8i( isa::ssse3, dest, source, count ); }
+    void split_y12i_avx2( uint8_t * const dest[], const uint8_t * source, int count ) { split_y12i( isa::ssse3, dest, source, count ); }
+    void split_y12i_mipi_avx2( uint8_t * const dest[], const uint8_t * source, int count ) { split_y12i_mipi( isa::ssse3, dest, source, count ); }
+    void split_y16i_avx2( uint8_t * const dest[], const uint8_t * source, int count ) { split_y16i( isa::ssse3, dest, source, count ); }
+
+#endif
+}  // namespace interleaved
+}
@@ -0,0 +1,294 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "interleaved-split.h"
+#include "image.h"
+
+#if defined __SSSE3__ && ! defined ANDROID
+#define RS2_SPLIT_SSSE3
+#include <tmmintrin.h>
+#endif
+
+#if defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+#define RS2_SPLIT_NEON
+#include <arm_neon.h>
+#endif
+
+
+namespace librealsense
+{
+namespace interleaved
+{
+    namespace
+    {
+        struct y8i_pixel { uint8_t l, r; };
+        struct y12i_pixel { uint8_t rl : 8, rh : 4, ll : 4, lh : 8; int l() const { return lh << 4 | ll; } int r() const { return rh << 8 | rl; } };
+        struct y12i_pixel_mipi { uint8_t rl : 8, rh : 4, ll : 4, lh : 8, padding : 8; int l() const { return lh << 4 | ll; } int r() const { return rh << 8 | rl; } };
+        struct y16i_pixel { uint16_t left : 16, right : 16; };
+
+        // 10-bit data is converted to 16 bits by multiplying by 64 1/16, to efficiently approximate 65535/1023
+        inline uint16_t expand( int x ) { return uint16_t( x << 6 | x >> 4 ); }
+
+        typedef void ( *split_fn )( uint8_t * const dest[], const uint8_t * source, int count );
+
+        void scalar_y8i( uint8_t * const dest[], const uint8_t * source, int count )
+        {
+            split_frame( dest, count, reinterpret_cast< const y8i_pixel * >( source ),
+                []( const y8i_pixel & p ) -> uint8_t { return p.l; },
+                []( const y8i_pixel & p ) -> uint8_t { return p.r; } );
+        }
+
+        void scalar_y12i( uint8_t * const dest[], const uint8_t * source, int count )
+        {
+            split_frame( dest, count, reinterpret_cast< const y12i_pixel * >( source ),
+                []( const y12i_pixel & p ) -> uint16_t { return expand( p.l() ); },
+                []( const y12i_pixel & p ) -> uint16_t { return expand( p.r() ); } );
+        }
+
+        void scalar_y12i_mipi( uint8_t * const dest[], const uint8_t * source, int count )
+        {
+            split_frame( dest, count, reinterpret_cast< const y12i_pixel_mipi * >( source ),
+                []( const y12i_pixel_mipi & p ) -> uint16_t { return expand( p.l() ); },
+                []( const y12i_pixel_mipi & p ) -> uint16_t { return expand( p.r() ); } );
+        }
+
+        void scalar_y16i( uint8_t * const dest[], const uint8_t * source, int count )
+        {
+            split_frame( dest, count, reinterpret_cast< const y16i_pixel * >( source ),
+                []( const y16i_pixel & p ) -> uint16_t { return expand( p.left ); },
+                []( const y16i_pixel & p ) -> uint16_t { return expand( p.right ); } );
+        }
+
+        // The vector loops below return how many pixels they split; the rest are done here
+        void split_rest( split_fn scalar, int in_bytes, int out_bytes,
+                         uint8_t * const dest[], const uint8_t * source, int done, int count )
+        {
+            if( done >= count )
+                return;
+            uint8_t * const rest[] = { dest[0] + done * out_bytes, dest[1] + done * out_bytes };
+            scalar( rest, source + done * in_bytes, count - done );
+        }
+
+#ifdef RS2_SPLIT_SSSE3
+        inline __m128i load( const uint8_t * p ) { return _mm_loadu_si128( reinterpret_cast< const __m128i * >( p ) ); }
+        inline void store( uint8_t * p, __m128i v ) { _mm_storeu_si128( reinterpret_cast< __m128i * >( p ), v ); }
+        inline __m128i expand( __m128i x ) { return _mm_or_si128( _mm_slli_epi16( x, 6 ), _mm_srli_epi16( x, 4 ) ); }
+
+        int ssse3_y8i( uint8_t * const dest[], const uint8_t * source, int count )
+        {
+            const __m128i evens_odds = _mm_setr_epi8( 0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15 );
+            int i = 0;
+            for( ; i + 16 <= count; i += 16 )
+            {
+                // [l0..l7 | r0..r7], [l8..l15 | r8..r15]
+                __m128i a = _mm_shuffle_epi8( load( source + 2 * i ), evens_odds );
+                __m128i b = _mm_shuffle_epi8( load( source + 2 * i + 16 ), evens_odds );
+                store( dest[0] + i, _mm_unpacklo_epi64( a, b ) );
+                store( dest[1] + i, _mm_unpackhi_epi64( a, b ) );
+            }
+            return i;
+        }
+
+        // 12-bit pixels, 'stride' bytes apart: each 16-bit lane gets bytes {0,1} for the right
+        // pixel and {1,2} for the left
+        template< int STRIDE >
+        int ssse3_y12i( uint8_t * const dest[], const uint8_t * source, int count )
+        {
+            const __m128i right_words = _mm_setr_epi8( 0, 1, STRIDE, STRIDE + 1, 2 * STRIDE, 2 * STRIDE + 1, 3 * STRIDE, 3 * STRIDE + 1,
+                                                       -1, -1, -1, -1, -1, -1, -1, -1 );
+            const __m128i left_words = _mm_setr_epi8( 1, 2, STRIDE + 1, STRIDE + 2, 2 * STRIDE + 1, 2 * STRIDE + 2, 3 * STRIDE + 1, 3 * STRIDE + 2,
+                                                      -1, -1, -1, -1, -1, -1, -1, -1 );
+            const __m128i low_12 = _mm_set1_epi16( 0x0fff );
+            // Each load is 16 bytes, of which only 4 pixels are used: don't read past the end
+            int const overread = ( 16 - 4 * STRIDE + STRIDE - 1 ) / STRIDE;
+            int i = 0;
+            for( ; i + 8 + overread <= count; i += 8 )
+            {
+                __m128i a = load( source + STRIDE * i );
+                __m128i b = load( source + STRIDE * ( i + 4 ) );
+                __m128i r = _mm_unpacklo_epi64( _mm_shuffle_epi8( a, right_words ), _mm_shuffle_epi8( b, right_words ) );
+                __m128i l = _mm_unpacklo_epi64( _mm_shuffle_epi8( a, left_words ), _mm_shuffle_epi8( b, left_words ) );
+                store( dest[0] + 2 * i, expand( _mm_srli_epi16( l, 4 ) ) );
+                store( dest[1] + 2 * i, expand( _mm_and_si128( r, low_12 ) ) );
+            }
+            return i;
+        }
+
+        int ssse3_y16i( uint8_t * const dest[], const uint8_t * source, int count )
+        {
+            const __m128i split_words = _mm_setr_epi8( 0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15 );
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                __m128i a = _mm_shuffle_epi8( load( source + 4 * i ), split_words );
+                __m128i b = _mm_shuffle_epi8( load( source + 4 * i + 16 ), split_words );
+                store( dest[0] + 2 * i, expand( _mm_unpacklo_epi64( a, b ) ) );
+                store( dest[1] + 2 * i, expand( _mm_unpackhi_epi64( a, b ) ) );
+            }
+            return i;
+        }
+#else
+        int ssse3_y8i( uint8_t * const[], const uint8_t *, int ) { return 0; }
+        template< int STRIDE > int ssse3_y12i( uint8_t * const[], const uint8_t *, int ) { return 0; }
+        int ssse3_y16i( uint8_t * const[], const uint8_t *, int ) { return 0; }
+#endif
+
+#ifdef RS2_SPLIT_NEON
+        inline uint16x8_t expand( uint16x8_t x ) { return vorrq_u16( vshlq_n_u16( x, 6 ), vshrq_n_u16( x, 4 ) ); }
+
+        int neon_y8i( uint8_t * const dest[], const uint8_t * source, int count )
+        {
+            int i = 0;
+            for( ; i + 16 <= count; i += 16 )
+            {
+                uint8x16x2_t lr = vld2q_u8( source + 2 * i );
+                vst1q_u8( dest[0] + i, lr.val[0] );
+                vst1q_u8( dest[1] + i, lr.val[1] );
+            }
+            return i;
+        }
+
+        // b0..b2 are the first three bytes of each of 8 pixels
+        inline void neon_y12i_8( uint8x8_t b0, uint8x8_t b1, uint8x8_t b2, uint16_t * left, uint16_t * right )
+        {
+            uint16x8_t w1 = vmovl_u8( b1 );
+            uint16x8_t r = vorrq_u16( vmovl_u8( b0 ), vshlq_n_u16( vandq_u16( w1, vdupq_n_u16( 0x0f ) ), 8 ) );
+            uint16x8_t l = vorrq_u16( vshlq_n_u16( vmovl_u8( b2 ), 4 ), vshrq_n_u16( w1, 4 ) );
+            vst1q_u16( left, expand( l ) );
+            vst1q_u16( right, expand( r ) );
+        }
+
+        template< int STRIDE >
+        int neon_y12i( uint8_t * const dest[], const uint8_t * source, int count )
+        {
+            auto left = reinterpret_cast< uint16_t * >( dest[0] );
+            auto right = reinterpret_cast< uint16_t * >( dest[1] );
+            int i = 0;
+            for( ; i + 16 <= count; i += 16 )
+            {
+                uint8x16_t b0, b1, b2;
+                if( STRIDE == 3 )
+                {
+                    uint8x16x3_t v = vld3q_u8( source + 3 * i );
+                    b0 = v.val[0], b1 = v.val[1], b2 = v.val[2];
+                }
+                else
+                {
+                    uint8x16x4_t v = vld4q_u8( source + 4 * i );
+                    b0 = v.val[0], b1 = v.val[1], b2 = v.val[2];
+                }
+                neon_y12i_8( vget_low_u8( b0 ), vget_low_u8( b1 ), vget_low_u8( b2 ), left + i, right + i );
+                neon_y12i_8( vget_high_u8( b0 ), vget_high_u8( b1 ), vget_high_u8( b2 ), left + i + 8, right + i + 8 );
+            }
+            return i;
+        }
+
+        int neon_y16i( uint8_t * const dest[], const uint8_t * source, int count )
+        {
+            auto left = reinterpret_cast< uint16_t * >( dest[0] );
+            auto right = reinterpret_cast< uint16_t * >( dest[1] );
+            int i = 0;
+            for( ; i + 8 <= count; i += 8 )
+            {
+                uint16x8x2_t lr = vld2q_u16( reinterpret_cast< const uint16_t * >( source + 4 * i ) );
+                vst1q_u16( left + i, expand( lr.val[0] ) );
+                vst1q_u16( right + i, expand( lr.val[1] ) );
+            }
+            return i;
+        }
+#else
+        int neon_y8i( uint8_t * const[], const uint8_t *, int ) { return 0; }
+        template< int STRIDE > int neon_y12i( uint8_t * const[], const uint8_t *, int ) { return 0; }
+        int neon_y16i( uint8_t * const[], const uint8_t *, int ) { return 0; }
+#endif
+
+        isa best_isa()
+        {
+            static const isa best = is_supported( isa::avx2 ) ? isa::avx2
+                                  : is_supported( isa::ssse3 ) ? isa::ssse3
+                                  : is_supported( isa::neon ) ? isa::neon
+                                                              : isa::scalar;
+            return best;
+        }
+    }  // namespace
+
+    bool is_supported( isa which )
+    {
+        if( which == isa::avx2 && ! avx2_compiled() )
+            return false;
+        return cpu_supports( which );
+    }
+
+    void split_y8i( isa which, uint8_t * const dest[], const uint8_t * source, int count )
+    {
+        int done = 0;
+        switch( which )
+        {
+        case isa::avx2: split_y8i_avx2( dest, source, count ); return;
+        case isa::ssse3: done = ssse3_y8i( dest, source, count ); break;
+        case isa::neon: done = neon_y8i( dest, source, count ); break;
+        case isa::scalar: break;
+        }
+        split_rest( scalar_y8i, 2, 1, dest, source, done, count );
+    }
+
+    void split_y12i( isa which, uint8_t * const dest[], const uint8_t * source, int count )
+    {
+        int done = 0;
+        switch( which )
+        {
+        case isa::avx2: split_y12i_avx2( dest, source, count ); return;
+        case isa::ssse3: done = ssse3_y12i< 3 >( dest, source, count ); break;
+        case isa::neon: done = neon_y12i< 3 >( dest, source, count ); break;
+        case isa::scalar: break;
+        }
+        split_rest( scalar_y12i, 3, 2, dest, source, done, count );
+    }
+
+    void split_y12i_mipi( isa which, uint8_t * const dest[], const uint8_t * source, int count )
+    {
+        int done = 0;
+        switch( which )
+        {
+        case isa::avx2: split_y12i_mipi_avx2( dest, source, count ); return;
+        case isa::ssse3: done = ssse3_y12i< 4 >( dest, source, count ); break;
+        case isa::neon: done = neon_y12i< 4 >( dest, source, count ); break;
+        case isa::scalar: break;
+        }
+        split_rest( scalar_y12i_mipi, 4, 2, dest, source, done, count );
+    }
+
+    void split_y16i( isa which, uint8_t * const dest[], const uint8_t * source, int count )
+    {
+        int done = 0;
+        switch( which )
+        {
+        case isa::avx2: split_y16i_avx2( dest, source, count ); return;
+        case isa::ssse3: done = ssse3_y16i( dest, source, count ); break;
+        case isa::neon: done = neon_y16i( dest, source, count ); break;
+        case isa::scalar: break;
+        }
+        split_rest( scalar_y16i, 4, 2, dest, source, done, count );
+    }
+}  // namespace interleaved
+
+    void split_y8i( uint8_t * const dest[], const uint8_t * source, int count )
+    {
+        interleaved::split_y8i( interleaved::best_isa(), dest, source, count );
+    }
+
+    void split_y12i( uint8_t * const dest[], const uint8_t * source, int count )
+    {
+        interleaved::split_y12i( interleaved::best_isa(), dest, source, count );
+    }
+
+    void split_y12i_mipi( uint8_t * const dest[], const uint8_t * source, int count )
+    {
+        interleaved::split_y12i_mipi( interleaved::best_isa(), dest, source, count );
+    }
+
+    void split_y16i( uint8_t * const dest[], const uint8_t * source, int count )
+    {
+        interleaved::split_y16i( interleaved::best_isa(), dest, source, count );
+    }
+}
@@ -0,0 +1,45 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "simd-isa.h"
+
+#include <cstdint>
+
+
+namespace librealsense
+{
+    // De-interleaving of the stereo IR formats: each splits 'count' pixels from 'source' into a left
+    // (dest[0]) and a right (dest[1]) image, in a single pass.
+    //
+    // The best implementation for the CPU is selected at runtime: AVX2 or SSSE3 on x86, NEON on ARM.
+    // The 10/12-bit formats are expanded to 16 bits, as x << 6 | x >> 4.
+    //
+    void split_y8i( uint8_t * const dest[], const uint8_t * source, int count );          // 2 x 8 bits
+    void split_y12i( uint8_t * const dest[], const uint8_t * source, int count );         // 2 x 12 bits, packed in 24
+    void split_y12i_mipi( uint8_t * const dest[], const uint8_t * source, int count );    // 2 x 12 bits, padded to 32
+    void split_y16i( uint8_t * const dest[], const uint8_t * source, int count );         // 2 x 16 bits (10 used)
+
+    // Each of the implementations, for testing against each other
+    namespace interleaved
+    {
+        using isa = simd_isa;
+
+        // Whether the implementation was compiled in and can run on this CPU
+        bool is_supported( isa );
+
+        void split_y8i( isa, uint8_t * const dest[], const uint8_t * source, int count );
+        void split_y12i( isa, uint8_t * const dest[], const uint8_t * source, int count );
+        void split_y12i_mipi( isa, uint8_t * const dest[], const uint8_t * source, int count );
+        void split_y16i( isa, uint8_t * const dest[], const uint8_t * source, int count );
+
+        // Implemented in interleaved-split-avx2.cpp, which is compiled with AVX2 enabled when the
+        // compiler allows it: returns false if it was not
+        bool avx2_compiled();
+        void split_y8i_avx2( uint8_t * const dest[], const uint8_t * source, int count );
+        void split_y12i_avx2( uint8_t * const dest[], const uint8_t * source, int count );
+        void split_y12i_mipi_avx2( uint8_t * const dest[], const uint8_t * source, int count );
+        void split_y16i_avx2( uint8_t * const dest[], const uint8_t * source, int count );
+    }
+}
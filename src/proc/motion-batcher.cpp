@@ -0,0 +1,147 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "motion-batcher.h"
+#include "motion-kernels.h"
+#include <src/core/frame-processor-callback.h>
+#include <src/core/motion-frame.h>
+#include <src/core/stream-profile-interface.h>
+
+#include <rsutils/string/from.h>
+
+#include <cstring>
+
+
+namespace librealsense
+{
+    motion_batcher::motion_batcher( double latency, size_t max_samples )
+        : processing_block( "Motion Batcher" )
+        , _latency( latency )
+        , _max_samples( std::max( max_samples, size_t( 1 ) ) )
+        , _expiry( [this]( dispatcher::cancellable_timer timer ) { release_expired( timer ); } )
+    {
+        if( latency < 0 )
+            throw invalid_value_exception( rsutils::string::from() << "invalid latency " << latency );
+
+        auto on_frame = [this]( frame_holder && frame, synthetic_source_interface * source )
+        {
+            auto mf = dynamic_cast< motion_frame * >( frame.frame );
+            // By format rather than data size: software frames point at their data, and have no size
+            if( ! mf || mf->get_stream()->get_format() != RS2_FORMAT_MOTION_XYZ32F )
+            {
+                source->frame_ready( std::move( frame ) );
+                return;
+            }
+
+            frame_holder result;
+            {
+                // Accel and gyro may arrive on different threads
+                std::lock_guard< std::mutex > lock( _mutex );
+                auto & batch = batch_of( mf );
+                float3 xyz;
+                std::memcpy( &xyz, mf->get_frame_data(), sizeof( xyz ) );
+                batch.samples.push_back( xyz );
+                batch.timestamps.push_back( mf->get_frame_timestamp() );
+                if( ! batch.first )
+                {
+                    batch.first = std::move( frame );
+                    batch.since = std::chrono::steady_clock::now();
+                }
+
+                if( batch.timestamps.back() - batch.timestamps.front() >= _latency
+                    || batch.samples.size() >= _max_samples )
+                    result = release( batch, source );
+            }
+            if( result )
+                source->frame_ready( std::move( result ) );
+        };
+        set_processing_callback( make_frame_processor_callback( std::move( on_frame ) ) );
+        _expiry.start();
+    }
+
+    motion_batcher::~motion_batcher()
+    {
+        // Before the batches go
+        _expiry.stop();
+    }
+
+    void motion_batcher::set_intrinsics( rs2_stream stream, rs2_motion_device_intrinsic const & intrinsics )
+    {
+        // Same as the motion transforms: data[i][0..2] is row i of the matrix, and data[i][3] the bias
+        correction c = { stream };
+        for( int i = 0; i < 3; ++i )
+        {
+            for( int j = 0; j < 3; ++j )
+                c.m( i, j ) = intrinsics.data[i][j];
+            c.bias[i] = intrinsics.data[i][3];
+        }
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        for( auto & existing : _corrections )
+        {
+            if( existing.stream == stream )
+            {
+                existing = c;
+                return;
+            }
+        }
+        _corrections.push_back( c );
+    }
+
+    motion_batcher::pending_batch & motion_batcher::batch_of( frame_interface const * f )
+    {
+        int const id = f->get_stream()->get_unique_id();
+        for( auto & b : _batches )
+            if( b.stream_id == id )
+                return b;
+
+        _batches.push_back( { id } );
+        auto & b = _batches.back();
+        b.samples.reserve( _max_samples );
+        b.timestamps.reserve( _max_samples );
+        return b;
+    }
+
+    frame_holder motion_batcher::release( pending_batch & batch, synthetic_source_interface * source )
+    {
+        frame_holder result = source->allocate_motion_batch_frame( batch.first->get_stream(), batch.first, batch.samples.size() );
+        if( auto bf = dynamic_cast< motion_batch_frame * >( result.frame ) )
+        {
+            auto xyz = reinterpret_cast< float3 * >( bf->data.data() );
+            std::memcpy( xyz, batch.samples.data(), batch.samples.size() * sizeof( float3 ) );
+            bf->timestamps = batch.timestamps;
+
+            auto const stream = batch.first->get_stream()->get_stream_type();
+            for( auto const & c : _corrections )
+                if( c.stream == stream )
+                    motion_kernels::correct( xyz, batch.samples.size(), c.m, c.bias );
+        }
+        else
+            result.reset();
+        batch.first.reset();
+        batch.samples.clear();
+        batch.timestamps.clear();
+        return result;
+    }
+
+    void motion_batcher::release_expired( dispatcher::cancellable_timer timer )
+    {
+        // Checked every 'latency', so a batch may be held up to twice that
+        auto const latency = std::chrono::duration< double, std::milli >( std::max( _latency, 1. ) );
+        if( ! timer.try_sleep( std::chrono::duration_cast< std::chrono::milliseconds >( latency ) ) )
+            return;
+
+        // Released outside the lock, so the callback cannot hold up incoming samples
+        std::vector< frame_holder > expired;
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            auto const now = std::chrono::steady_clock::now();
+            for( auto & batch : _batches )
+                if( batch.first && now - batch.since >= latency )
+                    if( auto result = release( batch, &get_source() ) )
+                        expired.push_back( std::move( result ) );
+        }
+        for( auto & result : expired )
+            get_source().frame_ready( std::move( result ) );
+    }
+}
@@ -0,0 +1,66 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+#include <src/core/frame-holder.h>
+#include <src/float3.h>
+
+#include <rsutils/concurrency/concurrency.h>
+
+#include <chrono>
+#include <vector>
+
+
+namespace librealsense
+{
+    // Collects the samples of each motion stream into motion batch frames, for applications that would rather
+    // handle IMU data a few milliseconds at a time than one frame (and one callback) per sample.
+    //
+    // A batch is released once it spans 'latency' milliseconds of sample time, or holds 'max_samples'. While
+    // a batch builds up only its samples are kept, plus the first frame for the header, so the sensor's frame
+    // pool is not drained. Frames that are not XYZ motion frames are passed through as they are.
+    //
+    // A batch that was not released by the samples after it (the stream stopped, or is slower than the latency)
+    // is released anyway once it has been held 'latency' milliseconds of wall time, give or take as much again.
+    //
+    // Streams given intrinsics (scale, cross-axis and bias, e.g. an application's own IMU calibration) have them
+    // applied to each batch as a whole, with the vectorized motion_kernels::correct().
+    class motion_batcher : public processing_block
+    {
+    public:
+        motion_batcher( double latency, size_t max_samples );
+        ~motion_batcher();
+
+        void set_intrinsics( rs2_stream, rs2_motion_device_intrinsic const & );
+
+    private:
+        struct pending_batch
+        {
+            int stream_id;
+            frame_holder first;
+            std::vector< float3 > samples;
+            std::vector< double > timestamps;
+            std::chrono::steady_clock::time_point since;  // when the first sample arrived
+        };
+
+        struct correction
+        {
+            rs2_stream stream;
+            float3x3 m;
+            float3 bias;
+        };
+
+        pending_batch & batch_of( frame_interface const * f );
+        frame_holder release( pending_batch & batch, synthetic_source_interface * source );
+        void release_expired( dispatcher::cancellable_timer timer );
+
+        double const _latency;
+        size_t const _max_samples;
+        std::vector< pending_batch > _batches;  // one per stream
+        std::vector< correction > _corrections;  // one per stream type that has intrinsics
+        active_object<> _expiry;
+    };
+    MAP_EXTENSION( RS2_EXTENSION_MOTION_BATCHER, librealsense::motion_batcher );
+}
@@ -0,0 +1,104 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "motion-kernels.h"
+
+#if defined __SSSE3__ && ! defined ANDROID
+#define RS2_KERNELS_SSSE3
+#include <tmmintrin.h>
+#endif
+
+
+namespace librealsense
+{
+namespace motion_kernels
+{
+    namespace
+    {
+        void scalar_correct( float3 * xyz, size_t i, size_t count, const float3x3 & m, const float3 & bias )
+        {
+            for( ; i < count; ++i )
+                xyz[i] = m * xyz[i] - bias;
+        }
+
+#ifdef RS2_KERNELS_SSSE3
+        // Four samples are three vectors: x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3. The products are done on
+        // the x, y and z of the four, in the order float3x3 * float3 does them.
+        size_t ssse3_correct( float3 * xyz, size_t count, const float3x3 & m, const float3 & bias )
+        {
+            const __m128 mxx = _mm_set1_ps( m.x.x ), mxy = _mm_set1_ps( m.x.y ), mxz = _mm_set1_ps( m.x.z );
+            const __m128 myx = _mm_set1_ps( m.y.x ), myy = _mm_set1_ps( m.y.y ), myz = _mm_set1_ps( m.y.z );
+            const __m128 mzx = _mm_set1_ps( m.z.x ), mzy = _mm_set1_ps( m.z.y ), mzz = _mm_set1_ps( m.z.z );
+            const __m128 bx = _mm_set1_ps( bias.x ), by = _mm_set1_ps( bias.y ), bz = _mm_set1_ps( bias.z );
+
+            size_t i = 0;
+            for( ; i + 4 <= count; i += 4 )
+            {
+                float * p = &xyz[i].x;
+                __m128 a0 = _mm_loadu_ps( p ), a1 = _mm_loadu_ps( p + 4 ), a2 = _mm_loadu_ps( p + 8 );
+
+                __m128 t = _mm_shuffle_ps( a1, a2, _MM_SHUFFLE( 2, 1, 3, 2 ) );  // x2 y2 x3 y3
+                __m128 u = _mm_shuffle_ps( a0, a1, _MM_SHUFFLE( 1, 0, 2, 1 ) );  // y0 z0 y1 z1
+                __m128 x = _mm_shuffle_ps( a0, t, _MM_SHUFFLE( 2, 0, 3, 0 ) );
+                __m128 y = _mm_shuffle_ps( u, t, _MM_SHUFFLE( 3, 1, 2, 0 ) );
+                __m128 z = _mm_shuffle_ps( u, a2, _MM_SHUFFLE( 3, 0, 3, 1 ) );
+
+                __m128 rx = _mm_sub_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( mxx, x ), _mm_mul_ps( myx, y ) ), _mm_mul_ps( mzx, z ) ), bx );
+                __m128 ry = _mm_sub_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( mxy, x ), _mm_mul_ps( myy, y ) ), _mm_mul_ps( mzy, z ) ), by );
+                __m128 rz = _mm_sub_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( mxz, x ), _mm_mul_ps( myz, y ) ), _mm_mul_ps( mzz, z ) ), bz );
+
+                __m128 xy_lo = _mm_unpacklo_ps( rx, ry );  // x0 y0 x1 y1
+                __m128 xy_hi = _mm_unpackhi_ps( rx, ry );  // x2 y2 x3 y3
+                __m128 zx0 = _mm_shuffle_ps( rz, rx, _MM_SHUFFLE( 1, 1, 0, 0 ) );  // z0 z0 x1 x1
+                __m128 yz1 = _mm_shuffle_ps( ry, rz, _MM_SHUFFLE( 1, 1, 1, 1 ) );  // y1 y1 z1 z1
+                __m128 zx2 = _mm_shuffle_ps( rz, rx, _MM_SHUFFLE( 3, 3, 2, 2 ) );  // z2 z2 x3 x3
+                __m128 yz3 = _mm_shuffle_ps( ry, rz, _MM_SHUFFLE( 3, 3, 3, 3 ) );  // y3 y3 z3 z3
+                _mm_storeu_ps( p, _mm_shuffle_ps( xy_lo, zx0, _MM_SHUFFLE( 2, 0, 1, 0 ) ) );
+                _mm_storeu_ps( p + 4, _mm_shuffle_ps( yz1, xy_hi, _MM_SHUFFLE( 1, 0, 2, 0 ) ) );
+                _mm_storeu_ps( p + 8, _mm_shuffle_ps( zx2, yz3, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+            }
+            return i;
+        }
+#endif
+
+        isa best_isa()
+        {
+            static const isa best = is_supported( isa::ssse3 ) ? isa::ssse3 : isa::scalar;
+            return best;
+        }
+    }  // namespace
+
+    // There is no AVX2 or NEON version: at IMU rates, even a batch is a few hundred samples
+    bool is_supported( isa which )
+    {
+        switch( which )
+        {
+        case isa::scalar:
+            return true;
+        case isa::ssse3:
+#ifdef RS2_KERNELS_SSSE3
+            return cpu_supports( which );
+#else
+            return false;
+#endif
+        default:
+            return false;
+        }
+    }
+
+    void correct( isa which, float3 * xyz, size_t count, const float3x3 & m, const float3 & bias )
+    {
+        size_t done = 0;
+#ifdef RS2_KERNELS_SSSE3
+        if( which == isa::ssse3 )
+            done = ssse3_correct( xyz, count, m, bias );
+#endif
+        scalar_correct( xyz, done, count, m, bias );
+    }
+
+    void correct( float3 * xyz, size_t count, const float3x3 & m, const float3 & bias )
+    {
+        correct( best_isa(), xyz, count, m, bias );
+    }
+}  // namespace motion_kernels
+}
@@ -0,0 +1,31 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "simd-isa.h"
+#include <src/float3.h>
+
+#include <cstddef>
+
+
+namespace librealsense
+{
+    // Scale, cross-axis/rotation and bias correction of IMU samples, over a whole motion batch at once. Each
+    // sample becomes m * xyz - bias, with the same operations (and therefore the same result) as float3x3 *
+    // float3, four samples at a time where the instruction set allows it.
+    //
+    namespace motion_kernels
+    {
+        void correct( float3 * xyz, size_t count, const float3x3 & m, const float3 & bias );
+
+
+        // Each of the implementations, for testing against each other
+        using isa = simd_isa;
+
+        // Whether the implementation was compiled in and can run on this CPU
+        bool is_supported( isa );
+
+        void correct( isa, float3 * xyz, size_t count, const float3x3 & m, const float3 & bias );
+    }
+}
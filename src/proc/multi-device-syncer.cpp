@@ -0,0 +1,133 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "multi-device-syncer.h"
+#include <src/core/frame-processor-callback.h>
+#include <src/core/stream-profile-interface.h>
+#include <src/core/sensor-interface.h>
+#include <src/core/device-interface.h>
+
+#include <rsutils/string/from.h>
+
+
+namespace librealsense
+{
+    multi_device_syncer::multi_device_syncer( bool match_frame_counter, double tolerance, size_t queue_size )
+        : processing_block( "Multi-Device Syncer" )
+        , _match_frame_counter( match_frame_counter )
+        , _tolerance( tolerance )
+        , _queue_size( std::max( queue_size, size_t( 1 ) ) )
+    {
+        if( tolerance < 0 )
+            throw invalid_value_exception( rsutils::string::from() << "invalid tolerance " << tolerance );
+
+        auto on_frame = [this]( frame_holder && frame, synthetic_source_interface * source )
+        {
+            // Frames arrive from a thread per device (or per stream); collect whatever slots are complete, in
+            // order, and hand them on once the lock is released so the callback cannot hold up other threads
+            std::vector< frame_holder > ready;
+            {
+                std::lock_guard< std::mutex > lock( _mutex );
+                enqueue( std::move( frame ) );
+                while( release_slot( source, ready ) )
+                    ;
+            }
+            for( auto & composite : ready )
+                source->frame_ready( std::move( composite ) );
+        };
+        set_processing_callback( make_frame_processor_callback( std::move( on_frame ) ) );
+    }
+
+    double multi_device_syncer::key_of( frame_interface const * f )
+    {
+        if( _match_frame_counter )
+            return double( f->get_frame_number() );
+
+        if( f->get_frame_timestamp_domain() == RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME )
+            return f->get_frame_timestamp();
+
+        // Device clocks cannot be compared; the best we can do is the time the frame reached the host
+        if( ! _warned_domain )
+        {
+            LOG_WARNING( "Multi-device syncer: frame timestamps are not in the global time domain; "
+                         "using system time, which is much less accurate" );
+            _warned_domain = true;
+        }
+        return f->get_frame_system_time();
+    }
+
+    multi_device_syncer::stream_queue & multi_device_syncer::queue_of( frame_interface const * f )
+    {
+        void const * device = nullptr;
+        if( auto sensor = f->get_sensor() )
+            device = &sensor->get_device();
+        int const stream = f->get_stream()->get_unique_id();
+
+        for( auto & q : _streams )
+            if( q.device == device && q.stream == stream )
+                return q;
+
+        _streams.push_back( { device, stream } );
+        return _streams.back();
+    }
+
+    void multi_device_syncer::enqueue( frame_holder && f )
+    {
+        auto & q = queue_of( f.frame );
+        q.active = true;
+        if( q.frames.size() >= _queue_size )
+        {
+            LOG_DEBUG( "Multi-device syncer: queue full; dropping " << q.frames.front().frame );
+            q.frames.pop_front();
+        }
+        auto key = key_of( f.frame );
+        q.frames.push_back( { key, std::move( f ) } );
+    }
+
+    bool multi_device_syncer::release_slot( synthetic_source_interface * source, std::vector< frame_holder > & ready )
+    {
+        // The slot to release is the oldest one pending
+        double slot = 0;
+        bool any = false;
+        bool full = false;
+        for( auto const & q : _streams )
+        {
+            if( q.frames.empty() )
+                continue;
+            if( ! any || q.frames.front().key < slot )
+                slot = q.frames.front().key;
+            any = true;
+            full = full || q.frames.size() >= _queue_size;
+        }
+        if( ! any )
+            return false;
+
+        // Every active stream must have either contributed to the slot or moved past it; a stream with nothing
+        // queued may still deliver, unless others have already queued as much as we're willing to hold
+        for( auto & q : _streams )
+        {
+            if( ! q.frames.empty() || ! q.active )
+                continue;
+            if( ! full )
+                return false;
+            LOG_DEBUG( "Multi-device syncer: no frames from stream " << q.stream << "; not waiting for it" );
+            q.active = false;
+        }
+
+        _match.clear();
+        for( auto & q : _streams )
+        {
+            if( ! q.frames.empty() && q.frames.front().key - slot <= _tolerance )
+            {
+                _match.push_back( std::move( q.frames.front().frame ) );
+                q.frames.pop_front();
+            }
+        }
+
+        frame_holder composite = source->allocate_composite_frame( std::move( _match ) );
+        _match.clear();
+        if( composite.frame )
+            ready.push_back( std::move( composite ) );
+        return true;
+    }
+}
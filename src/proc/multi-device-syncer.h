@@ -0,0 +1,58 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "synthetic-stream.h"
+#include <src/core/frame-holder.h>
+
+#include <deque>
+#include <vector>
+
+
+namespace librealsense
+{
+    // Matches frames (or framesets) from several devices into one composite frame per time slot.
+    //
+    // Frames are matched either by their timestamp, which should be in the global-time domain (see
+    // global_timestamp_reader) so devices can be compared, or by frame counter for devices in inter-cam
+    // sync mode. Frames whose keys are within 'tolerance' of each other belong to the same slot.
+    //
+    // Each stream of each device gets its own queue, and a slot takes at most one frame from each; a frameset
+    // counts as the stream of its first frame, so framesets from a device's syncer are queued per device. A slot
+    // is released once every active stream has either contributed to it or moved past it. Queues are bounded:
+    // when one fills up we stop waiting for streams that have nothing queued (they are considered inactive until
+    // they deliver again), and past that the oldest frame is dropped.
+    class multi_device_syncer : public processing_block
+    {
+    public:
+        multi_device_syncer( bool match_frame_counter, double tolerance, size_t queue_size );
+
+    private:
+        struct pending_frame
+        {
+            double key;
+            frame_holder frame;
+        };
+
+        struct stream_queue
+        {
+            void const * device;
+            int stream;  // unique id, but only within the device (e.g., software devices)
+            std::deque< pending_frame > frames;
+            bool active = true;
+        };
+
+        double key_of( frame_interface const * f );
+        stream_queue & queue_of( frame_interface const * f );
+        void enqueue( frame_holder && f );
+        bool release_slot( synthetic_source_interface * source, std::vector< frame_holder > & ready );
+
+        bool const _match_frame_counter;
+        double const _tolerance;
+        size_t const _queue_size;
+        std::deque< stream_queue > _streams;  // a deque, so queues are never relocated
+        std::vector< frame_holder > _match;
+        bool _warned_domain = false;
+    };
+}
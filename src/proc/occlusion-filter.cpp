@@ -7,6 +7,7 @@
 
 #include <rsutils/string/from.h>
 
+#include <algorithm>
 #include <vector>
 #include <cmath>
 
@@ -23,14 +24,14 @@ namespace librealsense
         _texels_depth.resize(_texels_intrinsics.value().width*_texels_intrinsics.value().height);
     }
 
-   void occlusion_filter::process(float3* points, float2* uv_map, const std::vector<float2> & pix_coord, const rs2::depth_frame& depth) const
+   void occlusion_filter::process(float3* points, float2* uv_map, const rs2::depth_frame& depth) const
     {
         switch (_occlusion_filter)
         {
         case occlusion_none:
             break;
         case occlusion_monotonic_scan:
-            monotonic_heuristic_invalidation(points, uv_map, pix_coord, depth);
+            monotonic_heuristic_invalidation(points, uv_map, depth);
             break;
         default:
             throw std::runtime_error( rsutils::string::from()
@@ -63,49 +64,6 @@ namespace librealsense
            }
 
        return res;
-   }
-   template<size_t SIZE>
-   void rotate_image_optimized( uint8_t * dest[], const uint8_t * source, int width, int height)
-   {
-
-       auto width_out = height;
-       auto height_out = width;
-
-       auto out = dest[0];
-       auto buffer_size = maxDivisorRange(height, width, 1, ROTATION_BUFFER_SIZE); 
-
-       uint8_t ** buffer = new uint8_t * [buffer_size];
-       for (int i = 0; i < buffer_size; ++i)
-           buffer[i] = new uint8_t[buffer_size * SIZE];
-
-
-       for (int i = 0; i <= height - buffer_size; i = i + buffer_size)
-       {
-           for (int j = 0; j <= width - buffer_size; j = j + buffer_size)
-           {
-               for (int ii = 0; ii < buffer_size; ++ii)
-               {
-                   for (int jj = 0; jj < buffer_size; ++jj)
-                   {
-                       auto source_index = ((j + jj) + (width * (i + ii))) * SIZE;
-                       memcpy((void*)&(buffer[(buffer_size-1 - jj)][(buffer_size-1 - ii) * SIZE]), &source[source_index], SIZE);
-                   }
-               }
-
-               for (int ii = 0; ii < buffer_size; ++ii)
-               {
-                   auto out_index = (((height_out - buffer_size - j + 1) * width_out) - i - buffer_size + (ii)*width_out);
-                   memcpy(&out[(out_index)*SIZE], (buffer[ii]), buffer_size * SIZE);
-               }
-           }
-       }
-
-       for (int i = 0; i < buffer_size; ++i)
-       {
-           delete[] buffer[i];
-       }
-       delete[] buffer;
- 
    }
     // IMPORTANT! This implementation is based on the assumption that the RGB sensor is positioned strictly to the left of the depth sensor.
     // namely D415/D435. The implementation WILL NOT work properly for different setups
@@ -115,54 +73,55 @@ namespace librealsense
     // -  The occlusion is designated as U coordinate for a given pixel is less than the U coordinate of the predecessing pixel.
     // -  The UV mapping for the occluded pixel is reset to (0,0). Later on the (0,0) coordinate in the texture map is overwritten
     //    with a invalidation color such as black/magenta according to the purpose (production/debugging)
-   void occlusion_filter::monotonic_heuristic_invalidation(float3* points, float2* uv_map, const std::vector<float2>& pix_coord, const rs2::depth_frame& depth) const
+   void occlusion_filter::invalidate_row(float3* points, const float2* uv_map, int width) const
    {
        float occZTh = 0.1f; //meters
        int occDilationSz = 1;
-       auto points_width = _depth_intrinsics->width;
-       auto points_height = _depth_intrinsics->height;
-       auto pixels_ptr = pix_coord.data();
-       auto points_ptr = points;
-       auto uv_map_ptr = uv_map;
-       float maxInLine = -1;
+       // U is the texel X normalized to the texture width, which keeps its order: start one texel left of the image
+       float maxInLine = -1.f / _texels_intrinsics->width;
        float maxZ = 0;
+       int occDilationLeft = 0;
 
-       if (_occlusion_scanning == horizontal)
+       for (int x = 0; x < width; ++x)
        {
-           for( int y = 0; y < points_height; ++y )
+           auto& point = points[x];
+           if (point.z)
            {
-               maxInLine = -1;
-               maxZ = 0;
-               int occDilationLeft = 0;
-
-               for(int x = 0; x < points_width; ++x )
+               // Occlusion detection
+               if (uv_map[x].x < maxInLine
+                   || (uv_map[x].x == maxInLine && (point.z - maxZ) > occZTh))
                {
-                   if( points_ptr->z )
+                   point = { 0, 0, 0 };
+                   occDilationLeft = occDilationSz;
+               }
+               else
+               {
+                   maxInLine = uv_map[x].x;
+                   maxZ = point.z;
+                   if (occDilationLeft > 0)
                    {
-                       // Occlusion detection
-                       if( pixels_ptr->x < maxInLine
-                           || ( pixels_ptr->x == maxInLine && ( points_ptr->z - maxZ ) > occZTh ) )
-                       {
-                           *points_ptr = { 0, 0, 0 };
-                           occDilationLeft = occDilationSz;
-                       }
-                       else
-                       {
-                           maxInLine = pixels_ptr->x;
-                           maxZ = points_ptr->z;
-                           if( occDilationLeft > 0 )
-                           {
-                               *points_ptr = { 0, 0, 0 };
-                               occDilationLeft--;
-                           }
-                       }
+                       point = { 0, 0, 0 };
+                       occDilationLeft--;
                    }
-                   ++points_ptr;
-                   ++uv_map_ptr;
-                   ++pixels_ptr;
                }
            }
        }
+   }
+
+   void occlusion_filter::monotonic_heuristic_invalidation(float3* points, float2* uv_map, const rs2::depth_frame& depth) const
+   {
+       auto points_width = _depth_intrinsics->width;
+       auto points_height = _depth_intrinsics->height;
+       auto points_ptr = points;
+       auto uv_map_ptr = uv_map;
+       float maxInLine = -1;
+
+       if (_occlusion_scanning == horizontal)
+       {
+#pragma omp parallel for
+           for (int y = 0; y < points_height; ++y)
+               invalidate_row(points + y * points_width, uv_map + y * points_width, points_width);
+       }
        else if (_occlusion_scanning == vertical)
        {
            auto rotated_depth_width = _depth_intrinsics->height;
@@ -172,7 +131,7 @@ namespace librealsense
            uint8_t * depth_planes[1];
            depth_planes[0] = alloc.data();
 
-           rotate_image_optimized<2>(depth_planes, (const uint8_t *)(depth.get_data()), points_width, points_height);
+           rotate_image(depth_planes[0], (const uint8_t *)(depth.get_data()), points_width, points_height, 2);
 
            // scan depth frame after rotation: check if there is a noticed jump between adjacen pixels in Z-axis (depth), it means there could be occlusion.
            // save suspected points and run occlusion-invalidation vertical scan only on them
@@ -218,6 +177,14 @@ namespace librealsense
            }
        }
    }
+    // The texel of texture coordinates within (0,1)
+    static size_t texel(const float2& uv, size_t width, size_t height)
+    {
+        auto x = std::min((size_t)(uv.x * width), width - 1);
+        auto y = std::min((size_t)(uv.y * height), height - 1);
+        return y * width + x;
+    }
+
     // Prepare texture map without occlusion that for every texture coordinate there no more than one depth point that is mapped to it
     // i.e. for every (u,v) map coordinate we select the depth point with minimum Z. all other points that are mapped to this texel will be invalidated
     // Algo input data:
@@ -226,10 +193,10 @@ namespace librealsense
     // Algo intermediate data:
     // Vector of depth values (floats) in size of the mapped texture (different from depth width*height) where
     // each (i,j) cell holds the minimal Z among all the depth pixels that are mapped to the specific texel
-    void occlusion_filter::comprehensive_invalidation(float3* points, float2* uv_map, const std::vector<float2> & pix_coord) const
+    void occlusion_filter::comprehensive_invalidation(float3* points, float2* uv_map) const
     {
         auto depth_points = points;
-        auto mapped_pix = pix_coord.data();
+        auto mapped_uv = uv_map;
         size_t mapped_tex_width = _texels_intrinsics->width;
         size_t mapped_tex_height = _texels_intrinsics->height;
         size_t points_width = _depth_intrinsics->width;
@@ -246,10 +213,10 @@ namespace librealsense
             for (size_t j = 0; j < points_width; j++)
             {
                 if ((depth_points->z > 0.0001f) &&
-                    (mapped_pix->x > 0.f) && (mapped_pix->x < mapped_tex_width) &&
-                    (mapped_pix->y > 0.f) && (mapped_pix->y < mapped_tex_height))
+                    (mapped_uv->x > 0.f) && (mapped_uv->x < 1.f) &&
+                    (mapped_uv->y > 0.f) && (mapped_uv->y < 1.f))
                 {
-                    size_t texel_index = (size_t)(mapped_pix->y)*mapped_tex_width + (size_t)(mapped_pix->x);
+                    size_t texel_index = texel(*mapped_uv, mapped_tex_width, mapped_tex_height);
 
                     if ((_texels_depth[texel_index] < 0.0001f) || ((_texels_depth[texel_index] + z_threshold) > depth_points->z))
                     {
@@ -258,11 +225,11 @@ namespace librealsense
                 }
 
                 ++depth_points;
-                ++mapped_pix;
+                ++mapped_uv;
             }
         }
 
-        mapped_pix = pix_coord.data();
+        mapped_uv = uv_map;
         depth_points = points;
         auto uv_ptr = uv_map;
 
@@ -272,10 +239,10 @@ namespace librealsense
             for (size_t j = 0; j < points_width; j++)
             {
                 if ((depth_points->z > 0.0001f) &&
-                    (mapped_pix->x > 0.f) && (mapped_pix->x < mapped_tex_width) &&
-                    (mapped_pix->y > 0.f) && (mapped_pix->y < mapped_tex_height))
+                    (mapped_uv->x > 0.f) && (mapped_uv->x < 1.f) &&
+                    (mapped_uv->y > 0.f) && (mapped_uv->y < 1.f))
                 {
-                    size_t texel_index = (size_t)(mapped_pix->y)*mapped_tex_width + (size_t)(mapped_pix->x);
+                    size_t texel_index = texel(*mapped_uv, mapped_tex_width, mapped_tex_height);
 
                     if ((_texels_depth[texel_index] > 0.0001f) && ((_texels_depth[texel_index] + z_threshold) < depth_points->z))
                     {
@@ -284,7 +251,7 @@ namespace librealsense
                 }
 
                 ++depth_points;
-                ++mapped_pix;
+                ++mapped_uv;
                 ++uv_ptr;
             }
         }
@@ -6,7 +6,6 @@
 #include "rotation-transform.h"
 #include <src/pose.h>
 
-#define ROTATION_BUFFER_SIZE 32 // minimum limit that could be divided by all resolutions
 #define VERTICAL_SCAN_WINDOW_SIZE 16
 #define DEPTH_OCCLUSION_THRESHOLD 0.5f //meters
 
@@ -33,7 +32,11 @@ namespace librealsense
 
         bool active(void) const { return (occlusion_none != _occlusion_filter); }
 
-        void process(float3* points, float2* uv_map, const std::vector<float2> & pix_coord, const rs2::depth_frame& depth) const;
+        void process(float3* points, float2* uv_map, const rs2::depth_frame& depth) const;
+
+        // The horizontal monotonic scan, for a single row: rows are independent, so they can be scanned in
+        // parallel, or each as soon as it is mapped
+        void invalidate_row(float3* points, const float2* uv_map, int width) const;
 
         void set_mode(uint8_t filter_type) { _occlusion_filter = (occlusion_rect_type)filter_type; }
         void set_scanning(uint8_t scanning) { _occlusion_scanning = (occlusion_scanning_type)scanning; }
@@ -58,8 +61,8 @@ namespace librealsense
 
         friend class pointcloud;
 
-        void monotonic_heuristic_invalidation(float3* points, float2* uv_map, const std::vector<float2> & pix_coord, const rs2::depth_frame& depth) const;
-        void comprehensive_invalidation(float3* points, float2* uv_map, const std::vector<float2> & pix_coord) const;
+        void monotonic_heuristic_invalidation(float3* points, float2* uv_map, const rs2::depth_frame& depth) const;
+        void comprehensive_invalidation(float3* points, float2* uv_map) const;
 
         optional_value<rs2_intrinsics>              _depth_intrinsics;
         optional_value<rs2_intrinsics>              _texels_intrinsics;
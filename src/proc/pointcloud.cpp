@@ -87,7 +87,6 @@ namespace librealsense
             if (auto video = stream_profile.as<rs2::video_stream_profile>())
             {
                 _depth_intrinsics = video.get_intrinsics();
-                _pixels_map.resize(_depth_intrinsics->height*_depth_intrinsics->width);
                 _occlusion_filter->set_depth_intrinsics(_depth_intrinsics.value());
 
                 preprocess();
@@ -222,20 +221,24 @@ namespace librealsense
                 {
                     auto trans = transform(&extr, *points);
                     //auto tex_xy = project_to_texcoord(&mapped_intr, trans);
-                    // Store intermediate results for poincloud filters
-                    *pixels_ptr = project(&other_intrinsics, trans);
-                    auto tex_xy = pixel_to_texcoord(&other_intrinsics, *pixels_ptr);
+                    auto pixel = project(&other_intrinsics, trans);
+                    auto tex_xy = pixel_to_texcoord(&other_intrinsics, pixel);
 
                     *tex_ptr = tex_xy;
+                    // Store intermediate results, when asked for
+                    if (pixels_ptr)
+                        *pixels_ptr = pixel;
                 }
                 else
                 {
                     *tex_ptr = { 0.f, 0.f };
-                    *pixels_ptr = { 0.f, 0.f };
+                    if (pixels_ptr)
+                        *pixels_ptr = { 0.f, 0.f };
                 }
                 ++points;
                 ++tex_ptr;
-                ++pixels_ptr;
+                if (pixels_ptr)
+                    ++pixels_ptr;
             }
         }
     }
@@ -245,16 +248,95 @@ namespace librealsense
         return source.allocate_points(_output_stream, depth);
     }
 
+    void pointcloud::update_texture_mapping(const rs2_intrinsics& other_intrinsics, const rs2_extrinsics& extr)
+    {
+        auto const & depth_intrinsics = *_depth_intrinsics;
+        if (!_texture_rays.empty() && _mapped_depth_intrinsics == depth_intrinsics
+            && _texture_mapping.texture == other_intrinsics && _mapped_extrinsics == extr)
+            return;
+
+        // Per depth pixel, its ray (the point at 1 meter) and that ray rotated into the other sensor: the
+        // deprojection and rotation are then a multiplication by the depth
+        size_t const count = size_t(depth_intrinsics.width) * depth_intrinsics.height;
+        _texture_rays.resize(5 * count);
+        auto ray_x = _texture_rays.data();
+        auto ray_y = ray_x + count;
+        auto to_x = ray_y + count;
+        auto to_y = to_x + count;
+        auto to_z = to_y + count;
+        auto const r = extr.rotation;
+        size_t i = 0;
+        for (int y = 0; y < depth_intrinsics.height; ++y)
+        {
+            for (int x = 0; x < depth_intrinsics.width; ++x, ++i)
+            {
+                const float pixel[] = { (float)x, (float)y };
+                float ray[3];
+                rs2_deproject_pixel_to_point(ray, &depth_intrinsics, pixel, 1.f);
+                ray_x[i] = ray[0];
+                ray_y[i] = ray[1];
+                to_x[i] = r[0] * ray[0] + r[3] * ray[1] + r[6];
+                to_y[i] = r[1] * ray[0] + r[4] * ray[1] + r[7];
+                to_z[i] = r[2] * ray[0] + r[5] * ray[1] + r[8];
+            }
+        }
+
+        _texture_mapping = { ray_x, ray_y, to_x, to_y, to_z,
+                             { extr.translation[0], extr.translation[1], extr.translation[2] },
+                             other_intrinsics };
+        _mapped_depth_intrinsics = depth_intrinsics;
+        _mapped_extrinsics = extr;
+    }
+
+    // Deprojection, texture mapping and the horizontal occlusion scan, row by row: each row is mapped and
+    // scanned while it is in cache, and there is no intermediate per-pixel table
+    void pointcloud::map_texture(rs2::points output, const rs2::depth_frame& depth,
+        const rs2_intrinsics& other_intrinsics, const rs2_extrinsics& extr)
+    {
+        update_texture_mapping(other_intrinsics, extr);
+
+        auto vertices = (float3*)output.get_vertices();
+        auto texcoords = (float2*)output.get_texture_coordinates();
+        auto depth_data = (const uint16_t*)depth.get_data();
+        auto const units = depth.get_units();
+        int const width = _depth_intrinsics->width;
+        int const height = _depth_intrinsics->height;
+
+        bool const occlusion = run__occlusion_filter(extr);
+        bool const vertical_scan = occlusion && _occlusion_filter->find_scanning_direction(extr) == vertical;
+        bool const scan_rows = occlusion && !vertical_scan;
+
+#pragma omp parallel for
+        for (int y = 0; y < height; ++y)
+        {
+            int const offset = y * width;
+            auto row = _texture_mapping;
+            row.ray_x += offset;
+            row.ray_y += offset;
+            row.to_x += offset;
+            row.to_y += offset;
+            row.to_z += offset;
+            depth_kernels::texture_map((float*)(vertices + offset), (float*)(texcoords + offset),
+                depth_data + offset, row, width, units);
+            if (scan_rows)
+                _occlusion_filter->invalidate_row(vertices + offset, texcoords + offset, width);
+        }
+
+        if (vertical_scan)
+        {
+            _occlusion_filter->set_scanning(static_cast<uint8_t>(vertical));
+            _occlusion_filter->_depth_units = _depth_units;
+            _occlusion_filter->process(vertices, texcoords, depth);
+        }
+    }
+
     rs2::frame pointcloud::process_depth_frame(const rs2::frame_source& source, const rs2::depth_frame& depth)
     {
         auto res = allocate_points(source, depth);
         auto pframe = (librealsense::points*)(res.get());
-        const float3* points = depth_to_points(res, *_depth_intrinsics, depth);
 
         auto vid_frame = depth.as<rs2::video_frame>();
 
-        // Pixels calculated in the mapped texture. Used in post-processing filters
-        float2* pixels_ptr = _pixels_map.data();
         rs2_intrinsics mapped_intr;
         rs2_extrinsics extr;
         bool map_texture = false;
@@ -267,12 +349,20 @@ namespace librealsense
             }
         }
 
+        if (map_texture && map_texture_in_one_pass())
+        {
+            this->map_texture(res, depth, mapped_intr, extr);
+            return res;
+        }
+
+        const float3* points = depth_to_points(res, *_depth_intrinsics, depth);
+
         if (map_texture)
         {
             auto height = vid_frame.get_height();
             auto width = vid_frame.get_width();
 
-            get_texture_map(res, points, width, height, mapped_intr, extr, pixels_ptr);
+            get_texture_map(res, points, width, height, mapped_intr, extr, nullptr);
 
             if (run__occlusion_filter(extr))
             {
@@ -281,7 +371,7 @@ namespace librealsense
                     _occlusion_filter->set_scanning(static_cast<uint8_t>(vertical));
                     _occlusion_filter->_depth_units = _depth_units;
                 }
-                _occlusion_filter->process(pframe->get_vertices(), pframe->get_texture_coordinates(), _pixels_map, depth);
+                _occlusion_filter->process(pframe->get_vertices(), pframe->get_texture_coordinates(), depth);
             }
         }
         return res;
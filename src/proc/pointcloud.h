@@ -3,6 +3,7 @@
 #pragma once
 
 #include "synthetic-stream.h"
+#include "depth-kernels.h"
 #include <src/float3.h>
 
 
@@ -33,6 +34,10 @@ namespace librealsense
         virtual void preprocess() {}
         virtual bool run__occlusion_filter(const rs2_extrinsics& extr);
 
+        // Whether the points are textured in one pass over the depth (see map_texture): implementations that
+        // deproject or map elsewhere, in depth_to_points and get_texture_map, do not
+        virtual bool map_texture_in_one_pass() const { return true; }
+
     protected:
         pointcloud(const char* name);
 
@@ -45,8 +50,11 @@ namespace librealsense
         optional_value<rs2_extrinsics>         _extrinsics;
         std::shared_ptr<occlusion_filter>      _occlusion_filter;
 
-        // Intermediate translation table of (depth_x*depth_y) with actual texel coordinates per depth pixel
-        std::vector<float2>                    _pixels_map;
+        // The per-pixel coefficients of map_texture, for the calibration they were computed for
+        std::vector<float>                     _texture_rays;
+        depth_kernels::texture_mapping         _texture_mapping{};
+        rs2_intrinsics                         _mapped_depth_intrinsics{};
+        rs2_extrinsics                         _mapped_extrinsics{};
 
         rs2::stream_profile _output_stream;
         rs2::frame _other_stream;
@@ -55,6 +63,9 @@ namespace librealsense
         void inspect_depth_frame(const rs2::frame& depth);
         void inspect_other_frame(const rs2::frame& other);
         rs2::frame process_depth_frame(const rs2::frame_source& source, const rs2::depth_frame& depth);
+        void map_texture(rs2::points output, const rs2::depth_frame& depth,
+            const rs2_intrinsics& other_intrinsics, const rs2_extrinsics& extr);
+        void update_texture_mapping(const rs2_intrinsics& other_intrinsics, const rs2_extrinsics& extr);
         void set_extrinsics();
 
         stream_filter _prev_stream_filter;
@@ -9,54 +9,124 @@
 #include "image.h"
 #include "stream.h"
 
+#include <rsutils/string/from.h>
+
+#include <algorithm>
+
+#if defined __SSSE3__ && ! defined ANDROID
+#include <tmmintrin.h>
+#endif
+
 namespace librealsense
 {
     //// Unpacking routines ////
-    template<size_t SIZE>
-    void rotate_image_optimized( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
+    namespace
     {
-        auto width_out = height;
-        auto height_out = width;
+        // Blocks are transposed in registers, and walked tile by tile so the destination rows being
+        // written to stay in cache
+        int const TILE = 64;
 
-        auto out = dest[0];
-        uint8_t buffer[8][8 * SIZE]; // = { 0 };
-        for (int i = 0; i <= height - 8; i = i + 8)
+        template< class T >
+        void rotate_pixels( T * out, const T * in, int width, int height, int i_begin, int i_end, int j_begin, int j_end )
         {
-            for (int j = 0; j <= width - 8; j = j + 8)
+            for( int i = i_begin; i < i_end; ++i )
+                for( int j = j_begin; j < j_end; ++j )
+                    out[( width - 1 - j ) * height + ( height - 1 - i )] = in[i * width + j];
+        }
+
+#if defined __SSSE3__ && ! defined ANDROID
+        // Each round interleaves row k with row k + N/2; after log2(N) rounds, the NxN block is transposed
+        template< int N, __m128i ( *LO )( __m128i, __m128i ), __m128i ( *HI )( __m128i, __m128i ) >
+        inline void transpose( __m128i ( &r )[N] )
+        {
+            for( int round = 1; round < N; round *= 2 )
             {
-                for (int ii = 0; ii < 8; ++ii)
+                __m128i t[N];
+                for( int k = 0; k < N / 2; ++k )
                 {
-                    for (int jj = 0; jj < 8; ++jj)
-                    {
-                        auto source_index = ((j + jj) + (width * (i + ii))) * SIZE;
-                        memcpy((void*)(&buffer[7 - jj][(7 - ii) * SIZE]), &source[source_index], SIZE);
-                    }
+                    t[2 * k] = LO( r[k], r[k + N / 2] );
+                    t[2 * k + 1] = HI( r[k], r[k + N / 2] );
                 }
+                for( int k = 0; k < N; ++k )
+                    r[k] = t[k];
+            }
+        }
+
+        inline __m128i unpacklo_epi8( __m128i a, __m128i b ) { return _mm_unpacklo_epi8( a, b ); }
+        inline __m128i unpackhi_epi8( __m128i a, __m128i b ) { return _mm_unpackhi_epi8( a, b ); }
+        inline __m128i unpacklo_epi16( __m128i a, __m128i b ) { return _mm_unpacklo_epi16( a, b ); }
+        inline __m128i unpackhi_epi16( __m128i a, __m128i b ) { return _mm_unpackhi_epi16( a, b ); }
+
+        // The N x N block at source (i, j): the rows are read bottom-up and each is reversed, so that
+        // the transpose lands them in place
+        template< class T >
+        void rotate_block( T * out, const T * in, int width, int height, int i, int j )
+        {
+            int const N = 16 / sizeof( T );
+            const __m128i reverse = sizeof( T ) == 1
+                                      ? _mm_setr_epi8( 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 )
+                                      : _mm_setr_epi8( 14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1 );
+            __m128i r[N];
+            for( int b = 0; b < N; ++b )
+                r[b] = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast< const __m128i * >( in + ( i + N - 1 - b ) * width + j ) ),
+                                         reverse );
+            if( sizeof( T ) == 1 )
+                transpose< N, unpacklo_epi8, unpackhi_epi8 >( r );
+            else
+                transpose< N, unpacklo_epi16, unpackhi_epi16 >( r );
+            auto dst = out + ( width - N - j ) * height + ( height - N - i );
+            for( int a = 0; a < N; ++a )
+                _mm_storeu_si128( reinterpret_cast< __m128i * >( dst + a * height ), r[a] );
+        }
+#else
+        template< class T >
+        void rotate_block( T * out, const T * in, int width, int height, int i, int j )
+        {
+            int const N = 16 / sizeof( T );
+            rotate_pixels( out, in, width, height, i, i + N, j, j + N );
+        }
+#endif
 
-                for (int ii = 0; ii < 8; ++ii)
+        template< class T >
+        void rotate_image( T * out, const T * in, int width, int height )
+        {
+            int const N = 16 / sizeof( T );
+            int const blocks_width = width - width % N;
+            int const blocks_height = height - height % N;
+            int const tile_rows = ( blocks_height + TILE - 1 ) / TILE;
+
+#pragma omp parallel for
+            for( int tile_row = 0; tile_row < tile_rows; ++tile_row )
+            {
+                int const i_begin = tile_row * TILE;
+                int const i_end = std::min( blocks_height, i_begin + TILE );
+                for( int j_begin = 0; j_begin < blocks_width; j_begin += TILE )
                 {
-                    auto out_index = (((height_out - 8 - j + 1) * width_out) - i - 8 + (ii)* width_out);
-                    memcpy(&out[(out_index)* SIZE], &(buffer[ii]), 8 * SIZE);
+                    int const j_end = std::min( blocks_width, j_begin + TILE );
+                    for( int i = i_begin; i < i_end; i += N )
+                        for( int j = j_begin; j < j_end; j += N )
+                            rotate_block( out, in, width, height, i, j );
                 }
             }
+
+            // Whatever is left on the right and bottom edges does not fill a block
+            rotate_pixels( out, in, width, height, 0, blocks_height, blocks_width, width );
+            rotate_pixels( out, in, width, height, blocks_height, height, 0, width );
         }
     }
 
-    template<size_t SIZE>
-    void rotate_image( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
+    void rotate_image( uint8_t * dest, const uint8_t * source, int width, int height, int bpp )
     {
-        auto width_out = height;
-        auto height_out = width;
-
-        auto out = dest[0];
-        for (int i = 0; i < height; ++i)
+        switch( bpp )
         {
-            auto row_offset = i * width;
-            for (int j = 0; j < width; ++j)
-            {
-                auto out_index = (((height_out - j) * width_out) - i - 1) * SIZE;
-                std::memcpy( &out[out_index], &( source[( row_offset + j ) * SIZE] ), SIZE );
-            }
+        case 1:
+            rotate_image( dest, source, width, height );
+            break;
+        case 2:
+            rotate_image( reinterpret_cast< uint16_t * >( dest ), reinterpret_cast< const uint16_t * >( source ), width, height );
+            break;
+        default:
+            throw invalid_value_exception( rsutils::string::from() << "cannot rotate images of " << bpp << " bytes per pixel" );
         }
     }
 
@@ -70,7 +140,7 @@ namespace librealsense
         };
 #pragma pack(pop)
 
-        rotate_image<1>(dest, source, width, height, actual_size);
+        rotate_image(dest[0], source, width, height, 1);
         auto out = dest[0];
         for (int i = (width - 1), out_i = ((width - 1) * 2); i >= 0; --i, out_i -= 2)
         {
@@ -120,10 +190,8 @@ namespace librealsense
         switch (_target_bpp)
         {
         case 1:
-            rotate_image_optimized<1>(dest, source, rotated_width, rotated_height, actual_size);
-            break;
         case 2:
-            rotate_image_optimized<2>(dest, source, rotated_width, rotated_height, actual_size);
+            rotate_image(dest[0], source, rotated_width, rotated_height, _target_bpp);
             break;
         default:
             LOG_ERROR("Rotation transform does not support format: " + std::string(rs2_format_to_string(_target_format)));
@@ -7,6 +7,11 @@
 
 namespace librealsense
 {
+    // Rotates a 'width' x 'height' image of 1- or 2-byte pixels into the 'height' x 'width' 'dest', as
+    // the rotated sensors need it: source row i, column j goes to row width-1-j, column height-1-i.
+    // Done in SIMD-transposed blocks, a tile of blocks at a time.
+    void rotate_image( uint8_t * dest, const uint8_t * source, int width, int height, int bpp );
+
     // Processes rotated frames.
     class rotation_transform : public functional_processing_block
     {
@@ -0,0 +1,270 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "rvl-codec.h"
+
+#include <src/librealsense-exception.h>
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace librealsense
+{
+    namespace rvl
+    {
+        namespace
+        {
+            // Out of line, to keep the decoding loops tight
+            [[noreturn]] void corrupt( const char * what )
+            {
+                throw invalid_value_exception( std::string( "corrupt RVL depth: " ) + what );
+            }
+
+            // Nibbles go into a 64-bit word, lowest first, and words are written little-endian
+            class nibble_writer
+            {
+            public:
+                nibble_writer( uint8_t * out, uint8_t * end )
+                    : _begin( out ), _out( out ), _end( end )
+                {
+                }
+
+                // 3 bits at a time, lowest first, with the 4th bit set when more follow. Up to three nibbles,
+                // which is about every difference, the code is put together without branches: the number of
+                // nibbles is as random as the noise.
+                void put( uint32_t value )
+                {
+                    uint64_t code;
+                    int bits;
+                    if( value < 512 )
+                    {
+                        uint32_t const two = value > 7, three = value > 63;
+                        code = ( value & 7 ) | ( two << 3 ) | ( ( value & 0x38 ) << 1 ) | ( three << 7 )
+                             | ( ( value & 0x1C0 ) << 2 );
+                        bits = 4 * ( 1 + two + three );
+                    }
+                    else
+                    {
+                        code = value & 7;
+                        bits = 4;
+                        while( value > 7 )
+                        {
+                            value >>= 3;
+                            code |= ( 8 | uint64_t( value & 7 ) << 4 ) << ( bits - 4 );
+                            bits += 4;
+                        }
+                    }
+                    // At most 11 nibbles: the word can take them all, or is filled and takes the rest
+                    _word |= code << _shift;
+                    _shift += bits;
+                    if( _shift >= 64 )
+                    {
+                        flush();
+                        _shift -= 64;
+                        _word = _shift ? code >> ( bits - _shift ) : 0;
+                    }
+                }
+
+                // Once full, the code is dropped: what would be written does not fit
+                bool full() const { return _full; }
+
+                // Returns the size of the code, in whole words
+                size_t finish()
+                {
+                    if( _shift )
+                        flush();
+                    return _out - _begin;
+                }
+
+            private:
+                void flush()
+                {
+                    if( _end - _out >= 8 )
+                    {
+                        memcpy( _out, &_word, 8 );
+                        _out += 8;
+                    }
+                    else
+                        _full = true;
+                }
+
+                uint8_t * _begin;
+                uint8_t * _out;
+                uint8_t * _end;
+                uint64_t _word = 0;
+                int _shift = 0;
+                bool _full = false;
+            };
+
+            // The reader keeps the next nibbles in a register, which is topped up every few values, so decoding
+            // a value is a few shifts
+            class nibble_reader
+            {
+            public:
+                nibble_reader( const uint8_t * code, size_t size )
+                    : _code( code ), _size( size )
+                {
+                }
+
+                uint32_t get()
+                {
+                    if( _left < 11 )
+                        refill();
+                    // Same as the writer: up to three nibbles without branches
+                    uint64_t window = _buffer;
+                    uint32_t const two = ( window >> 3 ) & 1, three = ( window >> 7 ) & two;
+                    uint32_t value = ( window & 7 ) | ( ( window >> 1 ) & ( 0x38 & -two ) )
+                                   | ( ( window >> 2 ) & ( 0x1C0 & -three ) );
+                    int nibbles = 1 + two + three;
+                    if( three && ( window & 0x800 ) )
+                    {
+                        for( window >>= 8; window & 8; ++nibbles )
+                        {
+                            if( nibbles == 11 )
+                                corrupt( "value too long" );
+                            window >>= 4;
+                            value |= uint32_t( window & 7 ) << ( 3 * nibbles );
+                        }
+                    }
+                    _buffer >>= 4 * nibbles;
+                    _left -= nibbles;
+                    return value;
+                }
+
+                // Whether more was read than there is
+                bool overrun() const { return 2 * _read - _left > 2 * _size; }
+
+            private:
+                void refill()
+                {
+                    // Past the end is all zeros, which ends any value (and decodes to empty runs, which is caught
+                    // by the time the next refill is that far past the end)
+                    uint64_t more = 0;
+                    if( _read + 8 <= _size )
+                        memcpy( &more, _code + _read, 8 );
+                    else if( _read < _size )
+                        memcpy( &more, _code + _read, _size - _read );
+                    else if( _read > _size + 8 )
+                        corrupt( "code is truncated" );
+                    _buffer |= more << ( 4 * _left );
+                    auto const bytes = ( 16 - _left ) / 2;
+                    _read += bytes;
+                    _left += 2 * bytes;
+                }
+
+                const uint8_t * _code;
+                size_t _size;
+                size_t _read = 0;       // bytes, into the buffer
+                uint64_t _buffer = 0;
+                int _left = 0;          // nibbles in the buffer
+            };
+
+            // Small differences, of either sign, to small numbers: 0, -1, 1, -2, 2...
+            inline uint32_t zigzag( int32_t delta ) { return ( uint32_t( delta ) << 1 ) ^ uint32_t( delta >> 31 ); }
+            inline int32_t unzigzag( uint32_t value ) { return int32_t( value >> 1 ) ^ -int32_t( value & 1 ); }
+
+            // Returns the size of the code, or 0 when it would not be smaller than 'limit'
+            size_t encode( const uint16_t * depth, size_t pixels, uint8_t * out, size_t limit )
+            {
+                nibble_writer writer( out, out + limit );
+                auto p = depth;
+                auto const end = depth + pixels;
+                int32_t previous = 0;
+                while( p != end )
+                {
+                    auto const zeros = p;
+                    while( p != end && ! *p )
+                        ++p;
+                    writer.put( uint32_t( p - zeros ) );
+
+                    auto const valid = p;
+                    while( p != end && *p )
+                        ++p;
+                    writer.put( uint32_t( p - valid ) );
+
+                    for( auto v = valid; v != p; ++v )
+                    {
+                        writer.put( zigzag( int32_t( *v ) - previous ) );
+                        previous = *v;
+                    }
+                    if( writer.full() )
+                        return 0;
+                }
+                auto const size = writer.finish();
+                return writer.full() ? 0 : size;
+            }
+
+            header read_header( const uint8_t * data, size_t size )
+            {
+                header h;
+                if( size < sizeof( h ) )
+                    throw invalid_value_exception( "compressed depth is too small" );
+                memcpy( &h, data, sizeof( h ) );
+                if( h.magic != RVL && h.magic != RAW )
+                    throw invalid_value_exception( "not RVL-compressed depth" );
+                if( h.size > size - sizeof( h ) )
+                    throw invalid_value_exception( "compressed depth is truncated" );
+                if( h.magic == RAW && h.size != h.pixels * sizeof( uint16_t ) )
+                    corrupt( "wrong raw size" );
+                return h;
+            }
+        }
+
+        size_t compress( const uint16_t * depth, size_t pixels, uint8_t * out )
+        {
+            header h = { RVL, uint32_t( pixels ), 0, 0 };
+            auto const raw_size = pixels * sizeof( uint16_t );
+            h.size = uint32_t( encode( depth, pixels, out + sizeof( h ), raw_size ) );
+            if( ! h.size )
+            {
+                h.magic = RAW;
+                h.size = uint32_t( raw_size );
+                memcpy( out + sizeof( h ), depth, raw_size );
+            }
+            memcpy( out, &h, sizeof( h ) );
+            return sizeof( h ) + h.size;
+        }
+
+        size_t decompressed_pixels( const uint8_t * data, size_t size )
+        {
+            return read_header( data, size ).pixels;
+        }
+
+        void decompress( const uint8_t * data, size_t size, uint16_t * depth, size_t pixels )
+        {
+            auto const h = read_header( data, size );
+            if( h.pixels != pixels )
+                throw invalid_value_exception( "compressed depth is not of the expected size" );
+            auto const code = data + sizeof( h );
+            if( h.magic == RAW )
+            {
+                memcpy( depth, code, h.size );
+                return;
+            }
+
+            nibble_reader reader( code, h.size );
+            auto out = depth;
+            auto const end = depth + pixels;
+            int32_t previous = 0;
+            while( out != end )
+            {
+                auto const zeros = reader.get();
+                if( zeros > size_t( end - out ) )
+                    corrupt( "run is too long" );
+                out = std::fill_n( out, zeros, uint16_t( 0 ) );
+
+                auto const valid = reader.get();
+                if( valid > size_t( end - out ) )
+                    corrupt( "run is too long" );
+                for( auto const run_end = out + valid; out != run_end; ++out )
+                {
+                    previous += unzigzag( reader.get() );
+                    *out = uint16_t( previous );
+                }
+            }
+            if( reader.overrun() )
+                corrupt( "code is truncated" );
+        }
+    }
+}
@@ -0,0 +1,44 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace librealsense
+{
+    // Lossless compression of 16-bit depth, as RVL (Wilson, "Fast Lossless Depth Image Compression", 2017): the
+    // image is a sequence of runs of zeros and runs of valid depth, and the valid depth is coded as the difference
+    // from the previous valid pixel. Run lengths and (zigzagged) differences are variable-length: 3 bits at a time,
+    // with a 4th that tells whether more follow, so a smooth surface takes one or two nibbles a pixel.
+    // There is no entropy coding and no table: both directions are one pass, branchy but cache-friendly.
+    //
+    // The compressed data is a header followed by the code, or by the raw depth when that is smaller.
+    namespace rvl
+    {
+        struct header
+        {
+            uint32_t magic;     // RVL or RAW
+            uint32_t pixels;
+            uint32_t size;      // of what follows the header, in bytes
+            uint32_t reserved;
+        };
+
+        const uint32_t RVL = 0x314C5652;  // "RVL1"
+        const uint32_t RAW = 0x31574152;  // "RAW1"
+
+        // The most 'pixels' can take compressed: raw, with the header
+        inline size_t max_compressed_size( size_t pixels ) { return sizeof( header ) + pixels * sizeof( uint16_t ); }
+
+        // Returns the number of bytes written to 'out', which must have room for max_compressed_size(pixels)
+        size_t compress( const uint16_t * depth, size_t pixels, uint8_t * out );
+
+        // The number of pixels compressed data decompresses to; throws if it is not compressed depth
+        size_t decompressed_pixels( const uint8_t * data, size_t size );
+
+        // Throws if the data is corrupt or does not decompress to exactly 'pixels'
+        void decompress( const uint8_t * data, size_t size, uint16_t * depth, size_t pixels );
+    }
+}
@@ -0,0 +1,76 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "simd-isa.h"
+
+#if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+
+namespace librealsense
+{
+    namespace
+    {
+        bool cpu_has_avx2()
+        {
+#if defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+            int info[4];
+            __cpuidex( info, 0, 0 );
+            if( info[0] < 7 )
+                return false;
+            __cpuidex( info, 1, 0 );
+            bool const osxsave = ( info[2] & ( 1 << 27 ) ) != 0;
+            bool const avx = ( info[2] & ( 1 << 28 ) ) != 0;
+            if( ! osxsave || ! avx || ( _xgetbv( 0 ) & 6 ) != 6 )  // OS saves the YMM registers
+                return false;
+            __cpuidex( info, 7, 0 );
+            return ( info[1] & ( 1 << 5 ) ) != 0;
+#elif ( defined( __GNUC__ ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && ! defined( ANDROID )
+            return __builtin_cpu_supports( "avx2" ) != 0;
+#else
+            return false;
+#endif
+        }
+    }
+
+    bool cpu_supports( simd_isa which )
+    {
+        switch( which )
+        {
+        case simd_isa::scalar:
+            return true;
+        case simd_isa::ssse3:
+#if defined __SSSE3__ && ! defined ANDROID
+            return true;
+#else
+            return false;
+#endif
+        case simd_isa::avx2:
+        {
+            static const bool avx2 = cpu_has_avx2();
+            return avx2;
+        }
+        case simd_isa::neon:
+#if defined( __ARM_NEON ) || defined( __ARM_NEON__ )
+            return true;
+#else
+            return false;
+#endif
+        }
+        return false;
+    }
+
+    const char * get_string( simd_isa which )
+    {
+        switch( which )
+        {
+        case simd_isa::scalar: return "scalar";
+        case simd_isa::ssse3: return "SSSE3";
+        case simd_isa::avx2: return "AVX2";
+        case simd_isa::neon: return "NEON";
+        }
+        return "unknown";
+    }
+}
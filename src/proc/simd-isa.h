@@ -0,0 +1,18 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+
+namespace librealsense
+{
+    // The instruction sets the vectorized kernels are written for. Each kernel module implements every
+    // one it can, dispatches at runtime to the best supported, and is tested against the scalar one.
+    enum class simd_isa { scalar, ssse3, avx2, neon };
+
+    // Whether the instructions were compiled in and the CPU can run them. Kernels that live in their
+    // own AVX2 translation unit must also check that it was actually compiled with AVX2 enabled.
+    bool cpu_supports( simd_isa );
+
+    const char * get_string( simd_isa );
+}
@@ -134,152 +134,4 @@ namespace librealsense
 #endif
         return (float3*)output.get_vertices();
     }
-
-    void pointcloud_sse::get_texture_map_sse( float2 * texture_map,
-                                          const float3 * points,
-                                          const unsigned int width,
-                                          const unsigned int height,
-                                          const rs2_intrinsics & other_intrinsics,
-                                          const rs2_extrinsics & extr,
-                                          float2 * pixels_ptr )
-    {
-        auto tex_ptr = texture_map;
-
-#ifdef __SSSE3__
-        auto point = reinterpret_cast<const float*>(points);
-        auto res = reinterpret_cast<float*>(tex_ptr);
-        auto res1 = reinterpret_cast<float*>(pixels_ptr);
-
-        __m128 r[9];
-        __m128 t[3];
-        __m128 c[5];
-
-        for (int i = 0; i < 9; ++i)
-        {
-            r[i] = _mm_set_ps1(extr.rotation[i]);
-        }
-        for (int i = 0; i < 3; ++i)
-        {
-            t[i] = _mm_set_ps1(extr.translation[i]);
-        }
-        for (int i = 0; i < 5; ++i)
-        {
-            c[i] = _mm_set_ps1(other_intrinsics.coeffs[i]);
-        }
-
-        auto fx = _mm_set_ps1(other_intrinsics.fx);
-        auto fy = _mm_set_ps1(other_intrinsics.fy);
-        auto ppx = _mm_set_ps1(other_intrinsics.ppx);
-        auto ppy = _mm_set_ps1(other_intrinsics.ppy);
-        auto w = _mm_set_ps1(float(other_intrinsics.width));
-        auto h = _mm_set_ps1(float(other_intrinsics.height));
-        auto mask_brown_conrady = _mm_set_ps1(RS2_DISTORTION_BROWN_CONRADY);
-        auto mask_distortion_none = _mm_set_ps1(RS2_DISTORTION_NONE);
-        auto zero = _mm_set_ps1(0);
-        auto one = _mm_set_ps1(1);
-        auto two = _mm_set_ps1(2);
-
-        for (auto i = 0UL; i < height*width * 3; i += 12)
-        {
-            //load 4 points (x,y,z)
-            auto xyz1 = _mm_load_ps(point + i);
-            auto xyz2 = _mm_load_ps(point + i + 4);
-            auto xyz3 = _mm_load_ps(point + i + 8);
-
-
-            //gather x,y,z
-            auto yz = _mm_shuffle_ps(xyz1, xyz2, _MM_SHUFFLE(1, 0, 2, 1));
-            auto xy = _mm_shuffle_ps(xyz2, xyz3, _MM_SHUFFLE(2, 1, 3, 2));
-
-            auto x = _mm_shuffle_ps(xyz1, xy, _MM_SHUFFLE(2, 0, 3, 0));
-            auto y = _mm_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
-            auto z = _mm_shuffle_ps(yz, xyz3, _MM_SHUFFLE(3, 0, 3, 1));
-
-            auto p_x = _mm_add_ps(_mm_mul_ps(r[0], x), _mm_add_ps(_mm_mul_ps(r[3], y), _mm_add_ps(_mm_mul_ps(r[6], z), t[0])));
-            auto p_y = _mm_add_ps(_mm_mul_ps(r[1], x), _mm_add_ps(_mm_mul_ps(r[4], y), _mm_add_ps(_mm_mul_ps(r[7], z), t[1])));
-            auto p_z = _mm_add_ps(_mm_mul_ps(r[2], x), _mm_add_ps(_mm_mul_ps(r[5], y), _mm_add_ps(_mm_mul_ps(r[8], z), t[2])));
-
-            p_x = _mm_div_ps(p_x, p_z);
-            p_y = _mm_div_ps(p_y, p_z);
-
-            // if(model == RS2_DISTORTION_MODIFIED_BROWN_CONRADY)
-            auto dist = _mm_set_ps1( (float)other_intrinsics.model );
-
-            auto r2 = _mm_add_ps(_mm_mul_ps(p_x, p_x), _mm_mul_ps(p_y, p_y));
-            auto r3 = _mm_add_ps(_mm_mul_ps(c[1], _mm_mul_ps(r2, r2)), _mm_mul_ps(c[4], _mm_mul_ps(r2, _mm_mul_ps(r2, r2))));
-            auto f = _mm_add_ps(one, _mm_add_ps(_mm_mul_ps(c[0], r2), r3));
-
-            auto brown = _mm_cmpeq_ps(mask_brown_conrady, dist);
-           
-            auto x_f = _mm_mul_ps(p_x, f);
-            auto y_f = _mm_mul_ps(p_y, f);
-
-            auto x_f_dist = _mm_or_ps(_mm_and_ps(brown, p_x), _mm_andnot_ps(brown, x_f));
-            auto y_f_dist = _mm_or_ps(_mm_and_ps(brown, p_y), _mm_andnot_ps(brown, y_f));
-
-            auto r4 = _mm_mul_ps(c[3], _mm_add_ps(r2, _mm_mul_ps(two, _mm_mul_ps(x_f_dist, x_f_dist))));
-            auto d_x = _mm_add_ps(x_f, _mm_add_ps(_mm_mul_ps(two, _mm_mul_ps(c[2], _mm_mul_ps(x_f_dist, y_f_dist))), r4));
-
-            auto r5 = _mm_mul_ps(c[2], _mm_add_ps(r2, _mm_mul_ps(two, _mm_mul_ps(y_f_dist, y_f_dist))));
-            auto d_y = _mm_add_ps(y_f, _mm_add_ps(_mm_mul_ps(two, _mm_mul_ps(c[3], _mm_mul_ps(x_f_dist, y_f_dist))), r5));
-
-            auto distortion_none = _mm_cmpeq_ps(mask_distortion_none, dist);
-
-            p_x = _mm_or_ps(_mm_and_ps(distortion_none, p_x ), _mm_andnot_ps(distortion_none, d_x));
-            p_y = _mm_or_ps(_mm_and_ps(distortion_none, p_y ), _mm_andnot_ps(distortion_none, d_y));
-
-            //TODO: add handle to RS2_DISTORTION_FTHETA
-
-            //zero the x and y if z is zero
-            auto cmp = _mm_cmpneq_ps(z, zero);
-            p_x = _mm_and_ps(_mm_add_ps(_mm_mul_ps(p_x, fx), ppx), cmp);
-            p_y = _mm_and_ps(_mm_add_ps(_mm_mul_ps(p_y, fy), ppy), cmp);
-
-            //scattering of the x y before normalize and store in pixels_ptr
-            auto xx_yy01 = _mm_shuffle_ps(p_x, p_y, _MM_SHUFFLE(2, 0, 2, 0));
-            auto xx_yy23 = _mm_shuffle_ps(p_x, p_y, _MM_SHUFFLE(3, 1, 3, 1));
-
-            auto xyxy1 = _mm_shuffle_ps(xx_yy01, xx_yy23, _MM_SHUFFLE(2, 0, 2, 0));
-            auto xyxy2 = _mm_shuffle_ps(xx_yy01, xx_yy23, _MM_SHUFFLE(3, 1, 3, 1));
-
-            _mm_stream_ps(res1, xyxy1);
-            _mm_stream_ps(res1 + 4, xyxy2);
-            res1 += 8;
-
-            //normalize x and y
-            p_x = _mm_div_ps(p_x, w);
-            p_y = _mm_div_ps(p_y, h);
-
-            //scattering of the x y after normalize and store in tex_ptr
-            xx_yy01 = _mm_shuffle_ps(p_x, p_y, _MM_SHUFFLE(2, 0, 2, 0));
-            xx_yy23 = _mm_shuffle_ps(p_x, p_y, _MM_SHUFFLE(3, 1, 3, 1));
-
-            xyxy1 = _mm_shuffle_ps(xx_yy01, xx_yy23, _MM_SHUFFLE(2, 0, 2, 0));
-            xyxy2 = _mm_shuffle_ps(xx_yy01, xx_yy23, _MM_SHUFFLE(3, 1, 3, 1));
-
-            _mm_stream_ps(res, xyxy1);
-            _mm_stream_ps(res + 4, xyxy2);
-            res += 8;
-        }
-#endif
-
-    }
-
-    void pointcloud_sse::get_texture_map( rs2::points output,
-                                          const float3 * points,
-                                          const unsigned int width,
-                                          const unsigned int height,
-                                          const rs2_intrinsics & other_intrinsics,
-                                          const rs2_extrinsics & extr,
-                                          float2 * pixels_ptr )
-    {
-
-        get_texture_map_sse( (float2 *)output.get_texture_coordinates(),
-                         points,
-                         width,
-                         height,
-                         other_intrinsics,
-                         extr,
-                         pixels_ptr );
-    }
     }
@@ -70,6 +70,25 @@ namespace librealsense
         {
             std::lock_guard<std::mutex> lock(_mutex);
 
+            // Find out which inputs nobody else refers to before we add our own references: the input
+            // itself, or the frames of a frameset that only the frameset holds
+            _exclusive_inputs.clear();
+            auto input = dynamic_cast<librealsense::frame*>((frame_interface*)f.get());
+            if (input && input->is_exclusive())
+            {
+                if (auto cf = dynamic_cast<composite_frame*>(input))
+                {
+                    for (size_t i = 0; i < cf->get_embedded_frames_count(); i++)
+                    {
+                        auto embedded = dynamic_cast<librealsense::frame*>(cf->get_frame(int(i)));
+                        if (embedded && embedded->is_exclusive())
+                            _exclusive_inputs.push_back(embedded);
+                    }
+                }
+                else
+                    _exclusive_inputs.push_back(input);
+            }
+
             std::vector<rs2::frame> frames_to_process;
 
             frames_to_process.push_back(f);
@@ -100,6 +119,8 @@ namespace librealsense
                 }
             }
 
+            _exclusive_inputs.clear();
+
             auto out = prepare_output(source, f, results);
             if(out)
                 source.frame_ready(out);
@@ -109,6 +130,28 @@ namespace librealsense
         processing_block::set_processing_callback(std::shared_ptr<rs2_frame_processor_callback>(callback));
     }
 
+    rs2::frame generic_processing_block::allocate_output_frame(const rs2::frame_source& source, const rs2::stream_profile& profile,
+        const rs2::frame& original, int new_bpp, int new_width, int new_height, int new_stride, rs2_extension frame_type)
+    {
+        auto fi = (frame_interface*)original.get();
+        if (std::find(_exclusive_inputs.begin(), _exclusive_inputs.end(), fi) != _exclusive_inputs.end())
+        {
+            auto vf = original.as<rs2::video_frame>();
+            if (vf && rs2_is_frame_extendable_to(original.get(), frame_type, nullptr)
+                && original.get_profile().format() == profile.format()
+                && vf.get_bytes_per_pixel() == new_bpp
+                && vf.get_width() == new_width && vf.get_height() == new_height
+                && vf.get_stride_in_bytes() == new_stride)
+            {
+                // Only one output can be written over each input
+                _exclusive_inputs.erase(std::find(_exclusive_inputs.begin(), _exclusive_inputs.end(), fi));
+                fi->set_stream(std::dynamic_pointer_cast<stream_profile_interface>(profile.get()->profile->shared_from_this()));
+                return original;
+            }
+        }
+        return source.allocate_video_frame(profile, original, new_bpp, new_width, new_height, new_stride, frame_type);
+    }
+
     rs2::frame generic_processing_block::prepare_output(const rs2::frame_source& source, rs2::frame input, std::vector<rs2::frame> results)
     {
         // this function prepares the processing block output frame(s) by the following heuristic:
@@ -116,8 +159,8 @@ namespace librealsense
         // in case the input frame is a frameset, create an output frameset from the input frameset and the processed frame by the following heuristic:
         // if one of the input frames has the same stream type and format as the processed frame,
         //     remove the input frame from the output frameset (i.e. temporal filter), otherwise keep the input frame (i.e. colorizer).
-        // the exception is in case one of the input frames is z16/z16h or disparity and the result frame is disparity or z16 respectively,
-        // in this case the input frame will be removed.
+        // the exception is in case one of the input frames is z16/z16h/z16rvl or disparity and the result frame is disparity or z16 respectively,
+        // in this case the input frame will be removed. Likewise, a z16 input frame is replaced by its compressed z16rvl result.
 
         if (results.empty())
         {
@@ -126,6 +169,7 @@ namespace librealsense
 
         bool disparity_result_frame = false;
         bool depth_result_frame = false;
+        bool compressed_depth_result_frame = false;
 
         for (auto f : results)
         {
@@ -134,6 +178,8 @@ namespace librealsense
                 disparity_result_frame = true;
             if (format == RS2_FORMAT_Z16)
                 depth_result_frame = true;
+            if (format == RS2_FORMAT_Z16RVL)
+                compressed_depth_result_frame = true;
         }
 
         std::vector<rs2::frame> original_set;
@@ -141,9 +187,9 @@ namespace librealsense
             composite.foreach_rs([&](const rs2::frame& frame)
             {
                 auto format = frame.get_profile().format();
-                if (depth_result_frame &&  val_in_range(format, { RS2_FORMAT_DISPARITY32, RS2_FORMAT_DISPARITY16, RS2_FORMAT_Z16H }))
+                if (depth_result_frame &&  val_in_range(format, { RS2_FORMAT_DISPARITY32, RS2_FORMAT_DISPARITY16, RS2_FORMAT_Z16H, RS2_FORMAT_Z16RVL }))
                     return;
-                if (disparity_result_frame && format == RS2_FORMAT_Z16)
+                if ((disparity_result_frame || compressed_depth_result_frame) && format == RS2_FORMAT_Z16)
                     return;
                 original_set.push_back(frame);
             });
@@ -474,6 +520,33 @@ namespace librealsense
         return res;
     }
 
+    frame_interface* synthetic_source::allocate_motion_batch_frame(std::shared_ptr<stream_profile_interface> stream,
+        frame_interface* original,
+        size_t samples)
+    {
+        auto of = dynamic_cast<frame*>(original);
+        if (!of)
+            throw std::runtime_error("Frame interface is not frame");
+
+        frame_additional_data data = of->additional_data;
+        auto res = _actual_source.alloc_frame( { stream->get_stream_type(), stream->get_stream_index(), RS2_EXTENSION_MOTION_BATCH_FRAME },
+                                               samples * sizeof( float3 ),
+                                               std::move( data ),
+                                               true );
+        if (!res) throw wrong_api_call_sequence_exception("Out of frame resources!");
+
+        auto bf = dynamic_cast<motion_batch_frame*>(res);
+        if (!bf)
+            throw std::runtime_error("Frame interface is not motion batch frame");
+
+        bf->metadata_parsers = of->metadata_parsers;
+        bf->timestamps.assign(samples, of->get_frame_timestamp());
+        bf->set_sensor(original->get_sensor());
+        res->set_stream(stream);
+
+        return res;
+    }
+
     int get_embeded_frames_size(frame_interface* f)
     {
         if (f == nullptr) return 0;
@@ -502,7 +575,7 @@ namespace librealsense
         }
     }
 
-    frame_interface* synthetic_source::allocate_composite_frame(std::vector<frame_holder> holders)
+    frame_interface* synthetic_source::allocate_composite_frame(std::vector<frame_holder> && holders)
     {
         frame_additional_data d{};
 
@@ -36,7 +36,11 @@ namespace librealsense
             frame_interface* original,
             rs2_extension frame_type = RS2_EXTENSION_MOTION_FRAME) override;
 
-        frame_interface* allocate_composite_frame(std::vector<frame_holder> frames) override;
+        frame_interface* allocate_motion_batch_frame(std::shared_ptr<stream_profile_interface> stream,
+            frame_interface* original,
+            size_t samples) override;
+
+        frame_interface* allocate_composite_frame(std::vector<frame_holder> && frames) override;
 
         frame_interface* allocate_points(std::shared_ptr<stream_profile_interface> stream, 
             frame_interface* original, rs2_extension frame_type = RS2_EXTENSION_POINTS) override;
@@ -79,6 +83,16 @@ namespace librealsense
 
         virtual bool should_process(const rs2::frame& frame) = 0;
         virtual rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) = 0;
+
+        // For blocks whose output has the same layout as their input: if nothing outside the block
+        // refers to 'original', it is retagged with 'profile' and returned, to be written to in place
+        // (the caller can tell by comparing the two). Otherwise, a new frame is allocated.
+        rs2::frame allocate_output_frame(const rs2::frame_source& source, const rs2::stream_profile& profile,
+            const rs2::frame& original, int new_bpp, int new_width, int new_height, int new_stride, rs2_extension frame_type);
+
+    private:
+        // The input frames that were handed over to the current invocation
+        std::vector<frame_interface*> _exclusive_inputs;
     };
 
     struct stream_filter
@@ -10,6 +10,7 @@
 #include "environment.h"
 #include "option.h"
 #include "threshold.h"
+#include "depth-kernels.h"
 #include "image.h"
 
 namespace librealsense
@@ -47,7 +48,7 @@ namespace librealsense
         auto vf = f.as<rs2::depth_frame>();
         auto width = vf.get_width();
         auto height = vf.get_height();
-        auto new_f = source.allocate_video_frame(_target_stream_profile, f,
+        auto new_f = allocate_output_frame(source, _target_stream_profile, f,
             vf.get_bytes_per_pixel(), width, height, vf.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME);
 
         if (new_f)
@@ -66,12 +67,8 @@ namespace librealsense
             ptr->set_sensor(orig->get_sensor());
             auto du = orig->get_units();
 
-            memset(new_data, 0, width * height * sizeof(uint16_t));
-            for (int i = 0; i < width * height; i++)
-            {
-                auto dist = du * depth_data[i];
-                if (dist >= _min && dist <= _max) new_data[i] = depth_data[i];
-            }
+            // new_data may be depth_data, when the frame is processed in place
+            depth_kernels::threshold(new_data, depth_data, width * height, du, _min, _max);
 
             return new_f;
         }
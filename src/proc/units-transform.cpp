@@ -9,6 +9,7 @@
 #include "proc/synthetic-stream.h"
 #include "environment.h"
 #include "units-transform.h"
+#include "depth-kernels.h"
 
 namespace librealsense
 {
@@ -71,12 +72,7 @@ namespace librealsense
 
             ptr->set_sensor(orig->get_sensor());
 
-            memset(new_data, 0, _width * _height * sizeof(float));
-            for (int i = 0; i < _width * _height; i++)
-            {
-                float dist = *_depth_units * depth_data[i];
-                new_data[i] = dist;
-            }
+            depth_kernels::to_meters(new_data, depth_data, int(_width * _height), *_depth_units);
 
             return new_f;
         }
@@ -3,6 +3,7 @@
 
 #include "y12i-to-y16y16-mipi.h"
 #include "stream.h"
+#include "interleaved-split.h"
 #ifdef RS2_USE_CUDA
 #include "cuda/cuda-conversion.cuh"
 #endif
@@ -18,9 +19,7 @@ namespace librealsense
 #ifdef RS2_USE_CUDA
         rscuda::split_frame_y16_y16_from_y12i_cuda(dest, count, reinterpret_cast<const y12i_pixel_mipi *>(source));
 #else
-        split_frame(dest, count, reinterpret_cast<const y12i_pixel_mipi*>(source),
-            [](const y12i_pixel_mipi& p) -> uint16_t { return p.l() << 6 | p.l() >> 4; },  // We want to convert 10-bit data to 16-bit data
-            [](const y12i_pixel_mipi& p) -> uint16_t { return p.r() << 6 | p.r() >> 4; }); // Multiply by 64 1/16 to efficiently approximate 65535/1023
+        split_y12i_mipi(dest, source, count);  // 10-bit data is converted to 16 bits
 #endif
     }
 
@@ -3,6 +3,7 @@
 
 #include "y16i-to-y10msby10msb.h"
 #include "stream.h"
+#include "interleaved-split.h"
 // CUDA TODO
 //#ifdef RS2_USE_CUDA
 //#include "cuda/cuda-conversion.cuh"
@@ -10,16 +11,6 @@
 
 namespace librealsense
 {
-    struct y16i_pixel { uint16_t left : 16, right : 16;
-                        // explanation of "return x << 6 | x >> 4" :
-                        // Since the data is received only in 10 bits, and the conversion is to 16 bits, 
-                        // the range moves from [0 : 2^10-1] to [0 : 2^16-1], so the values should be converted accordingly:
-                        // x is range [0 : 2^10-1] is converted to y = x * (2^16-1)/(2^10-1) approx= x * (64 + 1/16)
-                        // And x * (64 + 1/16) = x * 64 + x * 1/16 = x << 6 | x >> 4
-                        // This operation is done using shiftings to make it more efficient, and with a non-significant accuracy loss.
-                        uint16_t l() const { return left << 6 | left >> 4; }
-                        uint16_t r() const { return right << 6 | right >> 4; }
-    };
     void unpack_y10msb_y10msb_from_y16i( uint8_t * const dest[], const uint8_t * source, int width, int height, int actual_size)
     {
         auto count = width * height;
@@ -27,9 +18,7 @@ namespace librealsense
 //#ifdef RS2_USE_CUDA
 //        rscuda::split_frame_y10msb_y10msb_from_y16i_cuda(dest, count, reinterpret_cast<const y12i_pixel*>(source));
 //#else
-        split_frame(dest, count, reinterpret_cast<const y16i_pixel*>(source),
-            [](const y16i_pixel& p) -> uint16_t { return (p.l()); },
-            [](const y16i_pixel& p) -> uint16_t { return (p.r()); });
+        split_y16i(dest, source, count);
 //#endif
     }
 
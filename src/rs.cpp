@@ -29,6 +29,10 @@
 #include "proc/units-transform.h"
 #include "proc/disparity-transform.h"
 #include "proc/syncer-processing-block.h"
+#include "proc/multi-device-syncer.h"
+#include "proc/motion-batcher.h"
+#include "proc/depth-metrics.h"
+#include "proc/depth-compression.h"
 #include "proc/decimation-filter.h"
 #include "proc/spatial-filter.h"
 #include "proc/hole-filling-filter.h"
@@ -219,6 +223,14 @@ struct rs2_firmware_log_message
     std::shared_ptr<librealsense::fw_logs::fw_logs_binary_data> firmware_log_binary_data;
 };
 
+struct rs2_firmware_log_parser
+{
+    std::shared_ptr<librealsense::fw_logs::fw_logs_parser> parser;
+    // Kept between calls, so parsing allocates nothing per log
+    std::vector<librealsense::fw_logs::fw_log_entry> entries;
+    std::string text;
+};
+
 struct rs2_firmware_log_parsed_message
 {
     std::shared_ptr<librealsense::fw_logs::fw_log_data> firmware_log_parsed;
@@ -1303,6 +1315,20 @@ rs2_time_t rs2_get_frame_timestamp(const rs2_frame* frame_ref, rs2_error** error
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
 
+rs2_time_t rs2_get_frame_age(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame_ref);
+    auto f = (frame_interface*)frame_ref;
+    auto arrival = f->get_frame_system_time();
+    if (auto composite = dynamic_cast<composite_frame*>(f))
+    {
+        for (size_t i = 0; i < composite->get_embedded_frames_count(); i++)
+            arrival = std::min(arrival, composite->get_frame(int(i))->get_frame_system_time());
+    }
+    return time_service::get_time() - arrival;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
+
 rs2_timestamp_domain rs2_get_frame_timestamp_domain(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame_ref);
@@ -1379,6 +1405,18 @@ unsigned long long rs2_get_frame_number(const rs2_frame* frame, rs2_error** erro
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
 
+// Meant to be called for every frame: no API logger and no dynamic_cast
+void rs2_get_frame_view(const rs2_frame* frame, rs2_frame_view* view, rs2_error** error) try
+{
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_NOT_NULL(view);
+    ((frame_interface*)frame)->get_view(*view);
+}
+catch(...)
+{
+    librealsense::translate_exception(__FUNCTION__, "", error);
+}
+
 void rs2_release_frame(rs2_frame* frame) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
@@ -1861,6 +1899,7 @@ int rs2_is_frame_extendable_to(const rs2_frame* f, rs2_extension extension_type,
     case RS2_EXTENSION_DEPTH_FRAME     : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::depth_frame)     != nullptr;
     case RS2_EXTENSION_DISPARITY_FRAME : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::disparity_frame) != nullptr;
     case RS2_EXTENSION_MOTION_FRAME    : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::motion_frame)    != nullptr;
+    case RS2_EXTENSION_MOTION_BATCH_FRAME: return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::motion_batch_frame) != nullptr;
     case RS2_EXTENSION_POSE_FRAME      : return VALIDATE_INTERFACE_NO_THROW((frame_interface*)f, librealsense::pose_frame)      != nullptr;
 
     default:
@@ -1885,6 +1924,10 @@ int rs2_is_processing_block_extendable_to(const rs2_processing_block* f, rs2_ext
     case RS2_EXTENSION_DEPTH_HUFFMAN_DECODER: throw not_implemented_exception( "deprecated" );
     case RS2_EXTENSION_HDR_MERGE: return VALIDATE_INTERFACE_NO_THROW((processing_block_interface*)(f->block.get()), librealsense::hdr_merge) != nullptr;
     case RS2_EXTENSION_SEQUENCE_ID_FILTER: return VALIDATE_INTERFACE_NO_THROW((processing_block_interface*)(f->block.get()), librealsense::sequence_id_filter) != nullptr;
+    case RS2_EXTENSION_DEPTH_METRICS_FILTER: return VALIDATE_INTERFACE_NO_THROW((processing_block_interface*)(f->block.get()), librealsense::depth_metrics) != nullptr;
+    case RS2_EXTENSION_DEPTH_ENCODER: return VALIDATE_INTERFACE_NO_THROW((processing_block_interface*)(f->block.get()), librealsense::depth_encoder) != nullptr;
+    case RS2_EXTENSION_DEPTH_DECODER: return VALIDATE_INTERFACE_NO_THROW((processing_block_interface*)(f->block.get()), librealsense::depth_decoder) != nullptr;
+    case RS2_EXTENSION_MOTION_BATCHER: return VALIDATE_INTERFACE_NO_THROW((processing_block_interface*)(f->block.get()), librealsense::motion_batcher) != nullptr;
   
     default:
         return false;
@@ -2077,6 +2120,17 @@ rs2_device* rs2_create_record_device_ex(const rs2_device* device, const char* fi
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file)
 
+rs2_device* rs2_create_record_device_with_depth_compression(const rs2_device* device, const char* file, int compression_enabled, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(file);
+
+    return new rs2_device({
+        std::make_shared<record_device>(device->device, std::make_shared<ros_writer>(file, compression_enabled != 0, true))
+        });
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device, file)
+
 void rs2_record_device_pause(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -2395,6 +2449,14 @@ void rs2_config_enable_record_to_file(rs2_config* config, const char* file, rs2_
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, config, file)
 
+void rs2_config_enable_latest_frames_only(rs2_config* config, int enable, rs2_error ** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(config);
+
+    config->config->enable_latest_frames_only(enable != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, config, enable)
+
 void rs2_config_disable_stream(rs2_config* config, rs2_stream stream, rs2_error ** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(config);
@@ -2518,6 +2580,83 @@ rs2_processing_block* rs2_create_sync_processing_block(rs2_error** error) BEGIN_
 }
 NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
 
+rs2_processing_block* rs2_create_multi_device_syncer(int match_frame_counter, double tolerance, int queue_size, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_RANGE(queue_size, 1, 64);
+    auto block = std::make_shared<librealsense::multi_device_syncer>(match_frame_counter != 0, tolerance, size_t(queue_size));
+
+    return new rs2_processing_block{ block };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, match_frame_counter, tolerance, queue_size)
+
+rs2_processing_block* rs2_create_motion_batcher(double latency, int max_samples, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_RANGE(max_samples, 1, 10000);
+    auto block = std::make_shared<librealsense::motion_batcher>(latency, size_t(max_samples));
+
+    return new rs2_processing_block{ block };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, latency, max_samples)
+
+void rs2_motion_batcher_set_intrinsics(rs2_processing_block* block, rs2_stream stream, const rs2_motion_device_intrinsic* intrinsics, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    VALIDATE_ENUM(stream);
+    VALIDATE_NOT_NULL(intrinsics);
+    auto batcher = VALIDATE_INTERFACE(block->block, librealsense::motion_batcher);
+    batcher->set_intrinsics(stream, *intrinsics);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, stream, intrinsics)
+
+rs2_processing_block* rs2_create_depth_metrics(rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::depth_metrics>();
+
+    return new rs2_processing_block{ block };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
+void rs2_depth_metrics_set_roi(rs2_processing_block* block, int min_x, int min_y, int max_x, int max_y, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    auto metrics = VALIDATE_INTERFACE(block->block, librealsense::depth_metrics);
+    metrics->set_roi(min_x, min_y, max_x, max_y);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, min_x, min_y, max_x, max_y)
+
+void rs2_depth_metrics_set_ground_truth(rs2_processing_block* block, float ground_truth, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    auto metrics = VALIDATE_INTERFACE(block->block, librealsense::depth_metrics);
+    metrics->set_ground_truth(ground_truth);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, ground_truth)
+
+void rs2_depth_metrics_get(rs2_processing_block* block, rs2_depth_metrics* metrics, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    VALIDATE_NOT_NULL(metrics);
+    auto dm = VALIDATE_INTERFACE(block->block, librealsense::depth_metrics);
+    *metrics = dm->get_metrics();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, metrics)
+
+rs2_processing_block* rs2_create_depth_encoder(rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::depth_encoder>();
+
+    return new rs2_processing_block{ block };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
+rs2_processing_block* rs2_create_depth_decoder(rs2_error** error) BEGIN_API_CALL
+{
+    auto block = std::make_shared<librealsense::depth_decoder>();
+
+    return new rs2_processing_block{ block };
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
 void rs2_start_processing(rs2_processing_block* block, rs2_frame_callback* on_frame, rs2_error** error) BEGIN_API_CALL
 {
     // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
@@ -2860,6 +2999,22 @@ void rs2_pose_frame_get_pose_data(const rs2_frame* frame, rs2_pose* pose, rs2_er
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, frame, pose)
 
+int rs2_motion_batch_frame_get_sample_count(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto bf = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::motion_batch_frame);
+    return int(bf->get_sample_count());
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
+
+const double* rs2_motion_batch_frame_get_timestamps(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto bf = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::motion_batch_frame);
+    return bf->timestamps.data();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame)
+
 void rs2_extract_target_dimensions(const rs2_frame* frame_ref, rs2_calib_target_type calib_type, float* target_dims, unsigned int target_dims_size, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame_ref);
@@ -3873,6 +4028,41 @@ unsigned int rs2_get_fw_log_parsed_sequence_id(rs2_firmware_log_parsed_message*
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, fw_log_parsed_msg)
 
+rs2_firmware_log_parser* rs2_create_fw_log_parser(const char* xml_content, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(xml_content);
+    return new rs2_firmware_log_parser{ std::make_shared<librealsense::fw_logs::fw_logs_parser>(std::string(xml_content)) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, xml_content)
+
+void rs2_delete_fw_log_parser(rs2_firmware_log_parser* parser) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(parser);
+    delete parser;
+}
+NOEXCEPT_RETURN(, parser)
+
+rs2_raw_data_buffer* rs2_parse_raw_fw_logs(rs2_firmware_log_parser* parser, const void* raw_logs, unsigned int size, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(parser);
+    VALIDATE_NOT_NULL(raw_logs);
+
+    parser->parser->parse_fw_logs(static_cast<const uint8_t*>(raw_logs), size, parser->entries, parser->text);
+
+    std::ostringstream ss;
+    for (auto const& entry : parser->entries)
+    {
+        ss << entry.timestamp << " " << entry.sequence << " "
+           << fw_logs::fw_logs_severity_to_log_severity(entry.severity) << " " << *entry.thread_name << " "
+           << *entry.file_name << " " << entry.line << " ";
+        ss.write(parser->text.data() + entry.message_begin, entry.message_end - entry.message_begin);
+        ss << "\n";
+    }
+    auto text = ss.str();
+    return new rs2_raw_data_buffer{ std::vector<uint8_t>(text.begin(), text.end()) };
+}
+HANDLE_EXCEPTIONS_AND_RETURN(nullptr, parser, raw_logs, size)
+
 rs2_terminal_parser* rs2_create_terminal_parser(const char* xml_content, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(xml_content);
@@ -62,6 +62,7 @@ namespace librealsense
                                   RS2_EXTENSION_DEPTH_FRAME,
                                   RS2_EXTENSION_DISPARITY_FRAME,
                                   RS2_EXTENSION_MOTION_FRAME,
+                                  RS2_EXTENSION_MOTION_BATCH_FRAME,
                                   RS2_EXTENSION_POSE_FRAME };
 
         _metadata_parsers = metadata_parsers;
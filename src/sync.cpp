@@ -130,16 +130,7 @@ namespace librealsense
     {
         for (auto&& matcher : matchers)
         {
-            for (auto&& stream : matcher->get_streams())
-            {
-                matcher->set_callback(
-                    [&]( frame_holder f, const syncronization_environment & env ) {
-                        LOG_IF_ENABLE( "<-- " << *f.frame << "  " << _name, env );
-                        sync( std::move( f ), env );
-                    } );
-                _matchers[stream] = matcher;
-                _streams_id.push_back(stream);
-            }
+            add_slot( matcher );
             for (auto&& stream : matcher->get_streams_types())
             {
                 _streams_type.push_back(stream);
@@ -149,7 +140,7 @@ namespace librealsense
         _name = create_composite_name(matchers, name);
     }
 
-    composite_matcher::matcher_queue::matcher_queue()
+    composite_matcher::matcher_slot::matcher_slot()
         : q( QUEUE_MAX_SIZE,
              []( frame_holder const & fh )
              {
@@ -159,18 +150,64 @@ namespace librealsense
     {
     }
 
+    composite_matcher::matcher_slot & composite_matcher::add_slot( std::shared_ptr< matcher > const & m )
+    {
+        m->set_callback(
+            [&]( frame_holder f, const syncronization_environment & env ) {
+                LOG_IF_ENABLE( "<-- " << *f.frame << "  " << _name, env );
+                sync( std::move( f ), env );
+            } );
+
+        // Slots are only added when new streams are first seen, but sync() may be iterating them
+        std::lock_guard< std::mutex > lock( _mutex );
+
+        size_t const index = _slots.size();
+        _slots.emplace_back( new matcher_slot );
+        _slots.back()->m = m;
+        std::vector< size_t > replaced;
+        for( auto stream : m->get_streams() )
+        {
+            auto it = std::find_if( _stream_slots.begin(),
+                                    _stream_slots.end(),
+                                    [stream]( stream_slot const & ss ) { return ss.stream == stream; } );
+            if( it == _stream_slots.end() )
+                _stream_slots.push_back( { stream, index } );
+            else
+            {
+                replaced.push_back( it->slot );
+                it->slot = index;
+            }
+            _streams_id.push_back( stream );
+        }
+
+        // A matcher replaced for all its streams is retired: its frames will no longer be synced. One that still has
+        // other streams keeps syncing them.
+        for( auto old : replaced )
+        {
+            if( std::any_of( _stream_slots.begin(),
+                             _stream_slots.end(),
+                             [old]( stream_slot const & ss ) { return ss.slot == old; } ) )
+                continue;
+            auto & slot = *_slots[old];
+            slot.q.clear();
+            slot.syncing = false;
+            slot.m.reset();
+        }
+        return *_slots.back();
+    }
+
 
     void composite_matcher::dispatch(frame_holder f, const syncronization_environment& env)
     {
         clean_inactive_streams(f);
-        auto matcher = find_matcher(f);
+        auto slot = find_slot(f);
 
         //LOG_IF_ENABLE( "--> composite_matcher: " << _name, env );
 
-        if (matcher)
+        if (slot)
         {
-            update_last_arrived(f, matcher.get());
-            matcher->dispatch(std::move(f), env);
+            update_last_arrived(f, *slot);
+            slot->m->dispatch(std::move(f), env);
         }
         else
         {
@@ -180,31 +217,37 @@ namespace librealsense
     }
 
     std::shared_ptr<matcher> composite_matcher::find_matcher(const frame_holder& frame)
+    {
+        auto slot = find_slot( frame );
+        return slot ? slot->m : nullptr;
+    }
+
+    composite_matcher::matcher_slot * composite_matcher::find_slot( const frame_holder & frame )
     {
         auto stream_profile = frame.frame->get_stream();
         auto stream_id = stream_profile->get_unique_id();
         auto stream_type = stream_profile->get_stream_type();
 
-        std::shared_ptr<matcher> matcher;
-        auto it = _matchers.find( stream_id );
-        if( it != _matchers.end() )
         {
-            matcher = it->second;
-            if( matcher )
+            // add_slot() may be changing these
+            std::lock_guard< std::mutex > lock( _mutex );
+            for( auto const & ss : _stream_slots )
             {
-                if( ! matcher->get_active() )
+                if( ss.stream != stream_id )
+                    continue;
+                auto & slot = *_slots[ss.slot];
+                if( ! slot.m->get_active() )
                 {
-                    matcher->set_active( true );
-                    _frames_queue[matcher.get()].q.start();
+                    slot.m->set_active( true );
+                    slot.q.start();
                 }
-                return matcher;
+                return &slot;
             }
         }
         LOG_DEBUG( "no matcher found for " << get_abbr_string( stream_type ) << stream_id
                                            << "; creating matcher from device..." );
 
         auto sensor = frame.frame->get_sensor().get(); //TODO: Potential deadlock if get_sensor() gets a hold of the last reference of that sensor
-        auto dev_exist = false;
         if (sensor)
         {
             const device_interface* dev = nullptr;
@@ -218,25 +261,10 @@ namespace librealsense
             }
             if (dev)
             {
-                dev_exist = true;
-                matcher = dev->create_matcher(frame);
+                auto matcher = dev->create_matcher(frame);
                 LOG_DEBUG( "... created " << matcher->get_name() );
 
-                matcher->set_callback(
-                    [&]( frame_holder f, syncronization_environment const & env ) {
-                        LOG_IF_ENABLE( "<-- " << *f.frame << "  " << _name, env );
-                        sync( std::move( f ), env );
-                    } );
-
-                for (auto stream : matcher->get_streams())
-                {
-                    if (_matchers[stream])
-                    {
-                        _frames_queue.erase(_matchers[stream].get());
-                    }
-                    _matchers[stream] = matcher;
-                    _streams_id.push_back(stream);
-                }
+                auto & slot = add_slot( matcher );
                 for (auto stream : matcher->get_streams_types())
                 {
                     _streams_type.push_back(stream);
@@ -251,6 +279,7 @@ namespace librealsense
                     _name = create_composite_name( { matcher },
                                                     _name.substr( 1, _name.length() - 2 ) );  // Remove the "()" around "(CI: )"
                 }
+                return &slot;
             }
         }
         else
@@ -258,25 +287,9 @@ namespace librealsense
             LOG_DEBUG("sensor does not exist");
         }
 
-        if (!dev_exist)
-        {
-            matcher = _matchers[stream_id];
-            // We don't know what device this frame came from, so just store it under device NULL with ID matcher
-            if (!matcher)
-            {
-                _matchers[stream_id] = std::make_shared<identity_matcher>(stream_id, stream_type);
-                _streams_id.push_back(stream_id);
-                _streams_type.push_back(stream_type);
-                matcher = _matchers[stream_id];
-
-                matcher->set_callback(
-                    [&]( frame_holder f, syncronization_environment const & env ) {
-                        LOG_IF_ENABLE( "<-- " << *f.frame << "  " << _name, env );
-                        sync( std::move( f ), env );
-                    } );
-            }
-        }
-        return matcher;
+        // We don't know what device this frame came from, so just store it under device NULL with ID matcher
+        _streams_type.push_back( stream_type );
+        return &add_slot( std::make_shared< identity_matcher >( stream_id, stream_type ) );
     }
 
     void composite_matcher::stop()
@@ -288,12 +301,14 @@ namespace librealsense
         set_active( false );
 
         // Stop all our queues to wake up anyone waiting on them
-        for( auto & fq : _frames_queue )
-            fq.second.q.stop();
+        for( auto & slot : _slots )
+            if( slot->syncing )
+                slot->q.stop();
 
         // Trickle the stop down to any children
-        for( auto m : _matchers )
-            m.second->stop();
+        for( auto & slot : _slots )
+            if( slot->m )
+                slot->m->stop();
     }
 
     std::string
@@ -306,13 +321,13 @@ namespace librealsense
     }
 
     std::string
-        composite_matcher::matchers_to_string( std::vector< librealsense::matcher* > const& matchers )
+    composite_matcher::slots_to_string( std::vector< matcher_slot * > const & slots ) const
     {
         std::ostringstream os;
         os << '[';
-        for( auto m : matchers )
+        for( auto slot : slots )
         {
-            auto const & q = _frames_queue[m].q;
+            auto const & q = slot->q;
             q.peek( [&os]( frame_holder const & fh ) {
                 os << fh;
                 } );
@@ -323,20 +338,21 @@ namespace librealsense
 
     void composite_matcher::sync(frame_holder f, const syncronization_environment& env)
     {
-        auto matcher = find_matcher(f);
-        if (!matcher)
+        auto slot = find_slot(f);
+        if (!slot)
         {
             LOG_ERROR("didn't find any matcher for " << f << " will not be synchronized");
             _callback(std::move(f), env);
             return;
         }
-        update_next_expected( matcher, f );
+        update_next_expected( *slot, f );
 
         // We want to keep track of a "last-arrived" frame which is our current equivalent of "now" -- it contains the
         // latest timestamp/frame-number/etc. that we can compare to.
         auto const last_arrived = f->get_header();
 
-        if( ! _frames_queue[matcher.get()].q.enqueue( std::move( f ) ) )
+        slot->syncing = true;
+        if( ! slot->q.enqueue( std::move( f ) ) )
             // If we get stopped, nothing to do!
             return;
 
@@ -345,35 +361,36 @@ namespace librealsense
         // If we have a Color frame but not Depth, then Depth is "missing" and needs to be
         // waited-for...
 
-        std::vector< frame_holder * > frames_arrived;
-        std::vector< librealsense::matcher * > frames_arrived_matchers;
-        std::vector< int > synced_frames;
-        std::vector< int > unsynced_frames;
-        std::vector< librealsense::matcher * > missing_streams;
-
         while( true )
         {
-            missing_streams.clear();
-            frames_arrived_matchers.clear();
-            frames_arrived.clear();
-
-            std::vector< frame_holder > match;
+            frame_holder composite;
             {
                 // We don't want to stop while syncing!
                 std::lock_guard< std::mutex > lock( _mutex );
 
+                auto & frames_arrived = _frames_arrived;
+                auto & frames_arrived_slots = _frames_arrived_slots;
+                auto & synced_frames = _synced_frames;
+                auto & unsynced_frames = _unsynced_frames;
+                auto & missing_streams = _missing_streams;
+                missing_streams.clear();
+                frames_arrived_slots.clear();
+                frames_arrived.clear();
+
                 // We want to release one frame from each matcher. If a matcher has nothing queued, it is "missing" and
                 // we need to consider waiting for it:
-                for( auto s = _frames_queue.begin(); s != _frames_queue.end(); s++ )
+                for( auto & s : _slots )
                 {
-                    librealsense::matcher * const m = s->first;
-                    if( ! s->second.q.peek( [&]( frame_holder & fh ) {
+                    if( ! s->syncing )
+                        continue;
+                    matcher_slot * const ms = s.get();
+                    if( ! ms->q.peek( [&]( frame_holder & fh ) {
                             LOG_IF_ENABLE( "... have " << *fh.frame, env );
                             frames_arrived.push_back( &fh );
-                            frames_arrived_matchers.push_back( m );
+                            frames_arrived_slots.push_back( ms );
                         } ) )
                     {
-                        missing_streams.push_back( m );
+                        missing_streams.push_back( ms );
                     }
                 }
                 if( frames_arrived.empty() )
@@ -418,11 +435,11 @@ namespace librealsense
                     // something missing, we can't release anything yet...
                     for( auto i : missing_streams )
                     {
-                        LOG_IF_ENABLE( "... missing " << i->get_name() << ", next expected @"
-                                                      << rsutils::string::from( _next_expected[i].value ) << " (from "
-                                                      << rsutils::string::from( _next_expected[i].fps ) << " fps)",
+                        LOG_IF_ENABLE( "... missing " << i->m->get_name() << ", next expected @"
+                                                      << rsutils::string::from( i->next_expected.value ) << " (from "
+                                                      << rsutils::string::from( i->next_expected.fps ) << " fps)",
                                        env );
-                        if( skip_missing_stream( *curr_sync, i, last_arrived, env ) )
+                        if( skip_missing_stream( *curr_sync, *i, last_arrived, env ) )
                         {
                             LOG_IF_ENABLE( "...     cannot be synced; not waiting for it", env );
                             continue;
@@ -442,29 +459,29 @@ namespace librealsense
                 if( ! release_synced_frames )
                     break;
 
-                match.reserve( synced_frames.size() );
-
+                auto & match = _match;
+                match.clear();
                 for( auto index : synced_frames )
                 {
                     frame_holder frame;
                     int const timeout_ms = 5000;
-                    librealsense::matcher * m = frames_arrived_matchers[index];
-                    _frames_queue[m].q.dequeue( &frame, timeout_ms );
+                    frames_arrived_slots[index]->q.dequeue( &frame, timeout_ms );
                     match.push_back( std::move( frame ) );
                 }
-            }
-
-            // The frameset should always be with the same order of streams (the first stream carries extra
-            // meaning because it decides the frameset properties) -- so we sort them...
-            std::sort( match.begin(),
-                       match.end(),
-                       []( const frame_holder & f1, const frame_holder & f2 ) {
-                           return f1.frame->get_stream()->get_unique_id()
-                                > f2.frame->get_stream()->get_unique_id();
-                       } );
 
+                // The frameset should always be with the same order of streams (the first stream carries extra
+                // meaning because it decides the frameset properties) -- so we sort them...
+                std::sort( match.begin(),
+                           match.end(),
+                           []( const frame_holder & f1, const frame_holder & f2 ) {
+                               return f1.frame->get_stream()->get_unique_id()
+                                    > f2.frame->get_stream()->get_unique_id();
+                           } );
+
+                composite = env.source->allocate_composite_frame( std::move( match ) );
+                match.clear();
+            }
 
-            frame_holder composite = env.source->allocate_composite_frame(std::move(match));
             if (composite.frame)
             {
                 auto cb = begin_callback();
@@ -479,9 +496,9 @@ namespace librealsense
     {
     }
 
-    void frame_number_composite_matcher::update_last_arrived(frame_holder& f, matcher* m)
+    void frame_number_composite_matcher::update_last_arrived(frame_holder& f, matcher_slot & slot)
     {
-        _last_arrived[m] =f->get_frame_number();
+        slot.last_arrived = double( f->get_frame_number() );
     }
 
     bool frame_number_composite_matcher::are_equivalent(frame_holder& a, frame_holder& b)
@@ -494,41 +511,30 @@ namespace librealsense
     }
     void frame_number_composite_matcher::clean_inactive_streams(frame_holder& f)
     {
-        std::vector<stream_id> inactive_matchers;
-        for(auto m: _matchers)
+        // add_slot() may be adding to _slots
+        std::lock_guard< std::mutex > lock( _mutex );
+        for( auto & slot : _slots )
         {
-            if( _last_arrived[m.second.get()]
-                && ( std::abs( (long long)f->get_frame_number() - (long long)_last_arrived[m.second.get()] ) ) > 5 )
+            if( slot->m && slot->last_arrived
+                && ( std::abs( (long long)f->get_frame_number() - (long long)slot->last_arrived ) ) > 5 )
             {
-                std::stringstream s;
-                s << "clean inactive stream in "<<_name;
-                for (auto stream : m.second->get_streams_types())
-                {
-                    s << stream << " ";
-                }
-                LOG_DEBUG(s.str());
-
-                inactive_matchers.push_back(m.first);
-                m.second->set_active(false);
+                LOG_DEBUG( "clean inactive stream in " << _name << " " << slot->m->get_name() );
+                slot->m->set_active( false );
+                slot->q.clear();
             }
         }
-
-        for(auto id: inactive_matchers)
-        {
-            _frames_queue[_matchers[id].get()].q.clear();
-        }
     }
 
     bool
     frame_number_composite_matcher::skip_missing_stream( frame_interface const * const synced_frame,
-                                                         matcher * missing,
+                                                         matcher_slot & missing,
                                                          frame_header const & last_arrived,
                                                          const syncronization_environment & env )
     {
-         if(!missing->get_active())
+         if(!missing.m->get_active())
              return true;
 
-        auto const & next_expected = _next_expected[missing];
+        auto const & next_expected = missing.next_expected;
 
         if( synced_frame->get_frame_number() - next_expected.value > 4
             || synced_frame->get_frame_number() < next_expected.value )
@@ -538,10 +544,9 @@ namespace librealsense
         return false;
     }
 
-    void frame_number_composite_matcher::update_next_expected(
-        std::shared_ptr< matcher > const & matcher, const frame_holder & f )
+    void frame_number_composite_matcher::update_next_expected( matcher_slot & slot, const frame_holder & f )
     {
-        _next_expected[matcher.get()].value = f.frame->get_frame_number()+1.;
+        slot.next_expected.value = f.frame->get_frame_number()+1.;
     }
 
     std::pair<double, double> extract_timestamps(frame_holder & a, frame_holder & b)
@@ -581,11 +586,11 @@ namespace librealsense
         return ts.first < ts.second;
     }
 
-    void timestamp_composite_matcher::update_last_arrived(frame_holder& f, matcher* m)
+    void timestamp_composite_matcher::update_last_arrived(frame_holder& f, matcher_slot & slot)
     {
         auto const now = time_service::get_time();
-        //LOG_DEBUG( _name << ": _last_arrived[" << m->get_name() << "] = " << now );
-        _last_arrived[m] = now;
+        //LOG_DEBUG( _name << ": _last_arrived[" << slot.m->get_name() << "] = " << now );
+        slot.last_arrived = now;
     }
 
     double timestamp_composite_matcher::get_fps( frame_interface const * f )
@@ -607,8 +612,7 @@ namespace librealsense
     }
 
     void
-    timestamp_composite_matcher::update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                                       const frame_holder & f )
+    timestamp_composite_matcher::update_next_expected( matcher_slot & slot, const frame_holder & f )
     {
         auto fps = get_fps( f );
         auto gap = 1000. / fps;
@@ -618,7 +622,7 @@ namespace librealsense
         //LOG_DEBUG( "... next_expected = {timestamp}" << rsutils::string::from( ts ) << " + {gap}(1000/{fps}"
         //                                             << rsutils::string::from( fps )
         //                                             << ") = " << rsutils::string::from( ne ) );
-        auto & next_expected = _next_expected[matcher.get()];
+        auto & next_expected = slot.next_expected;
         next_expected.value = ne;
         next_expected.fps = fps;
         next_expected.domain = f.frame->get_frame_timestamp_domain();
@@ -630,19 +634,19 @@ namespace librealsense
     }
 
     bool timestamp_composite_matcher::skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                                           matcher * missing,
+                                                           matcher_slot & missing,
                                                            frame_header const & last_arrived,
                                                            const syncronization_environment & env )
     {
         // true : frameset is ready despite the missing stream (no use waiting) -- "skip" it
         // false: the missing stream is relevant and our frameset isn't ready yet!
 
-        if(!missing->get_active())
+        if(!missing.m->get_active())
             return true;
 
         //LOG_IF_ENABLE( "...     matcher " << synced[0]->get_name(), env );
 
-        auto const & next_expected = _next_expected[missing];
+        auto const & next_expected = missing.next_expected;
         // LOG_IF_ENABLE( "...     next    " << std::fixed << next_expected, env );
 
         if( next_expected.domain != last_arrived.timestamp_domain )
@@ -717,13 +721,9 @@ namespace librealsense
                                << rsutils::string::from( next_expected.value + threshold ) << "; deactivating matcher!",
                            env );
 
-            auto const q_it = _frames_queue.find( missing );
-            if( q_it != _frames_queue.end() )
-            {
-                if( q_it->second.q.empty() )
-                    _frames_queue.erase( q_it );
-            }
-            missing->set_active( false );
+            if( missing.q.empty() )
+                missing.syncing = false;
+            missing.m->set_active( false );
             return true;
         }
 
@@ -760,12 +760,19 @@ namespace librealsense
         // Syncer have to output composite frame 
         if (!composite)
         {
-            std::vector<frame_holder> match;
-            std::ostringstream frame_string_for_logging;
-            frame_string_for_logging << f; // Saving frame holder string before moving frame
+            // Saved in case of failure, rather than formatting the frame every time
+            auto const stream_type = f->get_stream()->get_stream_type();
+            auto const frame_number = f->get_frame_number();
 
-            match.push_back(std::move(f));
-            frame_holder composite = env.source->allocate_composite_frame(std::move(match));
+            frame_holder composite;
+            {
+                // _match is shared scratch space
+                std::lock_guard< std::mutex > lock( _mutex );
+                _match.clear();
+                _match.push_back( std::move( f ) );
+                composite = env.source->allocate_composite_frame( std::move( _match ) );
+                _match.clear();
+            }
             if (composite.frame)
             {
                 auto cb = begin_callback();
@@ -775,7 +782,7 @@ namespace librealsense
             else
             {
                 LOG_ERROR( "composite_identity_matcher: "
-                           << _name << " " << frame_string_for_logging.str()
+                           << _name << " " << get_abbr_string( stream_type ) << " #" << frame_number
                            << " faild to create composite_frame, user callback will not be called" );
             }
         }
@@ -11,7 +11,7 @@
 #include <vector>
 #include <mutex>
 #include <memory>
-#include <map>
+#include <atomic>
 
 
 namespace librealsense {
@@ -89,46 +89,64 @@ namespace librealsense {
     public:
         composite_matcher(std::vector<std::shared_ptr<matcher>> const & matchers, std::string const & name);
 
-
-        virtual bool are_equivalent(frame_holder& a, frame_holder& b) = 0;
-        virtual bool is_smaller_than(frame_holder& a, frame_holder& b) = 0;
-        virtual bool skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                          matcher * missing,
-                                          frame_header const & last_arrived,
-                                          const syncronization_environment & env )
-            = 0;
-        virtual void clean_inactive_streams(frame_holder& f) = 0;
-        virtual void update_last_arrived(frame_holder& f, matcher* m) = 0;
-
         void dispatch(frame_holder f, const syncronization_environment& env) override;
         void sync(frame_holder f, const syncronization_environment& env) override;
         std::shared_ptr<matcher> find_matcher(const frame_holder& f);
         virtual void stop() override;
 
         static std::string frames_to_string( std::vector< frame_holder* > const& );
-        std::string matchers_to_string( std::vector< matcher* > const& );
 
     protected:
-        virtual void update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                           const frame_holder & f )
-            = 0;
+        struct next_expected_t
+        {
+            double value;  // timestamp/frame-number/etc.
+            double fps;
+            rs2_timestamp_domain domain;
+        };
 
-        struct matcher_queue
+        // All the per-matcher state we keep. Each child matcher gets a slot, in a dense array, when it is
+        // first seen; streams map to their matcher's slot index so no per-frame map lookups are needed
+        struct matcher_slot
         {
+            std::shared_ptr< matcher > m;  // null once replaced by another matcher
             single_consumer_frame_queue< frame_holder > q;
+            std::atomic< bool > syncing{ false };  // frames were queued and we haven't given up on the matcher
+            next_expected_t next_expected = {};
+            double last_arrived = 0;  // timestamp/frame-number/etc.
 
-            matcher_queue();
+            matcher_slot();
         };
 
-        std::map< matcher *, matcher_queue > _frames_queue;
-        std::map<stream_id, std::shared_ptr<matcher>> _matchers;
-        struct next_expected_t
+        virtual bool are_equivalent(frame_holder& a, frame_holder& b) = 0;
+        virtual bool is_smaller_than(frame_holder& a, frame_holder& b) = 0;
+        virtual bool skip_missing_stream( frame_interface const * waiting_to_be_released,
+                                          matcher_slot & missing,
+                                          frame_header const & last_arrived,
+                                          const syncronization_environment & env )
+            = 0;
+        virtual void clean_inactive_streams(frame_holder& f) = 0;
+        virtual void update_last_arrived(frame_holder& f, matcher_slot & slot) = 0;
+        virtual void update_next_expected( matcher_slot & slot, const frame_holder & f ) = 0;
+
+        matcher_slot * find_slot( const frame_holder & f );
+        matcher_slot & add_slot( std::shared_ptr< matcher > const & m );
+        std::string slots_to_string( std::vector< matcher_slot * > const & ) const;
+
+        std::vector< std::unique_ptr< matcher_slot > > _slots;
+        struct stream_slot
         {
-            double value;  // timestamp/frame-number/etc.
-            double fps;
-            rs2_timestamp_domain domain;
+            stream_id stream;
+            size_t slot;
         };
-        std::map< matcher *, next_expected_t > _next_expected;
+        std::vector< stream_slot > _stream_slots;  // usually just a handful, so a linear search is fastest
+
+        // Scratch space for sync(), reused (under _mutex) to avoid allocations per frame
+        std::vector< frame_holder * > _frames_arrived;
+        std::vector< matcher_slot * > _frames_arrived_slots;
+        std::vector< int > _synced_frames;
+        std::vector< int > _unsynced_frames;
+        std::vector< matcher_slot * > _missing_streams;
+        std::vector< frame_holder > _match;
 
         std::mutex _mutex;
     };
@@ -143,20 +161,17 @@ namespace librealsense {
         virtual bool are_equivalent(frame_holder& a, frame_holder& b) override { return false; }
         virtual bool is_smaller_than(frame_holder& a, frame_holder& b) override { return false; }
         virtual bool skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                          matcher * missing,
+                                          matcher_slot & missing,
                                           frame_header const & last_arrived,
                                           const syncronization_environment & env ) override
         {
             return false;
         }
         virtual void clean_inactive_streams(frame_holder& f) override {}
-        virtual void update_last_arrived(frame_holder& f, matcher* m) override {}
+        virtual void update_last_arrived(frame_holder& f, matcher_slot & slot) override {}
 
     protected:
-        void update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                   const frame_holder & f ) override
-        {
-        }
+        void update_next_expected( matcher_slot & slot, const frame_holder & f ) override {}
     };
 
     class frame_number_composite_matcher : public composite_matcher
@@ -164,19 +179,15 @@ namespace librealsense {
     public:
         frame_number_composite_matcher(
             std::vector< std::shared_ptr< matcher > > const & matchers );
-        virtual void update_last_arrived(frame_holder& f, matcher* m) override;
+        virtual void update_last_arrived(frame_holder& f, matcher_slot & slot) override;
         bool are_equivalent(frame_holder& a, frame_holder& b) override;
         bool is_smaller_than(frame_holder& a, frame_holder& b) override;
         bool skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                  matcher * missing,
+                                  matcher_slot & missing,
                                   frame_header const & last_arrived,
                                   const syncronization_environment & env ) override;
         void clean_inactive_streams(frame_holder& f) override;
-        void update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                   const frame_holder & f ) override;
-
-    private:
-         std::map<matcher*,unsigned long long> _last_arrived;
+        void update_next_expected( matcher_slot & slot, const frame_holder & f ) override;
     };
 
     class timestamp_composite_matcher : public composite_matcher
@@ -185,19 +196,17 @@ namespace librealsense {
         timestamp_composite_matcher( std::vector< std::shared_ptr< matcher > > const & matchers );
         bool are_equivalent(frame_holder& a, frame_holder& b) override;
         bool is_smaller_than(frame_holder& a, frame_holder& b) override;
-        virtual void update_last_arrived(frame_holder& f, matcher* m) override;
+        virtual void update_last_arrived(frame_holder& f, matcher_slot & slot) override;
         void clean_inactive_streams(frame_holder& f) override;
         bool skip_missing_stream( frame_interface const * waiting_to_be_released,
-                                  matcher * missing,
+                                  matcher_slot & missing,
                                   frame_header const & last_arrived,
                                   const syncronization_environment & env ) override;
-        void update_next_expected( std::shared_ptr< matcher > const & matcher,
-                                   const frame_holder & f ) override;
+        void update_next_expected( matcher_slot & slot, const frame_holder & f ) override;
 
     private:
         double get_fps( frame_interface const * f );
         bool are_equivalent( double a, double b, double fps );
-        std::map<matcher*, double> _last_arrived;
     };
 
 
@@ -313,6 +313,11 @@ const char * get_string( rs2_extension value )
     CASE( MAX_USABLE_RANGE_SENSOR )
     CASE( DEBUG_STREAM_SENSOR )
     CASE( CALIBRATION_CHANGE_DEVICE )
+    CASE( MOTION_BATCH_FRAME )
+    CASE( DEPTH_METRICS_FILTER )
+    CASE( DEPTH_ENCODER )
+    CASE( DEPTH_DECODER )
+    CASE( MOTION_BATCHER )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -543,6 +548,7 @@ const char * get_string( rs2_format value )
     CASE( Y411 )
     CASE( Y16I )
     CASE( M420 )
+    CASE( Z16RVL )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -0,0 +1,37 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "usb-types.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace librealsense
+{
+    namespace platform
+    {
+        // A physical USB device that was plugged in or removed
+        struct usb_hotplug_event
+        {
+            bool arrived = false;
+            std::string device_path;                // Same as the id of each of the interfaces below
+            std::vector<usb_device_info> interfaces; // On arrival: the interfaces the device exposes; empty on removal
+        };
+
+        typedef std::function<void(usb_hotplug_event && event)> usb_hotplug_callback;
+
+        // Source of hotplug notifications, so device watchers do not need to re-enumerate on a timer
+        class usb_hotplug_source
+        {
+        public:
+            // Returns false if notifications cannot be delivered on this platform, in which case the caller should
+            // fall back to polling. The callback may be called from any thread.
+            virtual bool start(usb_hotplug_callback callback) = 0;
+            virtual void stop() = 0;
+            virtual ~usb_hotplug_source() = default;
+        };
+    }
+}
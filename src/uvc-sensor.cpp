@@ -5,6 +5,7 @@
 #include "device.h"
 #include "stream.h"
 #include "global_timestamp_reader.h"
+#include "async-log.h"
 #include "core/video-frame.h"
 #include "core/notification.h"
 #include "platform/uvc-option.h"
@@ -150,14 +151,16 @@ void uvc_sensor::open( const stream_profiles & requests )
                     if( msp )
                         expected_size = 64;  // 32; // D457 - WORKAROUND - SHOULD BE REMOVED AFTER CORRECTION IN DRIVER
 
-                    LOG_DEBUG( "FrameAccepted,"
-                               << librealsense::get_string( req_profile_base->get_stream_type() ) << ",Counter,"
-                               << std::dec << fr->additional_data.frame_number << ",Index,"
-                               << req_profile_base->get_stream_index() << ",BackEndTS," << std::fixed << f.backend_time
-                               << ",SystemTime," << std::fixed << system_time << " ,diff_ts[Sys-BE],"
-                               << system_time - f.backend_time << ",TS," << std::fixed << timestamp << ",TS_Domain,"
-                               << rs2_timestamp_domain_to_string( timestamp_domain ) << ",last_frame_number,"
-                               << last_frame_number << ",last_timestamp," << last_timestamp );
+                    LOG_DEBUG_ASYNC( "FrameAccepted,", req_profile_base->get_stream_type(),
+                                     ",Counter,", std::dec, fr->additional_data.frame_number,
+                                     ",Index,", req_profile_base->get_stream_index(),
+                                     ",BackEndTS,", std::fixed, f.backend_time,
+                                     ",SystemTime,", std::fixed, system_time,
+                                     " ,diff_ts[Sys-BE],", system_time - f.backend_time,
+                                     ",TS,", std::fixed, timestamp,
+                                     ",TS_Domain,", timestamp_domain,
+                                     ",last_frame_number,", last_frame_number,
+                                     ",last_timestamp,", last_timestamp );
 
                     if( frame_counter <= last_frame_number )
                         LOG_INFO( "Frame counter reset" );
@@ -42,9 +42,13 @@ namespace librealsense
     namespace platform
     {
         std::vector<uvc_device_info> query_uvc_devices_info()
+        {
+            return query_uvc_devices_info(platform::usb_enumerator::query_devices_info());
+        }
+
+        std::vector<uvc_device_info> query_uvc_devices_info(const std::vector<usb_device_info>& usb_devices)
         {
             std::vector<platform::uvc_device_info> rv;
-            auto usb_devices = platform::usb_enumerator::query_devices_info();
             for (auto&& info : usb_devices) 
             {
                 if (info.cls != RS2_USB_CLASS_VIDEO)
@@ -28,6 +28,7 @@ namespace librealsense
         class uvc_streamer;
 
         std::vector<uvc_device_info> query_uvc_devices_info();
+        std::vector<uvc_device_info> query_uvc_devices_info(const std::vector<usb_device_info>& usb_devices);
         std::shared_ptr<uvc_device> create_rsuvc_device(uvc_device_info info);
 
         struct profile_and_callback
@@ -0,0 +1,84 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+
+namespace rsutils {
+namespace concurrency {
+
+
+// Publishes a small trivially-copyable value from a single writer to any number of readers, without
+// readers ever taking a lock or writing to shared memory.
+//
+// The writer bumps a sequence number to odd, stores the value, then bumps it back to even. A reader
+// copies the value and retries if the sequence was odd or changed meanwhile, so it always gets a
+// value that was store()d as a whole. The value is kept in atomic words so the concurrent copy is
+// not a data race.
+//
+// Writes must be serialized by the caller.
+//
+template< class T >
+class seqlock
+{
+    static_assert( std::is_trivially_copyable< T >::value, "seqlock values are copied bitwise" );
+
+    static constexpr size_t n_words = ( sizeof( T ) + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t );
+
+    std::atomic< uint32_t > _sequence;
+    std::atomic< uint64_t > _words[n_words];
+
+public:
+    seqlock( T const & initial = T() )
+        : _sequence( 0 )
+    {
+        uint64_t words[n_words] = {};
+        std::memcpy( words, &initial, sizeof( T ) );
+        for( size_t i = 0; i < n_words; ++i )
+            _words[i].store( words[i], std::memory_order_relaxed );
+    }
+
+    seqlock( const seqlock & ) = delete;
+    seqlock & operator=( const seqlock & ) = delete;
+
+    void store( T const & value )
+    {
+        uint64_t words[n_words] = {};
+        std::memcpy( words, &value, sizeof( T ) );
+
+        auto seq = _sequence.load( std::memory_order_relaxed );
+        _sequence.store( seq + 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_release );
+        for( size_t i = 0; i < n_words; ++i )
+            _words[i].store( words[i], std::memory_order_relaxed );
+        _sequence.store( seq + 2, std::memory_order_release );
+    }
+
+    T load() const
+    {
+        uint64_t words[n_words];
+        uint32_t before, after;
+        do
+        {
+            before = _sequence.load( std::memory_order_acquire );
+            for( size_t i = 0; i < n_words; ++i )
+                words[i] = _words[i].load( std::memory_order_relaxed );
+            std::atomic_thread_fence( std::memory_order_acquire );
+            after = _sequence.load( std::memory_order_relaxed );
+        }
+        while( ( before & 1 ) || before != after );
+
+        T value;
+        std::memcpy( &value, words, sizeof( T ) );
+        return value;
+    }
+};
+
+
+}  // namespace concurrency
+}  // namespace rsutils
@@ -2,28 +2,52 @@
 // Copyright(c) 2015 Intel Corporation. All Rights Reserved.
 
 #include <librealsense2/rs.hpp>
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
-#include <librealsense2-gl/rs_processing_gl.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
 
 #include <iostream>
 #include <iomanip>
 #include <map>
 #include <set>
 #include <cstring>
+#include <cstdlib>
 #include <chrono>
 #include <numeric>
+#include <algorithm>
+#include <functional>
+#include <atomic>
+#include <new>
 #include <math.h>
 #include <fstream>
+#include <sstream>
+
+#include <rsutils/json.h>
+using rsutils::json;
 
 #include "tclap/CmdLine.h"
-#include "example-utils.hpp"
 
 using namespace std;
 using namespace chrono;
 using namespace TCLAP;
 using namespace rs2;
 
+// Every heap allocation made while a block is processing is counted, so that allocations-per-frame
+// can be reported and tracked across commits. On platforms where the shared library resolves
+// operator new to the executable's (Linux, macOS) this includes allocations made by librealsense.
+static atomic< size_t > allocations( 0 );
+
+void * operator new( size_t size )
+{
+    ++allocations;
+    if( void * p = malloc( size ? size : 1 ) )
+        return p;
+    throw bad_alloc();
+}
+
+void operator delete( void * p ) noexcept
+{
+    free( p );
+}
+
 #if (defined(_WIN32) || defined(_WIN64))
 #include <intrin.h>
 
@@ -88,287 +112,615 @@ string get_cpu() { return "unknown"; }
 string get_cpu() { return "unknown"; }
 #endif
 
+
+// A set of identical-format input frames all the tests of a given kind are run against
+struct input_set
+{
+    string kind;        // depth, color, depth+color
+    string resolution;  // WxH
+    vector< frame > frames;
+};
+
 class test
 {
 public:
-    virtual frame prepare(frame f) { return f; };
-    virtual frame process(frame f) = 0;
-    virtual frame finish (frame f) { return f; };
-    virtual const std::string& name() const = 0;
+    test( string name ) : _name( move( name ) ) {}
+    virtual ~test() = default;
+
+    virtual frame process( frame f ) = 0;
+    const string & name() const { return _name; }
+
+private:
+    string _name;
 };
 
-template<class T>
+template< class T >
 class pb_test : public test
 {
 public:
-    pb_test(std::string name) 
-        : _block(), _name(std::move(name)) {}
+    pb_test( string name )
+        : test( move( name ) ) {}
 
-    frame process(frame f) override
-    {
-        return _block.process(f);
-    }
-    virtual const std::string& name() const override
+    frame process( frame f ) override
     {
-        return _name;
+        return _block.process( f );
     }
-private:
+
+protected:
     T _block;
-    std::string _name;
 };
 
-template<class T>
-class gl_test : public pb_test<T>
+// Runs the depth post-processing chain the way the viewer applies it
+class post_processing_test : public test
 {
 public:
-    gl_test(std::string name) 
-        : pb_test<T>(std::move(name)) {}
-
+    post_processing_test()
+        : test( "post_processing" ), _to_depth( false ) {}
 
-    void flush()
+    frame process( frame f ) override
     {
-        glFlush();
-        glFinish();
+        f = _decimation.process( f );
+        f = _to_disparity.process( f );
+        f = _spatial.process( f );
+        f = _temporal.process( f );
+        f = _to_depth.process( f );
+        return _hole_filling.process( f );
     }
 
-    frame process(frame f) override
-    {
-        auto res = pb_test<T>::process(f);
-        flush();
-        return res;
-    }
-    frame prepare(frame f) override
+private:
+    decimation_filter _decimation;
+    disparity_transform _to_disparity;
+    spatial_filter _spatial;
+    temporal_filter _temporal;
+    disparity_transform _to_depth;
+    hole_filling_filter _hole_filling;
+};
+
+class textured_pointcloud_test : public test
+{
+public:
+    textured_pointcloud_test()
+        : test( "pointcloud_textured" ) {}
+
+    frame process( frame f ) override
     {
-        auto res = _upload.process(f);
-        flush();
-        return res;
+        auto fs = f.as< frameset >();
+        _pc.map_to( fs.first( RS2_STREAM_COLOR ) );
+        return _pc.calculate( fs.get_depth_frame() );
     }
-    frame finish(frame f) override
+
+private:
+    pointcloud _pc;
+};
+
+class align_test : public test
+{
+public:
+    align_test( rs2_stream to )
+        : test( to == RS2_STREAM_COLOR ? "align_to_color" : "align_to_depth" ), _align( to ) {}
+
+    frame process( frame f ) override
     {
-        _ptr = (void*)f.get_data();
-        return f;
+        return _align.process( f.as< frameset >() );
     }
+
 private:
-    gl::uploader _upload;
-    volatile void* _ptr;
+    rs2::align _align;
 };
 
-class suite
+typedef function< shared_ptr< test >() > test_factory;
+
+#define REGISTER_TEST(x) tests[kind].push_back( []() -> shared_ptr< test > { return make_shared< pb_test< x > >( #x ); } )
+
+map< string, vector< test_factory > > register_tests()
+{
+    map< string, vector< test_factory > > tests;
+
+    string kind = "depth";
+    REGISTER_TEST( colorizer );
+    REGISTER_TEST( pointcloud );
+    REGISTER_TEST( spatial_filter );
+    REGISTER_TEST( temporal_filter );
+    REGISTER_TEST( disparity_transform );
+    REGISTER_TEST( threshold_filter );
+    REGISTER_TEST( decimation_filter );
+    REGISTER_TEST( hole_filling_filter );
+    REGISTER_TEST( units_transform );
+    tests[kind].push_back( []() -> shared_ptr< test > { return make_shared< post_processing_test >(); } );
+
+    kind = "color";
+    REGISTER_TEST( yuy_decoder );
+
+    kind = "depth+color";
+    tests[kind].push_back( []() -> shared_ptr< test > { return make_shared< align_test >( RS2_STREAM_COLOR ); } );
+    tests[kind].push_back( []() -> shared_ptr< test > { return make_shared< align_test >( RS2_STREAM_DEPTH ); } );
+    tests[kind].push_back( []() -> shared_ptr< test > { return make_shared< textured_pointcloud_test >(); } );
+
+    return tests;
+}
+
+size_t frame_bytes( const frame & f )
+{
+    if( auto fs = f.as< frameset >() )
+    {
+        size_t total = 0;
+        for( auto && sub : fs )
+            total += frame_bytes( sub );
+        return total;
+    }
+    return f ? size_t( f.get_data_size() ) : 0;
+}
+
+string resolution_of( const frame & f )
+{
+    auto vf = f.as< frameset >() ? f.as< frameset >().get_depth_frame() : f.as< video_frame >();
+    if( ! vf )
+        return "";
+    return to_string( vf.get_width() ) + "x" + to_string( vf.get_height() );
+}
+
+// Simple deterministic generator, so that every run (and every machine) sees the same input
+class lcg
 {
 public:
-    virtual void register_tests(stream_profile stream,
-        vector<shared_ptr<test>>& tests) const = 0;
+    lcg( uint32_t seed ) : _state( seed ) {}
+    uint32_t operator()() { return _state = _state * 1664525u + 1013904223u; }
+
+private:
+    uint32_t _state;
 };
 
-#define REGISTER_TEST(x) tests.push_back(make_shared<pb_test<x>>(#x))
+rs2_intrinsics make_intrinsics( int width, int height )
+{
+    rs2_intrinsics intr = { width, height,
+                            width / 2.f, height / 2.f,
+                            width * 0.75f, width * 0.75f,
+                            RS2_DISTORTION_NONE, { 0, 0, 0, 0, 0 } };
+    return intr;
+}
 
-class processing_blocks : public suite
+void release_pixels( void * p )
 {
-public:
-    void register_tests(stream_profile stream,
-        vector<shared_ptr<test>>& tests) const override
-    {
-        if (stream.stream_type() == RS2_STREAM_DEPTH)
+    delete[] static_cast< uint8_t * >( p );
+}
+
+// Depth: a tilted plane with bumps, noise and ~3% holes, at 1mm depth units
+uint8_t * synthesize_depth( int width, int height, int index, lcg & rand )
+{
+    auto pixels = new uint8_t[width * height * 2];
+    auto depth = reinterpret_cast< uint16_t * >( pixels );
+    for( int y = 0; y < height; ++y )
+        for( int x = 0; x < width; ++x )
         {
-            REGISTER_TEST(colorizer);
-            REGISTER_TEST(pointcloud);
-            REGISTER_TEST(spatial_filter);
-            REGISTER_TEST(temporal_filter);
-            REGISTER_TEST(disparity_transform);
-            REGISTER_TEST(threshold_filter);
-            REGISTER_TEST(decimation_filter);
+            auto r = rand();
+            double z = 800 + 2 * y + 150 * sin( ( x + index * 4 ) * 0.05 ) * cos( y * 0.04 ) + int( r % 9 ) - 4;
+            depth[y * width + x] = ( r >> 16 ) % 100 < 3 ? 0 : uint16_t( z );
         }
-        if (stream.format() == RS2_FORMAT_YUYV)
+    return pixels;
+}
+
+uint8_t * synthesize_color( int width, int height, int bpp, int index, lcg & rand )
+{
+    auto pixels = new uint8_t[width * height * bpp];
+    for( int y = 0; y < height; ++y )
+        for( int x = 0; x < width * bpp; ++x )
+            pixels[y * width * bpp + x] = uint8_t( x + y + index + ( rand() >> 28 ) );
+    return pixels;
+}
+
+// Records frames for one resolution from a software device, so no camera is needed
+vector< input_set > synthesize( int width, int height, int count, uint32_t seed )
+{
+    vector< input_set > sets;
+    auto resolution = to_string( width ) + "x" + to_string( height );
+
+    software_device dev;
+    auto stereo = dev.add_sensor( "Stereo Module" );
+    stereo.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+    stereo.add_read_only_option( RS2_OPTION_STEREO_BASELINE, 50.f );
+    auto rgb = dev.add_sensor( "RGB Camera" );
+
+    auto intr = make_intrinsics( width, height );
+    auto depth_profile = stereo.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, width, height, 30, 2, RS2_FORMAT_Z16, intr } );
+    auto yuyv_profile = rgb.add_video_stream( { RS2_STREAM_COLOR, 0, 1, width, height, 30, 2, RS2_FORMAT_YUYV, intr } );
+    auto rgb_profile = rgb.add_video_stream( { RS2_STREAM_COLOR, 0, 2, width, height, 30, 3, RS2_FORMAT_RGB8, intr } );
+
+    rs2_extrinsics depth_to_color = { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0.015f, 0, 0 } };
+    depth_profile.register_extrinsics_to( yuyv_profile, depth_to_color );
+    depth_profile.register_extrinsics_to( rgb_profile, depth_to_color );
+
+    lcg rand( seed );
+    auto record = [&]( software_sensor & s, stream_profile profile, int bpp ) {
+        vector< frame > frames;
+        frame_queue q( 1, true );
+        s.open( profile );
+        s.start( q );
+        for( int i = 0; i < count; ++i )
         {
-            REGISTER_TEST(yuy_decoder);
+            auto pixels = profile.format() == RS2_FORMAT_Z16 ? synthesize_depth( width, height, i, rand )
+                                                              : synthesize_color( width, height, bpp, i, rand );
+            s.on_video_frame( { pixels, release_pixels, width * bpp, bpp,
+                                double( i * 1000 / 30 ), RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i + 1, profile } );
+            auto f = q.wait_for_frame();
+            f.keep();
+            frames.push_back( f );
         }
+        s.stop();
+        s.close();
+        return frames;
+    };
+
+    auto depth = record( stereo, depth_profile, 2 );
+    sets.push_back( { "depth", resolution, depth } );
+    sets.push_back( { "color", resolution, record( rgb, yuyv_profile, 2 ) } );
+
+    auto color = record( rgb, rgb_profile, 3 );
+    vector< frame > pairs;
+    for( size_t i = 0; i < depth.size(); ++i )
+    {
+        auto c = color[i];
+        filter bundle( [c]( frame f, frame_source & src ) { src.frame_ready( src.allocate_composite_frame( { f, c } ) ); } );
+        auto fs = bundle.process( depth[i] );
+        fs.keep();
+        pairs.push_back( fs );
     }
-};
+    sets.push_back( { "depth+color", resolution, pairs } );
+
+    return sets;
+}
 
-#define REGISTER_GL_TEST(x) tests.push_back(make_shared<gl_test<x>>(#x))
+// Reads up to 'count' frames of each kind from a recording, as fast as the playback allows
+vector< input_set > load_recording( const string & filename, int count )
+{
+    map< string, input_set > sets;
 
-class gl_blocks : public suite
+    pipeline pipe;
+    config cfg;
+    cfg.enable_device_from_file( filename, false );
+    auto profile = pipe.start( cfg );
+    profile.get_device().as< playback >().set_real_time( false );
+
+    auto add = [&]( const string & kind, frame f ) {
+        auto key = kind + "@" + resolution_of( f );
+        auto & set = sets[key];
+        if( set.frames.size() >= size_t( count ) )
+            return;
+        set.kind = kind;
+        set.resolution = resolution_of( f );
+        f.keep();
+        set.frames.push_back( f );
+    };
+
+    frameset fs;
+    while( pipe.try_wait_for_frames( &fs, 1000 ) )
+    {
+        auto depth = fs.get_depth_frame();
+        auto color = fs.first_or_default( RS2_STREAM_COLOR );
+        if( depth && depth.get_profile().format() == RS2_FORMAT_Z16 )
+            add( "depth", depth );
+        if( color && color.get_profile().format() == RS2_FORMAT_YUYV )
+            add( "color", color );
+        if( depth && color && color.get_profile().format() == RS2_FORMAT_RGB8 )
+            add( "depth+color", fs );
+    }
+    pipe.stop();
+
+    vector< input_set > result;
+    for( auto && set : sets )
+        result.push_back( set.second );
+    return result;
+}
+
+struct result
 {
-public:
-    void register_tests(stream_profile stream,
-        vector<shared_ptr<test>>& tests) const override
+    string name;
+    string input;
+    size_t frames;
+    double fps;
+    double mean, stdev, p50, p90, p99, max;  // milliseconds
+    double allocations_per_frame;
+    double bytes_per_frame;                  // bytes read + written per frame
+
+    string key() const { return name + "@" + input; }
+
+    json to_json() const
     {
-        if (stream.stream_type() == RS2_STREAM_DEPTH)
-        {
-            REGISTER_GL_TEST(gl::colorizer);
-            REGISTER_GL_TEST(gl::pointcloud);
-        }
-        if (stream.format() == RS2_FORMAT_YUYV)
+        return json{ { "name", name },
+                     { "input", input },
+                     { "frames", frames },
+                     { "fps", fps },
+                     { "latency-ms",
+                       { { "mean", mean }, { "stdev", stdev }, { "p50", p50 }, { "p90", p90 }, { "p99", p99 }, { "max", max } } },
+                     { "allocations-per-frame", allocations_per_frame },
+                     { "bytes-per-frame", bytes_per_frame } };
+    }
+};
+
+double percentile( const vector< double > & sorted, double p )
+{
+    auto i = size_t( p * ( sorted.size() - 1 ) + 0.5 );
+    return sorted[min( i, sorted.size() - 1 )];
+}
+
+result summarize( string const & name, string const & input, vector< double > & latencies, double total,
+                  size_t allocated, size_t bytes )
+{
+    result res;
+    res.name = name;
+    res.input = input;
+    res.frames = latencies.size();
+    res.fps = total > 0 ? res.frames / total : 0;
+    res.mean = accumulate( latencies.begin(), latencies.end(), 0.0 ) / res.frames;
+    auto sq_sum = inner_product( latencies.begin(), latencies.end(), latencies.begin(), 0.0 );
+    res.stdev = sqrt( max( 0.0, sq_sum / res.frames - res.mean * res.mean ) );
+    sort( latencies.begin(), latencies.end() );
+    res.p50 = percentile( latencies, 0.5 );
+    res.p90 = percentile( latencies, 0.9 );
+    res.p99 = percentile( latencies, 0.99 );
+    res.max = latencies.back();
+    res.allocations_per_frame = double( allocated ) / res.frames;
+    res.bytes_per_frame = double( bytes ) / res.frames;
+    return res;
+}
+
+result run( test & t, const input_set & input, int warmup, int repeat )
+{
+    for( int i = 0; i < warmup; ++i )
+        t.process( input.frames[i % input.frames.size()] );
+
+    vector< double > latencies;
+    latencies.reserve( input.frames.size() * repeat );
+    size_t bytes = 0;
+
+    auto allocations_before = allocations.load();
+    auto start = high_resolution_clock::now();
+    for( int r = 0; r < repeat; ++r )
+        for( auto && f : input.frames )
         {
-            REGISTER_GL_TEST(gl::yuy_decoder);
+            auto p1 = high_resolution_clock::now();
+            auto out = t.process( f );
+            auto p2 = high_resolution_clock::now();
+            latencies.push_back( duration_cast< nanoseconds >( p2 - p1 ).count() * 1e-6 );
+            bytes += frame_bytes( f ) + frame_bytes( out );
         }
+    auto total = duration_cast< nanoseconds >( high_resolution_clock::now() - start ).count() * 1e-9;
+    // Reserved up-front, so the only allocations counted are those made while processing
+    auto allocated = allocations.load() - allocations_before;
+
+    return summarize( t.name(), input.kind + " " + input.resolution, latencies, total, allocated, bytes );
+}
+
+// Feeds streams at mixed frame rates through a syncer, in timestamp order, and measures the cost of each
+// frame: from the sensor callback, through the syncer's matchers, to the frameset being available
+result run_syncer( int streams, int frames_per_stream, int warmup )
+{
+    static const int rates[] = { 30, 60, 15, 90 };
+    static const int width = 16, height = 16;
+    static uint8_t pixels[width * height * 2] = {};
+
+    software_device dev;
+    vector< software_sensor > sensors;
+    vector< stream_profile > profiles;
+    for( int i = 0; i < streams; ++i )
+    {
+        auto s = dev.add_sensor( "Sensor " + to_string( i ) );
+        profiles.push_back( s.add_video_stream( { RS2_STREAM_INFRARED, i + 1, i, width, height, rates[i % 4], 2,
+                                                  RS2_FORMAT_Y16, make_intrinsics( width, height ) } ) );
+        sensors.push_back( s );
     }
-};
 
-int main(int argc, char** argv) try
+    struct event
+    {
+        double timestamp;
+        int stream;
+        int number;
+    };
+    vector< event > events;
+    auto duration = double( warmup + frames_per_stream ) * 1000 / 30;
+    for( int i = 0; i < streams; ++i )
+    {
+        auto gap = 1000. / rates[i % 4];
+        int number = 0;
+        for( double ts = 0; ts < duration; ts += gap )
+            events.push_back( { ts, i, ++number } );
+    }
+    stable_sort( events.begin(), events.end(), []( event const & a, event const & b ) { return a.timestamp < b.timestamp; } );
+
+    syncer sync;
+    for( int i = 0; i < streams; ++i )
+    {
+        sensors[i].open( profiles[i] );
+        sensors[i].start( sync );
+    }
+
+    vector< double > latencies;
+    latencies.reserve( events.size() );
+    size_t bytes = 0, allocated = 0;
+    auto measure_from = size_t( events.size() * warmup / ( warmup + frames_per_stream ) );
+    double total = 0;
+    for( size_t e = 0; e < events.size(); ++e )
+    {
+        auto & ev = events[e];
+        auto allocations_before = allocations.load();
+        auto p1 = high_resolution_clock::now();
+        sensors[ev.stream].on_video_frame( { pixels, []( void * ) {}, width * 2, 2, ev.timestamp,
+                                             RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, ev.number, profiles[ev.stream] } );
+        frameset fs;
+        while( sync.poll_for_frames( &fs ) )
+            fs = frameset();
+        auto p2 = high_resolution_clock::now();
+        if( e < measure_from )
+            continue;
+        allocated += allocations.load() - allocations_before;
+        auto ms = duration_cast< nanoseconds >( p2 - p1 ).count() * 1e-6;
+        latencies.push_back( ms );
+        total += ms * 1e-3;
+        bytes += sizeof( pixels );
+    }
+
+    for( auto & s : sensors )
+    {
+        s.stop();
+        s.close();
+    }
+
+    return summarize( "syncer", to_string( streams ) + " streams mixed fps", latencies, total, allocated, bytes );
+}
+
+
+// Returns the number of results that regressed by more than 'threshold' percent vs. the baseline
+int compare( const vector< result > & results, const json & baseline, double threshold )
 {
-    std::string serial;
-    rs2_stream second_stream;
-    if (!device_with_streams({ RS2_STREAM_DEPTH }, serial))
-        return EXIT_SUCCESS;
-
-    if (device_with_streams({ RS2_STREAM_COLOR }, serial))
-        second_stream = RS2_STREAM_COLOR;
-    else if (device_with_streams({ RS2_STREAM_INFRARED }, serial))
-        second_stream = RS2_STREAM_INFRARED;
-    else
+    map< string, json > base;
+    for( auto && r : baseline.at( "results" ) )
+        base[r.at( "name" ).get< string >() + "@" + r.at( "input" ).get< string >()] = r;
+
+    int regressions = 0;
+    auto factor = 1 + threshold / 100;
+    cout << endl;
+    cout << "|Filter Name |Input |Median(ms) |Baseline(ms) |Allocs |Baseline Allocs |Status |" << endl;
+    cout << "|------------|------|-----------|-------------|-------|----------------|-------|" << endl;
+    for( auto && r : results )
     {
-        std::cout<< " Connect a Depth Camera that supports either RGB or Infrared streams." <<std::endl;
-        return EXIT_SUCCESS;
+        auto it = base.find( r.key() );
+        if( it == base.end() )
+            continue;
+        auto base_p50 = it->second.at( "latency-ms" ).at( "p50" ).get< double >();
+        auto base_allocs = it->second.at( "allocations-per-frame" ).get< double >();
+        bool regressed = r.p50 > base_p50 * factor || r.allocations_per_frame > base_allocs * factor + 0.5;
+        if( regressed )
+            ++regressions;
+        cout << "|" << r.name << " |" << r.input << " |" << r.p50 << " |" << base_p50 << " |"
+             << r.allocations_per_frame << " |" << base_allocs << " |" << ( regressed ? "**REGRESSED**" : "ok" ) << " |"
+             << endl;
     }
+    return regressions;
+}
 
-    CmdLine cmd("librealsense rs-benchmark tool", ' ', RS2_API_FULL_VERSION_STR);
-    cmd.parse(argc, argv);
+vector< string > split( const string & s, char delim )
+{
+    vector< string > parts;
+    stringstream ss( s );
+    string part;
+    while( getline( ss, part, delim ) )
+        if( ! part.empty() )
+            parts.push_back( part );
+    return parts;
+}
 
-    glfwInit();
-    glfwWindowHint(GLFW_VISIBLE, 0);
-    auto win = glfwCreateWindow(100,100,"offscreen",0,0);
-    glfwMakeContextCurrent(win);
-    gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
-    
-    auto renderer = (const char*)glGetString(GL_RENDERER);
-    auto version = (const char*)glGetString(GL_VERSION);
+int main( int argc, char ** argv ) try
+{
+    CmdLine cmd( "librealsense rs-benchmark tool", ' ', RS2_API_FULL_VERSION_STR );
+
+    ValueArg< string > input_file( "i", "input", "ROS-bag to read frames from (default - synthetic frames)", false, "", "ros-bag-file" );
+    ValueArg< string > resolutions( "r", "resolutions", "Comma-separated synthetic resolutions", false, "640x480,848x480,1280x720", "WxH[,WxH...]" );
+    ValueArg< int > frame_count( "n", "frames", "Number of distinct input frames per stream", false, 30, "count" );
+    ValueArg< int > repeat( "p", "repeat", "Number of passes over the input frames", false, 10, "count" );
+    ValueArg< int > warmup( "w", "warmup", "Number of untimed frames to process before measuring", false, 10, "count" );
+    ValueArg< unsigned > seed( "s", "seed", "Seed for the synthetic frame content", false, 1, "seed" );
+    ValueArg< string > filter_name( "f", "filter", "Run only tests whose name contains this string", false, "", "name" );
+    ValueArg< string > json_file( "j", "json", "Write results to this JSON file", false, "", "json-file" );
+    ValueArg< string > baseline_file( "b", "baseline", "Compare against results from a previous --json run", false, "", "json-file" );
+    ValueArg< double > threshold( "t", "threshold", "Allowed regression vs. the baseline, in percent", false, 10, "percent" );
+
+    cmd.add( input_file );
+    cmd.add( resolutions );
+    cmd.add( frame_count );
+    cmd.add( repeat );
+    cmd.add( warmup );
+    cmd.add( seed );
+    cmd.add( filter_name );
+    cmd.add( json_file );
+    cmd.add( baseline_file );
+    cmd.add( threshold );
+    cmd.parse( argc, argv );
+
+    if( frame_count.getValue() < 1 || repeat.getValue() < 1 || warmup.getValue() < 0 )
+        throw runtime_error( "frames and repeat must be positive" );
+
+    vector< input_set > inputs;
+    if( ! input_file.getValue().empty() )
+        inputs = load_recording( input_file.getValue(), frame_count.getValue() );
+    else
+        for( auto && res : split( resolutions.getValue(), ',' ) )
+        {
+            int width = 0, height = 0;
+            char x;
+            stringstream ss( res );
+            if( ! ( ss >> width >> x >> height ) || x != 'x' || width <= 0 || height <= 0 )
+                throw runtime_error( "invalid resolution '" + res + "'" );
+            auto sets = synthesize( width, height, frame_count.getValue(), seed.getValue() );
+            inputs.insert( inputs.end(), sets.begin(), sets.end() );
+        }
 
     cout << endl;
     cout << "|            |     |" << endl;
     cout << "|------------|-----|" << endl;
-
     cout << "|**CPU** |" << get_cpu() << " |" << endl;
-    cout << "|**GPU** | " << renderer << " |" << endl;
-    cout << "|**Graphics Driver** |" << version << " |" << endl;
-
-    vector<shared_ptr<suite>> suites;
-    suites.push_back(make_shared<processing_blocks>());
-    
-#ifndef __APPLE__
-    gl::init_processing(win, true);
-    suites.push_back(make_shared<gl_blocks>());
-#endif
+    cout << "|**Version** |" << RS2_API_FULL_VERSION_STR << " |" << endl;
+    cout << "|**Input** |" << ( input_file.getValue().empty() ? "synthetic" : input_file.getValue() ) << " |" << endl;
+    cout << endl;
+    cout << "|Filter Name |Input |Median(ms) |P90(ms) |P99(ms) |Max(ms) |FPS |Allocs/Frame |MB/s |" << endl;
+    cout << "|------------|------|-----------|--------|--------|--------|----|-------------|-----|" << endl;
+    cout << fixed << setprecision( 3 );
 
-    pipeline p;
-    config cfg;
-    if (!serial.empty())
-        cfg.enable_device(serial);
-    cfg.enable_stream(RS2_STREAM_DEPTH);
-    if(second_stream == RS2_STREAM_COLOR)
-        cfg.enable_stream(RS2_STREAM_COLOR, RS2_FORMAT_YUYV, 30);
-    else
-        cfg.enable_stream(RS2_STREAM_INFRARED);
-    auto prof = p.start(cfg);
-    auto dev = prof.get_device();
-    auto name = dev.get_info(RS2_CAMERA_INFO_NAME);
-    cout << "|**Device Name** |" << name << " |" << endl << endl;
-    cout.precision(3);
-
-    for (auto stream : prof.get_streams())
+    auto tests = register_tests();
+    vector< result > results;
+    for( auto && input : inputs )
     {
-        cout << "**Stream Type**: " << stream.stream_name();
-        if (auto vs = stream.as<video_stream_profile>())
+        if( input.frames.empty() )
+            continue;
+        for( auto && make : tests[input.kind] )
         {
-            cout << ", **Resolution**: " << vs.width() << " x " << vs.height() << endl;
+            // A fresh block per input, so stateful filters (temporal) always start from the same state
+            auto t = make();
+            if( t->name().find( filter_name.getValue() ) == string::npos )
+                continue;
+
+            auto r = run( *t, input, warmup.getValue(), repeat.getValue() );
+            cout << "|" << r.name << " |" << r.input << " |" << r.p50 << " |" << r.p90 << " |" << r.p99 << " |"
+                 << r.max << " |" << setprecision( 1 ) << r.fps << " |" << r.allocations_per_frame << " |"
+                 << r.bytes_per_frame * r.fps / ( 1024 * 1024 ) << " |" << setprecision( 3 ) << endl;
+            results.push_back( r );
         }
-        auto fps = stream.fps();
-
-        vector<shared_ptr<test>> procs;
-        for (auto&& suite : suites)
-            suite->register_tests(stream, procs);
+    }
 
-        vector<frame> frames;
-        for (int i = 0; i < 5 * fps; i++)
+    if( input_file.getValue().empty() && string( "syncer" ).find( filter_name.getValue() ) != string::npos )
+        for( int streams : { 2, 4, 8 } )
         {
-            auto fs = p.wait_for_frames();
-            for (auto&& f : fs)
-                if (f.get_profile().unique_id() == stream.unique_id())
-                {
-                    f.keep();
-                    frames.push_back(f);
-                }
+            auto r = run_syncer( streams, frame_count.getValue() * repeat.getValue(), warmup.getValue() );
+            cout << "|" << r.name << " |" << r.input << " |" << r.p50 << " |" << r.p90 << " |" << r.p99 << " |"
+                 << r.max << " |" << setprecision( 1 ) << r.fps << " |" << r.allocations_per_frame << " |"
+                 << r.bytes_per_frame * r.fps / ( 1024 * 1024 ) << " |" << setprecision( 3 ) << endl;
+            results.push_back( r );
         }
 
-        cout << endl;
-        cout << "|Filter Name |Step |Median(m)   |Mean(m)  |STD(m)  |Max(m)  | Max FPS |" << endl;
-        cout << "|------------|-----|------------|---------|--------|--------|---------|" << endl;
+    if( ! json_file.getValue().empty() )
+    {
+        json j = { { "version", RS2_API_FULL_VERSION_STR },
+                   { "cpu", get_cpu() },
+                   { "input", input_file.getValue().empty() ? "synthetic" : input_file.getValue() },
+                   { "seed", seed.getValue() },
+                   { "results", json::array() } };
+        for( auto && r : results )
+            j["results"].push_back( r.to_json() );
+        ofstream out( json_file.getValue() );
+        if( ! out )
+            throw runtime_error( "failed to open " + json_file.getValue() );
+        out << setw( 4 ) << j << endl;
+    }
 
-        string last_name = "";
-        for (auto&& test : procs)
+    if( ! baseline_file.getValue().empty() )
+    {
+        ifstream in( baseline_file.getValue() );
+        if( ! in )
+            throw runtime_error( "failed to open " + baseline_file.getValue() );
+        auto regressions = compare( results, json::parse( in ), threshold.getValue() );
+        if( regressions )
         {
-            map<string, vector<double>> steps;
-
-            for (auto&& f : frames)
-            {
-                auto p1 = high_resolution_clock::now();
-                auto f1 = test->prepare(f);
-                auto p2 = high_resolution_clock::now();
-                auto f2 = test->process(f1);
-                auto p3 = high_resolution_clock::now();
-                test->finish(f2);
-                auto p4 = high_resolution_clock::now();
-
-                auto prep = duration_cast<microseconds>(p2 - p1).count();
-                auto proc = duration_cast<microseconds>(p3 - p2).count();
-                auto down = duration_cast<microseconds>(p4 - p3).count();
-                auto total = duration_cast<microseconds>(p4 - p1).count();
-
-                steps[" Upload"].push_back(prep * 0.001);
-                steps["Calculate"].push_back(proc * 0.001);
-                steps["Download"].push_back(down * 0.001);
-                steps["Total"].push_back(total * 0.001);
-            }
-
-            int printed_steps = 0;
-            for (auto&& sm : steps)
-            {
-                if (sm.first == "Total" && printed_steps < 2) continue;
-
-                auto& m = sm.second;
-                double max = *max_element(m.begin(), m.end());
-                double sum = accumulate(m.begin(), m.end(), 0.0);
-                double mean = sum / m.size();
-                double sq_sum = inner_product(m.begin(), m.end(), m.begin(), 0.0);
-                double stdev = sqrt(sq_sum / m.size() - mean * mean);
-                sort(m.begin(), m.end());
-                double median = m[m.size() / 2];
-
-                vector<int> fps_values{ 6, 15, 30, 60, 90 };
-
-                auto expected_max = mean + 1.645 * stdev; // 95-percentile - camera spec allows up to 5% outliers
-
-                int best_fps = 1;
-                for (int fps : fps_values)
-                {
-                    auto max_allowed = 1000.0 / fps;
-                    if (expected_max < max_allowed) best_fps = fps;
-                }
-
-                if (sm.first == "Calculate" || median > 0.001)
-                {
-                    bool is_new = last_name != test->name();
-                    bool is_total = sm.first == "Total";
-                    cout << "|" << (is_new ? test->name() : "") 
-                        << " |" << (is_total ? "**" : "") << sm.first << (is_total ? "**" : "") << " |"
-                        << fixed << median << " |" << mean << " |"
-                        << stdev << " |" << max << " |";
-
-                    if (best_fps == 90) cout << "90 ![90](https://placehold.it/15/35ff4d/000000?text=+)";
-                    else if (best_fps == 60) cout << "60 ![60](https://placehold.it/15/6fe837/000000?text=+)";
-                    else if (best_fps == 30) cout << "30 ![30](https://placehold.it/15/82c13e/000000?text=+)";
-                    else if (best_fps == 15) cout << "15 ![15](https://placehold.it/15/eff70c/000000?text=+)";
-                    else if (best_fps == 6) cout << "6 ![6](https://placehold.it/15/d6a726/000000?text=+)";
-                    else cout << "? ![unknown](https://placehold.it/15/d65d26/000000?text=+)";
-
-                    cout << " |" << endl;
-
-                    printed_steps++;
-                    last_name = test->name();
-                }
-            }
+            cerr << regressions << " result(s) regressed by more than " << threshold.getValue() << "%" << endl;
+            return EXIT_FAILURE;
         }
-        cout << endl;
     }
 
     return EXIT_SUCCESS;
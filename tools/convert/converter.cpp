@@ -2,6 +2,7 @@
 // Copyright(c) 2021 Intel Corporation. All Rights Reserved.
 
 #include <fstream>
+#include <iomanip>
 #include "converter.hpp"
 
 using namespace rs2::tools::converter;
@@ -28,6 +29,21 @@ void rs2::tools::converter::metadata_to_txtfile(const rs2::frame& frm, const std
     file.close();
 }
 
+void rs2::tools::converter::depth_row_to_meters(const rs2::depth_frame& frm, int y, float* distances)
+{
+    auto width = frm.get_width();
+    if (frm.get_profile().format() != RS2_FORMAT_Z16) {
+        for (int x = 0; x < width; x++)
+            distances[x] = frm.get_distance(x, y);
+        return;
+    }
+
+    auto units = frm.get_units();
+    auto pixels = static_cast<const uint16_t*>(frm.get_data()) + y * width;
+    for (int x = 0; x < width; x++)
+        distances[x] = pixels[x] * units;
+}
+
 bool converter_base::frames_map_get_and_set(rs2_stream streamType, frame_number_t frameNumber)
 {
     if (_framesMap.find(streamType) == _framesMap.end()) {
@@ -39,24 +55,103 @@ bool converter_base::frames_map_get_and_set(rs2_stream streamType, frame_number_
 
     if (!result) {
         set.emplace(frameNumber);
+        mark_progress();
     }
 
     return result;
 }
 
-void converter_base::wait_sub_workers()
+void converter_base::mark_progress()
 {
-    for_each(_subWorkers.begin(), _subWorkers.end(),
+    std::lock_guard<std::mutex> lock(_mutex);
+    _last_frame = std::chrono::steady_clock::now();
+    if (!_started) {
+        _first_frame = _last_frame;
+        _started = true;
+    }
+}
+
+converter_base::~converter_base()
+{
+    join_workers();
+}
+
+void converter_base::join_workers()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _cv.notify_all();
+
+    for_each(_workers.begin(), _workers.end(),
         [](std::thread& t) {
             t.join();
         });
+    _workers.clear();
+}
 
-    _subWorkers.clear();
+void converter_base::set_workers(size_t n)
+{
+    _n_workers = n;
+}
+
+void converter_base::submit(std::function<void()> task)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_workers.empty()) {
+        auto n = _n_workers ? _n_workers : std::max(1u, std::thread::hardware_concurrency());
+        for (size_t i = 0; i < n; ++i)
+            _workers.emplace_back([this] { work(); });
+    }
+
+    _cv.wait(lock, [this] { return _tasks.size() < _workers.size(); });
+    _tasks.push_back(std::move(task));
+    _cv.notify_all();
+}
+
+void converter_base::work()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+        _cv.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+        if (_tasks.empty())
+            return;
+
+        auto task = std::move(_tasks.front());
+        _tasks.pop_front();
+        ++_busy;
+        _cv.notify_all();
+        lock.unlock();
+
+        std::exception_ptr error;
+        try {
+            task();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        --_busy;
+        _last_frame = std::chrono::steady_clock::now();
+        if (error && !_error)
+            _error = error;
+        _cv.notify_all();
+    }
 }
 
 void converter_base::wait()
 {
-    _worker.join();
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this] { return _tasks.empty() && !_busy; });
+
+    if (_error) {
+        auto error = _error;
+        _error = nullptr;
+        std::rethrow_exception(error);
+    }
 }
 
 std::string converter_base::get_statistics()
@@ -64,14 +159,23 @@ std::string converter_base::get_statistics()
     std::stringstream result;
     result << name() << '\n';
 
+    size_t n_frames = 0;
     for (auto& i : _framesMap) {
         result << '\t'
             << i.second.size() << ' '
             << (static_cast<rs2_stream>(i.first) != rs2_stream::RS2_STREAM_ANY ? rs2_stream_to_string(static_cast<rs2_stream>(i.first)) : "")
             << " frame(s) processed"
             << '\n';
+        n_frames += i.second.size();
+    }
+
+    std::chrono::duration<double> seconds = _last_frame - _first_frame;
+    if (n_frames && seconds.count() > 0) {
+        result << '\t'
+            << std::fixed << std::setprecision(1) << n_frames / seconds.count()
+            << " frames per second"
+            << '\n';
     }
 
     return (result.str());
 }
-
@@ -10,6 +10,13 @@
 #include <string>
 #include <sstream>
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
 
 #include "librealsense2/rs.hpp"
 
@@ -20,35 +27,56 @@ namespace rs2 {
 
             void metadata_to_txtfile(const rs2::frame& frm, const std::string& filename);
 
+            // Fills a row of distances as get_distance() gives them, without an API call per pixel
+            void depth_row_to_meters(const rs2::depth_frame& frm, int y, float* distances);
+
             typedef unsigned long long frame_number_t;
 
             class converter_base {
             protected:
-                std::thread _worker;
-                std::vector<std::thread> _subWorkers;
                 std::unordered_map<int, std::unordered_set<frame_number_t>> _framesMap;
 
+            private:
+                std::mutex _mutex;
+                std::condition_variable _cv;
+                std::deque<std::function<void()>> _tasks;
+                std::vector<std::thread> _workers;
+                size_t _n_workers = 0;
+                size_t _busy = 0;
+                bool _stopping = false;
+                std::exception_ptr _error;
+
+                std::chrono::steady_clock::time_point _first_frame;
+                std::chrono::steady_clock::time_point _last_frame;
+                bool _started = false;
+
+                void work();
+                void mark_progress();
+
             protected:
                 bool frames_map_get_and_set(rs2_stream streamType, frame_number_t frameNumber);
-                void wait_sub_workers();
 
-                template <typename F> void start_worker(const F& f)
-                {
-                    _worker = std::thread(f);
-                }
+                // Runs the task on one of the converter's workers, in no particular order; frames it uses must
+                // be kept. Waits while the workers have as many tasks again waiting for them.
+                void submit(std::function<void()> task);
 
-                template <typename F> void add_sub_worker(const F& f)
-                {
-                    _subWorkers.emplace_back(f);
-                }
+                // Finishes the tasks submitted so far and stops the workers. A converter whose tasks use its own
+                // members calls this from its destructor, while they are still there.
+                void join_workers();
 
             public:
+                virtual ~converter_base();
+
                 virtual void convert(rs2::frame& frame) = 0;
                 virtual std::string name() const = 0;
 
                 virtual std::string get_statistics();
 
-                void wait();
+                // How many frames are converted at once (default - number of cores); set before the first frame
+                void set_workers(size_t n);
+
+                // Waits until all the frames given so far are converted
+                virtual void wait();
             };
 
         }
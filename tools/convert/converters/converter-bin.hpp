@@ -7,6 +7,7 @@
 
 #include <fstream>
 #include <cmath>
+#include <vector>
 
 #include "../converter.hpp"
 
@@ -66,6 +67,11 @@ namespace rs2 {
                 {
                 }
 
+                ~converter_bin()
+                {
+                    join_workers();
+                }
+
                 std::string name() const override
                 {
                     return "BIN converter";
@@ -83,47 +89,43 @@ namespace rs2 {
                         return;
                     }
 
-                    start_worker(
-                        [this, &frame] {
-                            rs2::depth_frame depthframe = frame.as<rs2::depth_frame>();
-
-                            std::stringstream filename;
-                            filename << _filePath
-                                << "_" << depthframe.get_profile().stream_name()
-                                << "_" << std::setprecision(14) << std::fixed << depthframe.get_timestamp()
-                                << ".bin";
-
-                            std::stringstream metadata_file;
-                            metadata_file << _filePath
-                                << "_" << depthframe.get_profile().stream_name()
-                                << "_metadata_" << std::setprecision(14) << std::fixed << depthframe.get_timestamp()
-                                << ".txt";
-
-                            std::string filenameS = filename.str();
-                            std::string metadataS = metadata_file.str();
-
-                            add_sub_worker(
-                                [filenameS, metadataS, depthframe] {
-                                    std::ofstream fs(filenameS, std::ios::binary | std::ios::trunc);
-
-                                    if (fs) {
-                                        uint8_t buffer[4];
-
-                                        for (int y = 0; y < depthframe.get_height(); y++) {
-                                            for (int x = 0; x < depthframe.get_width(); x++) {
-                                                fs.write(
-                                                    static_cast<const char *>(to_ieee754_32(depthframe.get_distance(x, y), buffer))
-                                                    , sizeof buffer);
-                                            }
-                                        }
-
-                                        fs.flush();
+                    std::stringstream filename;
+                    filename << _filePath
+                        << "_" << depthframe.get_profile().stream_name()
+                        << "_" << std::setprecision(14) << std::fixed << depthframe.get_timestamp()
+                        << ".bin";
+
+                    std::stringstream metadata_file;
+                    metadata_file << _filePath
+                        << "_" << depthframe.get_profile().stream_name()
+                        << "_metadata_" << std::setprecision(14) << std::fixed << depthframe.get_timestamp()
+                        << ".txt";
+
+                    std::string filenameS = filename.str();
+                    std::string metadataS = metadata_file.str();
+
+                    depthframe.keep();
+                    submit(
+                        [filenameS, metadataS, depthframe] {
+                            std::ofstream fs(filenameS, std::ios::binary | std::ios::trunc);
+
+                            if (fs) {
+                                auto width = depthframe.get_width();
+                                std::vector<float> distances(width);
+                                std::vector<uint8_t> row(width * 4);
+
+                                for (int y = 0; y < depthframe.get_height(); y++) {
+                                    depth_row_to_meters(depthframe, y, distances.data());
+                                    for (int x = 0; x < width; x++) {
+                                        to_ieee754_32(distances[x], row.data() + x * 4);
                                     }
+                                    fs.write(reinterpret_cast<const char *>(row.data()), row.size());
+                                }
 
-                                    metadata_to_txtfile(depthframe, metadataS);
-                            });
+                                fs.flush();
+                            }
 
-                            wait_sub_workers();
+                            metadata_to_txtfile(depthframe, metadataS);
                     });
                 }
             };
@@ -45,55 +45,56 @@ converter_csv::converter_csv(const std::string& filePath, rs2_stream streamType)
     : _filePath(filePath)
     , _streamType(streamType)
     , _imu_pose_collection()
-    , _sub_workers_joined(false)
-    , _m()
-    , _cv()
 {
 }
 
+converter_csv::~converter_csv()
+{
+    join_workers();
+}
+
 void converter_csv::convert_depth(rs2::depth_frame& depthframe)
 {
     if (frames_map_get_and_set(depthframe.get_profile().stream_type(), depthframe.get_frame_number())) {
         return;
     }
 
-    start_worker(
-        [this, &depthframe] {
-
-            std::stringstream filename;
-            filename << _filePath
-                << "_" << depthframe.get_profile().stream_name()
-                << "_" << std::setprecision(14) << std::fixed << depthframe.get_timestamp()
-                << ".csv";
-
-            std::stringstream metadata_file;
-            metadata_file << _filePath
-                << "_" << depthframe.get_profile().stream_name()
-                << "_metadata_" << std::setprecision(14) << std::fixed << depthframe.get_timestamp()
-                << ".txt";
-
-            std::string filenameS = filename.str();
-            std::string metadataS = metadata_file.str();
-
-            add_sub_worker(
-                [filenameS, metadataS, depthframe] {
-                    std::ofstream fs(filenameS, std::ios::trunc);
-
-                    if (fs) {
-                        for (int y = 0; y < depthframe.get_height(); y++) {
-                            auto delim = "";
-
-                            for (int x = 0; x < depthframe.get_width(); x++) {
-                                fs << delim << depthframe.get_distance(x, y);
-                                delim = ",";
-                            }
-                            fs << '\n';
-                        }
-                        fs.flush();
+    std::stringstream filename;
+    filename << _filePath
+        << "_" << depthframe.get_profile().stream_name()
+        << "_" << std::setprecision(14) << std::fixed << depthframe.get_timestamp()
+        << ".csv";
+
+    std::stringstream metadata_file;
+    metadata_file << _filePath
+        << "_" << depthframe.get_profile().stream_name()
+        << "_metadata_" << std::setprecision(14) << std::fixed << depthframe.get_timestamp()
+        << ".txt";
+
+    std::string filenameS = filename.str();
+    std::string metadataS = metadata_file.str();
+
+    depthframe.keep();
+    submit(
+        [filenameS, metadataS, depthframe] {
+            std::ofstream fs(filenameS, std::ios::trunc);
+
+            if (fs) {
+                std::vector<float> distances(depthframe.get_width());
+
+                for (int y = 0; y < depthframe.get_height(); y++) {
+                    depth_row_to_meters(depthframe, y, distances.data());
+                    auto delim = "";
+
+                    for (auto distance : distances) {
+                        fs << delim << distance;
+                        delim = ",";
                     }
-                    metadata_to_txtfile(depthframe, metadataS);
-                });
-            wait_sub_workers();
+                    fs << '\n';
+                }
+                fs.flush();
+            }
+            metadata_to_txtfile(depthframe, metadataS);
         });
 }
 
@@ -144,62 +145,57 @@ void converter_csv::save_motion_pose_data_to_file()
 
 }
 
+// Collected in the order the frames arrive, and written by wait()
 void converter_csv::convert_motion_pose(rs2::frame& f)
 {
     if (frames_map_get_and_set(f.get_profile().stream_type(), f.get_frame_number())) {
         return;
     }
 
-    start_worker(
-        [this, f] {
-
-            add_sub_worker(
-                [this, f] {
-                    auto stream_uid = std::make_pair(f.get_profile().stream_type(),
-                        f.get_profile().stream_index());
-
-                    long long frame_timestamp = 0LL;
-                    if (f.supports_frame_metadata(RS2_FRAME_METADATA_FRAME_TIMESTAMP))
-                        frame_timestamp = f.get_frame_metadata(RS2_FRAME_METADATA_FRAME_TIMESTAMP);
-
-                    long long backend_timestamp = 0LL;
-                    if (f.supports_frame_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP))
-                        backend_timestamp = f.get_frame_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP);
-
-                    long long time_of_arrival = 0LL;
-                    if (f.supports_frame_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL))
-                        time_of_arrival = f.get_frame_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL);
-                    
-                    motion_pose_frame_record record{ f.get_profile().stream_type(),
-                                                f.get_profile().stream_index(),
-                                                f.get_frame_number(),
-                                                frame_timestamp,
-                                                backend_timestamp,
-                                                time_of_arrival};
-
-                    if (auto motion = f.as<rs2::motion_frame>())
-                    {
-                        auto axes = motion.get_motion_data();
-                        record._params = { axes.x, axes.y, axes.z };
-                    }
+    auto stream_uid = std::make_pair(f.get_profile().stream_type(),
+        f.get_profile().stream_index());
+
+    long long frame_timestamp = 0LL;
+    if (f.supports_frame_metadata(RS2_FRAME_METADATA_FRAME_TIMESTAMP))
+        frame_timestamp = f.get_frame_metadata(RS2_FRAME_METADATA_FRAME_TIMESTAMP);
+
+    long long backend_timestamp = 0LL;
+    if (f.supports_frame_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP))
+        backend_timestamp = f.get_frame_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP);
+
+    long long time_of_arrival = 0LL;
+    if (f.supports_frame_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL))
+        time_of_arrival = f.get_frame_metadata(RS2_FRAME_METADATA_TIME_OF_ARRIVAL);
+    
+    motion_pose_frame_record record{ f.get_profile().stream_type(),
+                                f.get_profile().stream_index(),
+                                f.get_frame_number(),
+                                frame_timestamp,
+                                backend_timestamp,
+                                time_of_arrival};
+
+    if (auto motion = f.as<rs2::motion_frame>())
+    {
+        auto axes = motion.get_motion_data();
+        record._params = { axes.x, axes.y, axes.z };
+    }
 
-                    if (auto pf = f.as<rs2::pose_frame>())
-                    {
-                        auto pose = pf.get_pose_data();
-                        record._params = { pose.translation.x, pose.translation.y, pose.translation.z,
-                                pose.rotation.x,pose.rotation.y,pose.rotation.z,pose.rotation.w };
-                    }
+    if (auto pf = f.as<rs2::pose_frame>())
+    {
+        auto pose = pf.get_pose_data();
+        record._params = { pose.translation.x, pose.translation.y, pose.translation.z,
+                pose.rotation.x,pose.rotation.y,pose.rotation.z,pose.rotation.w };
+    }
 
-                    _imu_pose_collection[stream_uid].emplace_back(record);
-                });
-            wait_sub_workers();
-            _sub_workers_joined = true;
-            _cv.notify_all();
-        });
-    std::unique_lock<std::mutex> lck(_m);
-    while (!_sub_workers_joined)
-        _cv.wait(lck);
-    save_motion_pose_data_to_file();
+    _imu_pose_collection[stream_uid].emplace_back(record);
+}
+
+void converter_csv::wait()
+{
+    converter_base::wait();
+
+    if (!_imu_pose_collection.empty())
+        save_motion_pose_data_to_file();
 }
 
 void converter_csv::convert(rs2::frame& frame)
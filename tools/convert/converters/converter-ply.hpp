@@ -22,6 +22,11 @@ namespace rs2 {
                 {
                 }
 
+                ~converter_ply()
+                {
+                    join_workers();
+                }
+
                 std::string name() const override
                 {
                     return "PLY converter";
@@ -29,18 +34,24 @@ namespace rs2 {
 
                 void convert(rs2::frame& frame) override
                 {
-                    rs2::pointcloud pc;
-                    start_worker(
-                        [this, &frame, pc]() mutable {
-                            auto frameset = frame.as<rs2::frameset>();
-                            auto frameDepth = frameset.get_depth_frame();
-                            auto frameColor = frameset.get_color_frame();
-
-                            if (frameDepth && frameColor) {
-                                if (frames_map_get_and_set(rs2_stream::RS2_STREAM_ANY, frameDepth.get_frame_number())) {
-                                    return;
-                                }
-
+                    auto frameset = frame.as<rs2::frameset>();
+                    if (!frameset) {
+                        return;
+                    }
+
+                    auto frameDepth = frameset.get_depth_frame();
+                    auto frameColor = frameset.get_color_frame();
+
+                    if (frameDepth && frameColor) {
+                        if (frames_map_get_and_set(rs2_stream::RS2_STREAM_ANY, frameDepth.get_frame_number())) {
+                            return;
+                        }
+
+                        frameset.keep();
+                        submit(
+                            [this, frameDepth, frameColor] {
+                                // Each worker needs its own: the point cloud keeps state between frames
+                                rs2::pointcloud pc;
                                 pc.map_to(frameColor);
 
                                 auto points = pc.calculate(frameDepth);
@@ -58,8 +69,8 @@ namespace rs2 {
                                     << ".txt";
 
                                 metadata_to_txtfile(frameDepth, metadata_file.str());
-                            }
-                    });
+                        });
+                    }
                 }
             };
 
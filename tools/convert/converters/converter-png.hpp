@@ -22,10 +22,18 @@ namespace rs2 {
                 rs2::colorizer _colorizer;
 
             public:
-                converter_png(const std::string& filePath, rs2_stream streamType = rs2_stream::RS2_STREAM_ANY)
-                    : _filePath(filePath)
-                    , _streamType(streamType)
+                // Compression is at stb's lowest level by default: it is much faster than the higher ones, for a
+                // somewhat larger file
+                converter_png(const std::string& filePath, rs2_stream streamType = rs2_stream::RS2_STREAM_ANY, int compressionLevel = 1)
+                    : _streamType(streamType)
+                    , _filePath(filePath)
                 {
+                    stbi_write_png_compression_level = compressionLevel;
+                }
+
+                ~converter_png()
+                {
+                    join_workers();
                 }
 
                 std::string name() const override
@@ -45,44 +53,39 @@ namespace rs2 {
                         return;
                     }
 
-                    start_worker(
-                        [this, &frame] {
-                            rs2::video_frame videoframe = frame.as<rs2::video_frame>();
-
-                            if (videoframe.get_profile().stream_type() == rs2_stream::RS2_STREAM_DEPTH) {
-                                videoframe = _colorizer.process(videoframe);
-                            }
-
-                            std::stringstream filename;
-                            filename << _filePath
-                                << "_" << videoframe.get_profile().stream_name()
-                                << "_" << std::setprecision(14) << std::fixed << videoframe.get_timestamp()
-                                << ".png";
-
-                            std::stringstream metadata_file;
-                            metadata_file << _filePath
-                                << "_" << videoframe.get_profile().stream_name()
-                                << "_metadata_" << std::setprecision(14) << std::fixed << videoframe.get_timestamp()
-                                << ".txt";
-
-                            std::string filenameS = filename.str();
-                            std::string metadataS = metadata_file.str();
-
-                            add_sub_worker(
-                                [filenameS, metadataS, videoframe] {
-                                    stbi_write_png(
-                                        filenameS.c_str()
-                                        , videoframe.get_width()
-                                        , videoframe.get_height()
-                                        , videoframe.get_bytes_per_pixel()
-                                        , videoframe.get_data()
-                                        , videoframe.get_stride_in_bytes()
-                                    );
-
-                                    metadata_to_txtfile(videoframe, metadataS);
-                            });
-
-                            wait_sub_workers();
+                    // The colorizer keeps state between frames, so it is not used by the workers
+                    if (videoframe.get_profile().stream_type() == rs2_stream::RS2_STREAM_DEPTH) {
+                        videoframe = _colorizer.process(videoframe);
+                    }
+
+                    std::stringstream filename;
+                    filename << _filePath
+                        << "_" << videoframe.get_profile().stream_name()
+                        << "_" << std::setprecision(14) << std::fixed << videoframe.get_timestamp()
+                        << ".png";
+
+                    std::stringstream metadata_file;
+                    metadata_file << _filePath
+                        << "_" << videoframe.get_profile().stream_name()
+                        << "_metadata_" << std::setprecision(14) << std::fixed << videoframe.get_timestamp()
+                        << ".txt";
+
+                    std::string filenameS = filename.str();
+                    std::string metadataS = metadata_file.str();
+
+                    videoframe.keep();
+                    submit(
+                        [filenameS, metadataS, videoframe] {
+                            stbi_write_png(
+                                filenameS.c_str()
+                                , videoframe.get_width()
+                                , videoframe.get_height()
+                                , videoframe.get_bytes_per_pixel()
+                                , videoframe.get_data()
+                                , videoframe.get_stride_in_bytes()
+                            );
+
+                            metadata_to_txtfile(videoframe, metadataS);
                     });
                 }
             };
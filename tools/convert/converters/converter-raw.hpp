@@ -25,6 +25,11 @@ namespace rs2 {
                 {
                 }
 
+                ~converter_raw()
+                {
+                    join_workers();
+                }
+
                 std::string name() const override
                 {
                     return "RAW converter";
@@ -42,41 +47,35 @@ namespace rs2 {
                         return;
                     }
 
-                    start_worker(
-                        [this, &frame] {
-                            rs2::video_frame videoframe = frame.as<rs2::video_frame>();
-
-                            std::stringstream filename;
-                            filename << _filePath
-                                << "_" << videoframe.get_profile().stream_name()
-                                << "_" << std::setprecision(14) << std::fixed << videoframe.get_timestamp()
-                                << ".raw";
-
-                            std::stringstream metadata_file;
-                            metadata_file << _filePath
-                                << "_" << videoframe.get_profile().stream_name()
-                                << "_metadata_" << std::setprecision(14) << std::fixed << videoframe.get_timestamp()
-                                << ".txt";
+                    std::stringstream filename;
+                    filename << _filePath
+                        << "_" << videoframe.get_profile().stream_name()
+                        << "_" << std::setprecision(14) << std::fixed << videoframe.get_timestamp()
+                        << ".raw";
 
-                            std::string filenameS = filename.str();
-                            std::string metadataS = metadata_file.str();
+                    std::stringstream metadata_file;
+                    metadata_file << _filePath
+                        << "_" << videoframe.get_profile().stream_name()
+                        << "_metadata_" << std::setprecision(14) << std::fixed << videoframe.get_timestamp()
+                        << ".txt";
 
-                            add_sub_worker(
-                                [filenameS, metadataS, videoframe] {
-                                    std::ofstream fs(filenameS, std::ios::binary | std::ios::trunc);
+                    std::string filenameS = filename.str();
+                    std::string metadataS = metadata_file.str();
 
-                                    if (fs) {
-                                        fs.write(
-                                            static_cast<const char *>(videoframe.get_data())
-                                            , videoframe.get_stride_in_bytes() * videoframe.get_height());
+                    videoframe.keep();
+                    submit(
+                        [filenameS, metadataS, videoframe] {
+                            std::ofstream fs(filenameS, std::ios::binary | std::ios::trunc);
 
-                                        fs.flush();
-                                    }
+                            if (fs) {
+                                fs.write(
+                                    static_cast<const char *>(videoframe.get_data())
+                                    , videoframe.get_stride_in_bytes() * videoframe.get_height());
 
-                                    metadata_to_txtfile(videoframe, metadataS);
-                            });
+                                fs.flush();
+                            }
 
-                            wait_sub_workers();
+                            metadata_to_txtfile(videoframe, metadataS);
                     });
                 }
             };
@@ -43,6 +43,8 @@ int main(int argc, char** argv) try
     ValueArg <string> frameNumberEnd("t", "last-framenumber", "ignore frames whose frame number is greater than this value", false, "", "last-framenumber");
     ValueArg <string> startTime("s", "start-time", "ignore frames whose timestamp is less than this value (the first frame is at time 0)", false, "", "start-time");
     ValueArg <string> endTime("e", "end-time", "ignore frames whose timestamp is greater than this value (the first frame is at time 0)", false, "", "end-time");
+    ValueArg <unsigned> jobs("j", "jobs", "number of frames each converter writes at once (default - number of cores)", false, 0, "jobs");
+    ValueArg <int> pngCompression("z", "png-compression", "PNG compression level, 1 (fastest) to 9 (smallest files)", false, 1, "png-compression");
 
 
     cmd.add(inputFilename);
@@ -58,6 +60,8 @@ int main(int argc, char** argv) try
     cmd.add(switchDepth);
     cmd.add(switchColor);
     cmd.add( switchTextOutput );
+    cmd.add(jobs);
+    cmd.add(pngCompression);
     cmd.parse(argc, argv);
 
     vector<shared_ptr<rs2::tools::converter::converter_base>> converters;
@@ -80,7 +84,8 @@ int main(int argc, char** argv) try
         converters.push_back(
             make_shared<rs2::tools::converter::converter_png>(
                 outputFilenamePng.getValue()
-                , streamType));
+                , streamType
+                , pngCompression.getValue()));
     }
 
     if (outputFilenameRaw.isSet())
@@ -130,77 +135,20 @@ int main(int argc, char** argv) try
         end_time = (uint64_t) (SECONDS_TO_NANOSECONDS * (std::strtod( endTime.getValue().c_str(), nullptr )));
     }
 
-    //in order to convert frames into ply we need synced depth and color frames, 
-    //therefore we use pipeline
-    if (outputFilenamePly.isSet()) {
-
-        // Since we are running in blocking "non-real-time" mode,
-        // we don't want to prevent process termination if some of the frames
-        // did not find a match and hence were not serviced
-        auto pipe = std::shared_ptr<rs2::pipeline>(
-            new rs2::pipeline(), [](rs2::pipeline*) {});
-
+    if (outputFilenamePly.isSet())
+    {
         plyconverter = make_shared<rs2::tools::converter::converter_ply>(
             outputFilenamePly.getValue());
-
-        rs2::config cfg;
-        cfg.enable_device_from_file(inputFilename.getValue());
-        pipe->start(cfg);
-
-        auto device = pipe->get_active_profile().get_device();
-        rs2::playback playback = device.as<rs2::playback>();
-        playback.set_real_time(false);
-
-        auto duration = playback.get_duration();
-        int progress = 0;
-        auto frameNumber = 0ULL;
-
-        rs2::frameset frameset;
-        uint64_t posCurr = playback.get_position();
-
-        // try_wait_for_frames will keep repeating the last frame at the end of the file,
-        // so we need to exit the look in some other way!
-        while (pipe->try_wait_for_frames(&frameset, 1000))
-        {
-            int posP = static_cast<int>(posCurr * 100. / duration.count());
-            if (posP > progress)
-            {
-                progress = posP;
-                cout << posP << "%" << "\r" << flush;
-            }
-
-            frameNumber = frameset[0].get_frame_number();
-
-            bool process_frame = true;
-            if (frameNumberStart.isSet() && frameNumber < first_frame)
-                process_frame = false;
-            else if (frameNumberEnd.isSet() && frameNumber > last_frame)
-                process_frame = false;
-            else if (startTime.isSet() && posCurr < start_time)
-                process_frame = false;
-            else if (endTime.isSet() && posCurr > end_time)
-                process_frame = false;
-         
-            if( process_frame )
-            {
-                plyconverter->convert(frameset);
-                plyconverter->wait();
-            }
-
-            auto posNext = playback.get_position();
-
-
-            if (posNext < posCurr)
-                break;
-
-            posCurr = posNext;
-        }
+        plyconverter->set_workers(jobs.getValue());
     }
 
-    // for every converter other than ply,
-    // we get the frames from playback sensors 
-    // and convert them one by one
-    if( ! converters.empty() )
+    for_each(converters.begin(), converters.end(),
+        [&jobs](shared_ptr<rs2::tools::converter::converter_base>& converter) {
+        converter->set_workers(jobs.getValue());
+    });
+
+    // The frames are read from the file once, and given to all the converters: each writes them on its own
+    // workers, so it only waits here when those are all busy
     {
         rs2::context ctx;
         auto playback = ctx.load_device(inputFilename.getValue());
@@ -208,6 +156,9 @@ int main(int argc, char** argv) try
         std::vector<rs2::sensor> sensors = playback.query_sensors();
         std::mutex mutex;
 
+        // in order to convert frames into ply we need synced depth and color frames
+        rs2::syncer sync(16);
+
         auto duration = playback.get_duration();
         int progress = 0;
         uint64_t posCurr = playback.get_position();
@@ -240,18 +191,17 @@ int main(int argc, char** argv) try
                     converter->convert(frame);
                 });
 
-                for_each(converters.begin(), converters.end(),
-                    [](shared_ptr<rs2::tools::converter::converter_base>& converter) {
-                    converter->wait();
-                });
+                if (plyconverter)
+                {
+                    sync(frame);
+                    rs2::frameset frameset;
+                    while (sync.poll_for_frames(&frameset))
+                        plyconverter->convert(frameset);
+                }
             });
 
         }
 
-        //we need to clear the output of ply progress ("100%") before writing
-        //the progress of the other converters in the same line
-        cout << "\r    \r";
-
         while (true)
         {
             int posP = static_cast<int>(posCurr * 100. / duration.count());
@@ -279,6 +229,14 @@ int main(int argc, char** argv) try
             sensor.stop();
             sensor.close();
         }
+
+        for_each(converters.begin(), converters.end(),
+            [](shared_ptr<rs2::tools::converter::converter_base>& converter) {
+            converter->wait();
+        });
+
+        if (plyconverter)
+            plyconverter->wait();
     }
 
     if( !switchTextOutput.isSet() )
@@ -0,0 +1,178 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "binary-capture.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+
+namespace rs_data_collect
+{
+    namespace
+    {
+        // Past the OS cache: what was synced survives a crash of the machine, too
+        void sync_to_disk(FILE* file)
+        {
+            fflush(file);
+#ifdef _WIN32
+            _commit(_fileno(file));
+#else
+            fsync(fileno(file));
+#endif
+        }
+    }
+
+    binary_writer::binary_writer(const string& filename, const string& configuration,
+        size_t buffer_records, chrono::milliseconds sync_period)
+        : _file(fopen(filename.c_str(), "wb")), _capacity(std::max(buffer_records, size_t(2))), _sync_period(sync_period)
+    {
+        if (!_file)
+            throw runtime_error("Cannot open the requested output file " + filename + ", please check permissions");
+
+        auto const size = uint32_t(configuration.size());
+        if (fwrite(BINARY_SIGNATURE, sizeof(BINARY_SIGNATURE), 1, _file) != 1
+            || fwrite(&size, sizeof(size), 1, _file) != 1
+            || fwrite(configuration.data(), 1, size, _file) != size)
+        {
+            fclose(_file);
+            throw runtime_error("Failed to write to " + filename);
+        }
+
+        _front.reserve(_capacity);
+        _back.reserve(_capacity);
+        _thread = thread([this]() { run(); });
+    }
+
+    binary_writer::~binary_writer()
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    void binary_writer::write(const binary_record& rec)
+    {
+        bool half_full;
+        {
+            lock_guard<mutex> lock(_mutex);
+            if (_front.size() == _capacity)
+            {
+                ++_dropped;
+                return;
+            }
+            _front.push_back(rec);
+            half_full = _front.size() == _capacity / 2;
+        }
+        if (half_full)
+            _cv.notify_one();
+    }
+
+    void binary_writer::close()
+    {
+        {
+            lock_guard<mutex> lock(_mutex);
+            if (!_thread.joinable())
+                return;
+            _closing = true;
+        }
+        _cv.notify_one();
+        _thread.join();
+
+        sync_to_disk(_file);
+        fclose(_file);
+        if (!_error.empty())
+            throw runtime_error(_error);
+    }
+
+    void binary_writer::run()
+    {
+        auto last_sync = chrono::steady_clock::now();
+        unique_lock<mutex> lock(_mutex);
+        while (true)
+        {
+            _cv.wait_until(lock, last_sync + _sync_period,
+                [this]() { return _closing || _front.size() >= _capacity / 2; });
+            bool const closing = _closing;
+            swap(_front, _back);
+            lock.unlock();
+
+            // The buffer just swapped in is empty, with the same capacity: nothing is allocated here
+            if (!_back.empty() && _error.empty())
+            {
+                if (fwrite(_back.data(), sizeof(binary_record), _back.size(), _file) == _back.size())
+                    _written += _back.size();
+                else
+                    _error = "Failed to write the capture: " + string(strerror(errno));
+            }
+            _back.clear();
+
+            auto const now = chrono::steady_clock::now();
+            if (now - last_sync >= _sync_period)
+            {
+                sync_to_disk(_file);
+                last_sync = now;
+            }
+
+            lock.lock();
+            if (closing && _front.empty())
+                break;
+        }
+    }
+
+
+    binary_reader::binary_reader(const string& filename)
+        : _file(fopen(filename.c_str(), "rb"))
+    {
+        if (!_file)
+            throw runtime_error("Cannot open " + filename);
+
+        char signature[sizeof(BINARY_SIGNATURE)];
+        uint32_t size = 0;
+        if (fread(signature, sizeof(signature), 1, _file) != 1
+            || memcmp(signature, BINARY_SIGNATURE, sizeof(signature))
+            || fread(&size, sizeof(size), 1, _file) != 1)
+        {
+            fclose(_file);
+            throw runtime_error(filename + " is not an rs-data-collect binary capture");
+        }
+        _configuration.resize(size);
+        if (size && fread(&_configuration[0], 1, size, _file) != size)
+        {
+            fclose(_file);
+            throw runtime_error(filename + " is truncated");
+        }
+        _first_record = ftell(_file);
+    }
+
+    binary_reader::~binary_reader()
+    {
+        fclose(_file);
+    }
+
+    void binary_reader::rewind()
+    {
+        clearerr(_file);
+        fseek(_file, _first_record, SEEK_SET);
+    }
+
+    bool binary_reader::read(binary_record& rec)
+    {
+        // A partial record at the end, from a capture that was cut short, is ignored
+        return fread(&rec, sizeof(rec), 1, _file) == 1;
+    }
+}
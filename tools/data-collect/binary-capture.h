@@ -0,0 +1,99 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+// Streaming capture for rs-data-collect: rather than keeping every frame record until the end of the run, records
+// are appended to the output file as they arrive, as fixed-size binary records, by a background writer.
+// Memory is bounded by the writer's two buffers, and what was captured before a crash is on disk (up to the last
+// sync). The binary file is converted to the usual csv afterwards (rs-data-collect -r).
+
+#pragma once
+
+#include <librealsense2/rs.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace rs_data_collect
+{
+    // File layout: the signature, the configuration text (its size first), then records until the end of the file
+    const char BINARY_SIGNATURE[8] = { 'R', 'S', 'D', 'C', 'B', 'I', 'N', '1' };
+
+#pragma pack(push, 1)
+    struct binary_record
+    {
+        uint64_t    frame_number;
+        double      timestamp;          // Device-based timestamp. (msec)
+        double      arrival_time;       // Host arrival timestamp, relative to start streaming (msec)
+        double      params[7];          // Motion or pose data, when there is any
+        int32_t     stream_type;        // rs2_stream
+        int32_t     stream_index;
+        int32_t     domain;             // rs2_timestamp_domain
+        uint32_t    reserved;
+    };
+#pragma pack(pop)
+    static_assert(sizeof(binary_record) == 96, "binary capture record layout changed");
+
+    // Appends records to a file from any number of threads, without waiting on the disk: records go into a buffer
+    // that a background thread swaps with its own and writes out when it is half full, or at least every
+    // 'sync_period', at which time the file is also synced. If the disk cannot keep up and the buffer fills, the
+    // records that do not fit are dropped (and counted), so the capture never stalls the sensor callbacks.
+    class binary_writer
+    {
+    public:
+        binary_writer(const std::string& filename, const std::string& configuration,
+            size_t buffer_records = 64 * 1024,
+            std::chrono::milliseconds sync_period = std::chrono::milliseconds(1000));
+        ~binary_writer();
+
+        void write(const binary_record& rec);
+
+        // Writes out whatever is left and closes the file
+        void close();
+
+        uint64_t written() const { return _written; }
+        uint64_t dropped() const { return _dropped; }
+
+    private:
+        void run();
+
+        FILE*                       _file;
+        size_t                      _capacity;
+        std::chrono::milliseconds   _sync_period;
+
+        std::mutex                  _mutex;
+        std::condition_variable     _cv;
+        std::vector<binary_record>  _front;     // being filled, under the mutex
+        std::vector<binary_record>  _back;      // being written out, by the writer thread alone
+        bool                        _closing = false;
+        std::atomic<uint64_t>       _written{ 0 };
+        std::atomic<uint64_t>       _dropped{ 0 };
+        std::string                 _error;
+        std::thread                 _thread;
+    };
+
+    // Reads a binary capture one record at a time
+    class binary_reader
+    {
+    public:
+        explicit binary_reader(const std::string& filename);
+        ~binary_reader();
+
+        const std::string& configuration() const { return _configuration; }
+
+        // Back to the first record, for another pass
+        void rewind();
+        bool read(binary_record& rec);
+
+    private:
+        FILE*       _file;
+        std::string _configuration;
+        long        _first_record;
+    };
+}
@@ -97,17 +97,36 @@ void data_collector::parse_and_configure(ValueArg<string>& config_file)
     }
 }
 
+void data_collector::stream_to_file(const string& out_filename)
+{
+    _writer.reset(new binary_writer(out_filename, configuration()));
+}
+
 void data_collector::save_data_to_file(const string& out_filename)
 {
-    if (!data_collection.size())
+    if (!frames_collected.size())
         throw runtime_error(stringify() << "No data collected, aborting");
 
     // Report amount of frames collected
     std::vector<uint64_t> frames_per_stream;
-    for (const auto& kv : data_collection)
-        frames_per_stream.emplace_back(kv.second.size());
+    for (const auto& kv : frames_collected)
+        frames_per_stream.emplace_back(kv.second);
 
     std::sort(frames_per_stream.begin(), frames_per_stream.end());
+
+    if (_writer)
+    {
+        // The records are already in the file
+        _writer->close();
+        std::cout << "\nData collection accomplished with ["
+            << frames_per_stream.front() << "-" << frames_per_stream.back()
+            << "] frames recorded per stream into " << out_filename
+            << "\nRun rs-data-collect -r " << out_filename << " to convert it to csv" << std::endl;
+        if (_writer->dropped())
+            std::cout << "Warning: " << _writer->dropped() << " records were dropped, as the disk could not keep up" << std::endl;
+        return;
+    }
+
     std::cout << "\nData collection accomplished with ["
         << frames_per_stream.front() << "-" << frames_per_stream.back()
         << "] frames recorded per stream\nSerializing captured results to "
@@ -118,28 +137,80 @@ void data_collector::save_data_to_file(const string& out_filename)
     if (!csv.is_open())
         throw runtime_error(stringify() << "Cannot open the requested output file " << out_filename << ", please check permissions");
 
-    csv << "Configuration:\nStream Type,Stream Name,Format,FPS,Width,Height\n";
-    for (const auto& elem : selected_stream_profiles)
-        csv << get_profile_description(elem);
+    csv << configuration();
 
     for (const auto& elem : data_collection)
     {
-        csv << "\n\nStream Type,Index,F#,HW Timestamp (ms),Host Timestamp(ms)"
-            << (val_in_range(elem.first.first, { RS2_STREAM_GYRO,RS2_STREAM_ACCEL }) ? ",3DOF_x,3DOF_y,3DOF_z" : "")
-            << (val_in_range(elem.first.first, { RS2_STREAM_POSE }) ? ",t_x,t_y,t_z,r_x,r_y,r_z,r_w" : "")
-            << std::endl;
+        csv << stream_header(elem.first.first);
 
         for (auto i = 0; i < elem.second.size(); i++)
             csv << elem.second[i].to_string();
     }
 }
 
+void data_collector::convert_to_csv(const string& binary_filename, const string& out_filename)
+{
+    binary_reader reader(binary_filename);
+
+    // The streams in the capture, in the order save_data_to_file writes them
+    std::map<std::pair<rs2_stream, int>, uint64_t> frames_per_stream;
+    binary_record rec;
+    while (reader.read(rec))
+        ++frames_per_stream[std::make_pair(static_cast<rs2_stream>(rec.stream_type), int(rec.stream_index))];
+
+    if (!frames_per_stream.size())
+        throw runtime_error(stringify() << "No data in " << binary_filename << ", aborting");
+
+    ofstream csv(out_filename);
+    if (!csv.is_open())
+        throw runtime_error(stringify() << "Cannot open the requested output file " << out_filename << ", please check permissions");
+
+    csv << reader.configuration();
+
+    // A pass over the capture per stream, so only one record is in memory at a time
+    for (const auto& elem : frames_per_stream)
+    {
+        csv << stream_header(elem.first.first);
+
+        reader.rewind();
+        while (reader.read(rec))
+        {
+            if (rec.stream_type == elem.first.first && rec.stream_index == elem.first.second)
+                csv << frame_record(rec).to_string();
+        }
+        std::cout << rs2_stream_to_string(elem.first.first) << " " << elem.first.second << ": "
+            << elem.second << " frames" << std::endl;
+    }
+    std::cout << "Converted " << binary_filename << " to " << out_filename << std::endl;
+}
+
+std::string data_collector::configuration() const
+{
+    std::stringstream ss;
+    ss << "Configuration:\nStream Type,Stream Name,Format,FPS,Width,Height\n";
+    for (const auto& elem : selected_stream_profiles)
+        ss << get_profile_description(elem);
+    return ss.str();
+}
+
+std::string data_collector::stream_header(rs2_stream stream)
+{
+    std::stringstream ss;
+    ss << "\n\nStream Type,Index,F#,HW Timestamp (ms),Host Timestamp(ms)"
+        << (val_in_range(stream, { RS2_STREAM_GYRO,RS2_STREAM_ACCEL }) ? ",3DOF_x,3DOF_y,3DOF_z" : "")
+        << (val_in_range(stream, { RS2_STREAM_POSE }) ? ",t_x,t_y,t_z,r_x,r_y,r_z,r_w" : "")
+        << std::endl;
+    return ss.str();
+}
+
 void data_collector::collect_frame_attributes(rs2::frame f, std::chrono::time_point<std::chrono::high_resolution_clock> start_time)
 {
     auto arrival_time = std::chrono::duration<double, std::milli>(chrono::high_resolution_clock::now() - start_time);
     auto stream_uid = std::make_pair(f.get_profile().stream_type(), f.get_profile().stream_index());
 
-    if (data_collection[stream_uid].size() < _max_frames)
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& collected = frames_collected[stream_uid];
+    if (collected < _max_frames)
     {
         frame_record rec{ f.get_frame_number(),
             f.get_timestamp(),
@@ -162,7 +233,11 @@ void data_collector::collect_frame_attributes(rs2::frame f, std::chrono::time_po
                     pose.rotation.x,pose.rotation.y,pose.rotation.z,pose.rotation.w };
         }
 
-        data_collection[stream_uid].emplace_back(rec);
+        ++collected;
+        if (_writer)
+            _writer->write(rec.to_binary());
+        else
+            data_collection[stream_uid].emplace_back(rec);
     }
 }
 
@@ -179,11 +254,13 @@ bool data_collector::collecting(std::chrono::time_point<std::chrono::high_resolu
     }
 
     bool collected_enough_frames = true;
+    std::lock_guard<std::mutex> lock(_mutex);
     for (auto&& profile : selected_stream_profiles)
     {
         auto key = std::make_pair(profile.stream_type(), profile.stream_index());
-        if (!data_collection.size() || (data_collection.find(key) != data_collection.end() &&
-            (data_collection[key].size() && data_collection[key].size() < _max_frames)))
+        auto it = frames_collected.find(key);
+        if (!frames_collected.size() || (it != frames_collected.end() &&
+            (it->second && it->second < _max_frames)))
         {
             collected_enough_frames = false;
             break;
@@ -294,11 +371,15 @@ int main(int argc, char** argv) try
     ValueArg<int>    max_frames("m", "MaxFrames_Number", "Maximum number of frames-per-stream to receive", false, 100, "");
     ValueArg<string> out_file("f", "FullFilePath", "the file where the data will be saved to", false, "", "");
     ValueArg<string> config_file("c", "ConfigurationFile", "Specify file path with the requested configuration", false, "", "");
+    SwitchArg        binary("b", "Binary", "Write the frames data to the file as it arrives, in binary, rather than keep it in memory until the end", false);
+    ValueArg<string> binary_file("r", "ReadBinary", "Convert the given binary file (see -b) to csv, and exit", false, "", "");
 
     cmd.add(timeout);
     cmd.add(max_frames);
     cmd.add(out_file);
     cmd.add(config_file);
+    cmd.add(binary);
+    cmd.add(binary_file);
     cmd.parse(argc, argv);
 
     std::cout << "Running rs-data-collect: ";
@@ -306,7 +387,13 @@ int main(int argc, char** argv) try
         std::cout << argv[i] << " ";
     std::cout << std::endl << std::endl;
 
-    auto output_file       = out_file.isSet() ? out_file.getValue() : DEF_OUTPUT_FILE_NAME;
+    if (binary_file.isSet())
+    {
+        data_collector::convert_to_csv(binary_file.getValue(), out_file.isSet() ? out_file.getValue() : DEF_OUTPUT_FILE_NAME);
+        return EXIT_SUCCESS;
+    }
+
+    auto output_file       = out_file.isSet() ? out_file.getValue() : binary.getValue() ? DEF_BINARY_FILE_NAME : DEF_OUTPUT_FILE_NAME;
 
     {
         ofstream csv(output_file);
@@ -334,6 +421,8 @@ int main(int argc, char** argv) try
         data_collector  dc(dev,timeout,max_frames);         // Parser and the data aggregator
 
         dc.parse_and_configure(config_file);
+        if (binary.getValue())
+            dc.stream_to_file(output_file);
 
         //data_collection buffer;
         auto start_time = chrono::high_resolution_clock::now();
@@ -26,9 +26,12 @@ GYRO,1,1,200,MOTION_XYZ32F
 
 #include <librealsense2/rs.hpp>
 #include "tclap/CmdLine.h"
+#include "binary-capture.h"
 #include <fstream>
 #include <sstream>
 #include <map>
+#include <memory>
+#include <mutex>
 
 
 using namespace std;
@@ -38,6 +41,7 @@ namespace rs_data_collect
 {
     const uint64_t  DEF_FRAMES_NUMBER = 100;
     const std::string DEF_OUTPUT_FILE_NAME("frames_data.csv");
+    const std::string DEF_BINARY_FILE_NAME("frames_data.bin");
 
     // Split string into token,  trim unreadable characters
     inline std::vector<std::string> tokenize(std::string line, char separator)
@@ -183,7 +187,11 @@ namespace rs_data_collect
         data_collector(const data_collector&);
 
         void parse_and_configure(ValueArg<string>& config_file);
+        // Write the frame records to the file as they arrive, rather than keep them for save_data_to_file
+        void stream_to_file(const string& out_filename);
         void save_data_to_file(const string& out_filename);
+        // Convert a file written by stream_to_file into the csv that save_data_to_file writes
+        static void convert_to_csv(const string& binary_filename, const string& out_filename);
         void collect_frame_attributes(rs2::frame f, std::chrono::time_point<std::chrono::high_resolution_clock> start_time);
         bool collecting(std::chrono::time_point<std::chrono::high_resolution_clock> start_time);
 
@@ -204,6 +212,21 @@ namespace rs_data_collect
             _params({_p1,_p2,_p3,_p4,_p5,_p6,_p7})
             {};
 
+            explicit frame_record(const binary_record& rec) :
+                frame_record(rec.frame_number, rec.timestamp, rec.arrival_time,
+                    static_cast<rs2_timestamp_domain>(rec.domain), static_cast<rs2_stream>(rec.stream_type), rec.stream_index)
+            {
+                std::copy(std::begin(rec.params), std::end(rec.params), _params.begin());
+            }
+
+            binary_record to_binary() const
+            {
+                binary_record rec{ _frame_number, _ts, _arrival_time, {},
+                    _stream_type, _stream_idx, _domain, 0 };
+                std::copy(_params.begin(), _params.end(), std::begin(rec.params));
+                return rec;
+            }
+
             std::string to_string() const
             {
                 std::stringstream ss;
@@ -237,7 +260,10 @@ namespace rs_data_collect
     private:
 
         std::shared_ptr<rs2::device>        _dev;
+        std::mutex                          _mutex;             // Frames of different sensors arrive on different threads
         std::map<std::pair<rs2_stream, int>, std::vector<frame_record>> data_collection;
+        std::map<std::pair<rs2_stream, int>, uint64_t> frames_collected;
+        std::unique_ptr<binary_writer>      _writer;            // When streaming to file
         std::vector<stream_request>         requests_to_go, user_requests;
         std::vector<rs2::sensor>            active_sensors;
         std::vector<rs2::stream_profile>    selected_stream_profiles;
@@ -245,6 +271,9 @@ namespace rs_data_collect
         int64_t                             _time_out_sec;
         application_stop                    _stop_cond;
 
+        std::string configuration() const;
+        static std::string stream_header(rs2_stream stream);
+
         bool parse_configuration(const std::string& line, const std::vector<std::string>& tokens,
             rs2_stream& type, int& width, int& height, rs2_format& format, int& fps, int& index);
 
@@ -34,23 +34,47 @@ int main(int argc, char* argv[]) try
     ValueArg<string> out_arg("o", "out", "Full file path of output file", false, "", "Print Fw logs to output file");
     ValueArg<int> polling_interval_arg("p", "polling_interval", "Time Interval between each log messages polling (in milliseconds)", false, default_polling_interval_ms, "");
     SwitchArg flash_logs_arg("f", "flash", "Flash Logs Request", false);
+    SwitchArg raw_arg("r", "raw", "Write the logs raw (binary) to the output file, to be formatted later with --decode", false);
+    ValueArg<string> decode_arg("d", "decode", "Full file path of logs written with --raw, to format with the XML file instead of logging", false, "", "Raw logs file");
     cmd.add(sn_arg);
     cmd.add(xml_arg);
     cmd.add(out_arg);
     cmd.add(polling_interval_arg);
     cmd.add(flash_logs_arg);
+    cmd.add(raw_arg);
+    cmd.add(decode_arg);
     cmd.parse(argc, argv);
 
     log_to_file(RS2_LOG_SEVERITY_WARN, "librealsense.log");
 
     auto use_xml_file = false;
     auto output_file_path = out_arg.getValue();
-    std::ofstream output_file(output_file_path);
-    // write to file if it is open, else write to console
-    std::ostream& out = (!output_file.is_open() ? std::cout : output_file);
+    bool const raw = raw_arg.isSet();
+    if (raw && output_file_path.empty())
+        throw std::runtime_error("--raw requires an output file");
+    std::ofstream output_file(output_file_path, raw ? std::ios::binary : std::ios::out);
+    // write to file if it is open, else write to console; raw logs go to the file alone
+    std::ostream& out = (!output_file.is_open() || raw ? std::cout : output_file);
 
     auto sn = sn_arg.getValue();
     auto xml_full_file_path = xml_arg.getValue();
+
+    // Formatting raw logs needs no device
+    if (decode_arg.isSet())
+    {
+        ifstream xml_file(xml_full_file_path);
+        if (!xml_file.good())
+            throw std::runtime_error("--decode requires the XML file");
+        std::string xml_content((std::istreambuf_iterator<char>(xml_file)), std::istreambuf_iterator<char>());
+        ifstream raw_file(decode_arg.getValue(), std::ios::binary);
+        if (!raw_file.good())
+            throw std::runtime_error("cannot open " + decode_arg.getValue());
+        std::vector<uint8_t> raw_logs((std::istreambuf_iterator<char>(raw_file)), std::istreambuf_iterator<char>());
+
+        firmware_log_parser parser(xml_content);
+        out << parser.parse(raw_logs);
+        return EXIT_SUCCESS;
+    }
     auto polling_interval_ms = polling_interval_arg.getValue();
     if (polling_interval_ms < 25 || polling_interval_ms > 300)
     {
@@ -101,7 +125,7 @@ int main(int argc, char* argv[]) try
             auto fw_log_device = dev.as<rs2::firmware_logger>();
 
             bool using_parser = false;
-            if (!xml_full_file_path.empty())
+            if (!xml_full_file_path.empty() && !raw)
             {
                 ifstream f(xml_full_file_path);
                 if (f.good())
@@ -133,7 +157,12 @@ int main(int argc, char* argv[]) try
                 {
                     result = fw_log_device.get_firmware_log(log_message);
                 }
-                if (result)
+                if (result && raw)
+                {
+                    auto data = log_message.data();
+                    output_file.write(reinterpret_cast<const char*>(data.data()), data.size());
+                }
+                else if (result)
                 {
                     std::vector<string> fw_log_lines;
                     if (using_parser)
@@ -0,0 +1,319 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+//#cmake:add-file ../../../src/proc/simd-isa.cpp
+//#cmake:add-file ../../../src/proc/depth-kernels.cpp
+//#cmake:add-file ../../../src/proc/depth-kernels-avx2.cpp
+
+#include "../algo-common.h"
+#include <src/proc/depth-kernels.h>
+#include <rsutils/time/stopwatch.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace librealsense::depth_kernels;
+
+
+namespace {
+
+isa const all_isas[] = { isa::scalar, isa::ssse3, isa::avx2, isa::neon };
+
+// Enough for a few whole vectors of every size, plus leftovers
+int const counts[] = { 0, 1, 7, 8, 9, 15, 16, 17, 31, 33, 100, 1000 };
+
+std::mt19937 & rng()
+{
+    static std::mt19937 gen( 1234 );
+    return gen;
+}
+
+// Depth with a good share of holes and of values around the interesting thresholds
+std::vector< uint16_t > random_depth( int count )
+{
+    std::uniform_int_distribution< int > value( 0, 65535 );
+    std::uniform_int_distribution< int > kind( 0, 3 );
+    std::vector< uint16_t > v( count );
+    for( auto & d : v )
+    {
+        switch( kind( rng() ) )
+        {
+        case 0: d = 0; break;
+        case 1: d = uint16_t( value( rng() ) % 2000 ); break;
+        default: d = uint16_t( value( rng() ) ); break;
+        }
+    }
+    return v;
+}
+
+// Compares the raw bytes, so floats are bit-exact (and NaNs are not an issue)
+template< class T >
+bool same_bits( std::vector< T > const & a, std::vector< T > const & b )
+{
+    return a.size() == b.size() && ! std::memcmp( a.data(), b.data(), a.size() * sizeof( T ) );
+}
+
+// Runs 'kernel' for every supported isa and checks its output is the same as the scalar one's
+template< class T, class F >
+void check_conformance( F kernel )
+{
+    for( int count : counts )
+    {
+        std::vector< T > expected( count );
+        kernel( isa::scalar, expected.data(), count );
+        for( isa which : all_isas )
+        {
+            if( which == isa::scalar || ! is_supported( which ) )
+                continue;
+            CAPTURE( get_string( which ), count );
+            std::vector< T > actual( count );
+            kernel( which, actual.data(), count );
+            CHECK( same_bits( actual, expected ) );
+        }
+    }
+}
+
+}  // namespace
+
+
+TEST_CASE( "threshold", "[depth-kernels]" )
+{
+    auto depth = random_depth( 1000 );
+    check_conformance< uint16_t >( [&]( isa which, uint16_t * out, int count ) {
+        threshold( which, out, depth.data(), count, 0.001f, 0.1f, 1.5f );
+    } );
+
+    // In place
+    std::vector< uint16_t > expected( depth.size() );
+    threshold( isa::scalar, expected.data(), depth.data(), int( depth.size() ), 0.001f, 0.1f, 1.5f );
+    threshold( depth.data(), depth.data(), int( depth.size() ), 0.001f, 0.1f, 1.5f );
+    CHECK( depth == expected );
+}
+
+TEST_CASE( "to_meters", "[depth-kernels]" )
+{
+    auto depth = random_depth( 1000 );
+    check_conformance< float >( [&]( isa which, float * out, int count ) {
+        to_meters( which, out, depth.data(), count, 0.001f );
+    } );
+}
+
+TEST_CASE( "to_disparity and back", "[depth-kernels]" )
+{
+    float const factor = 50.f * 383.f * 32.f / 0.001f;  // baseline [mm] * focal [px] * fractions / units
+
+    auto depth = random_depth( 1000 );
+    check_conformance< float >( [&]( isa which, float * out, int count ) {
+        to_disparity( which, out, depth.data(), count, factor );
+    } );
+
+    // Disparity, including what is not a normal float
+    std::vector< float > disparity( 1000 );
+    to_disparity( disparity.data(), depth.data(), 1000, factor );
+    disparity[1] = 0.f;
+    disparity[2] = -0.f;
+    disparity[3] = FLT_MIN / 2;
+    disparity[4] = std::numeric_limits< float >::infinity();
+    disparity[5] = std::numeric_limits< float >::quiet_NaN();
+    disparity[6] = FLT_MIN;
+    check_conformance< uint16_t >( [&]( isa which, uint16_t * out, int count ) {
+        to_depth( which, out, disparity.data(), count, factor );
+    } );
+}
+
+TEST_CASE( "hdr_merge", "[depth-kernels]" )
+{
+    auto d0 = random_depth( 1000 ), d1 = random_depth( 1000 );
+    check_conformance< uint16_t >( [&]( isa which, uint16_t * out, int count ) {
+        hdr_merge( which, out, d0.data(), d1.data(), count );
+    } );
+
+    std::uniform_int_distribution< int > ir( 0, 1023 );
+    std::vector< uint8_t > y8_0( 1000 ), y8_1( 1000 );
+    std::vector< uint16_t > y16_0( 1000 ), y16_1( 1000 );
+    for( int i = 0; i < 1000; ++i )
+    {
+        y16_0[i] = uint16_t( ir( rng() ) );
+        y16_1[i] = uint16_t( ir( rng() ) );
+        y8_0[i] = uint8_t( y16_0[i] >> 2 );
+        y8_1[i] = uint8_t( y16_1[i] >> 2 );
+    }
+    check_conformance< uint16_t >( [&]( isa which, uint16_t * out, int count ) {
+        hdr_merge( which, out, d0.data(), d1.data(), y8_0.data(), y8_1.data(), count, 5, 250 );
+    } );
+    check_conformance< uint16_t >( [&]( isa which, uint16_t * out, int count ) {
+        hdr_merge( which, out, d0.data(), d1.data(), y16_0.data(), y16_1.data(), count, 20, 1003 );
+    } );
+}
+
+TEST_CASE( "find_hole", "[depth-kernels]" )
+{
+    for( isa which : all_isas )
+    {
+        if( ! is_supported( which ) )
+            continue;
+        CAPTURE( get_string( which ) );
+        for( int count : counts )
+        {
+            std::vector< uint16_t > d( count, 1 );
+            std::vector< uint32_t > f( count, 0x3f800000 );  // 1.f
+            CHECK( find_hole( which, d.data(), count ) == count );
+            CHECK( find_hole( which, f.data(), count ) == count );
+            for( int hole = 0; hole < count; hole += 3 )
+            {
+                d[hole] = 0;
+                f[hole] = 0;
+                CHECK( find_hole( which, d.data(), count ) == hole );
+                CHECK( find_hole( which, f.data(), count ) == hole );
+                d[hole] = 1;
+                f[hole] = 0x80000000;  // -0.f is not a hole
+            }
+        }
+    }
+}
+
+TEST_CASE( "point_moments", "[depth-kernels]" )
+{
+    auto depth = random_depth( 1000 );
+    std::uniform_real_distribution< float > ray( -0.7f, 0.7f );
+    std::vector< float > ray_x( 1000 ), ray_y( 1000 );
+    for( int i = 0; i < 1000; ++i )
+    {
+        ray_x[i] = ray( rng() );
+        ray_y[i] = ray( rng() );
+    }
+
+    for( int count : counts )
+    {
+        double expected[10] = {};
+        point_moments( isa::scalar, expected, depth.data(), ray_x.data(), ray_y.data(), count, 0.001f );
+        CHECK( expected[0] == count - std::count( depth.begin(), depth.begin() + count, uint16_t( 0 ) ) );
+        for( isa which : all_isas )
+        {
+            if( which == isa::scalar || ! is_supported( which ) )
+                continue;
+            CAPTURE( get_string( which ), count );
+            double actual[10] = {};
+            point_moments( which, actual, depth.data(), ray_x.data(), ray_y.data(), count, 0.001f );
+            // Same products, added up in another order
+            for( int k = 0; k < 10; ++k )
+                CHECK( actual[k] == Catch::Approx( expected[k] ).epsilon( 1e-12 ).margin( 1e-9 ) );
+        }
+    }
+}
+
+
+namespace {
+
+// Rays within a D400-like field of view, and the same rotated a little into a sensor 15mm to the side
+struct texture_rays
+{
+    std::vector< float > ray_x, ray_y, to_x, to_y, to_z;
+
+    explicit texture_rays( int count )
+        : ray_x( count ), ray_y( count ), to_x( count ), to_y( count ), to_z( count )
+    {
+        std::uniform_real_distribution< float > ray( -0.7f, 0.7f );
+        float const a = 0.01f;
+        for( int i = 0; i < count; ++i )
+        {
+            ray_x[i] = ray( rng() );
+            ray_y[i] = ray( rng() );
+            to_x[i] = std::cos( a ) * ray_x[i] + std::sin( a );
+            to_y[i] = ray_y[i];
+            to_z[i] = -std::sin( a ) * ray_x[i] + std::cos( a );
+        }
+    }
+
+    texture_mapping mapping( rs2_distortion model ) const
+    {
+        texture_mapping m = { ray_x.data(), ray_y.data(), to_x.data(), to_y.data(), to_z.data(), { 0.015f, 0.f, 0.f },
+                              { 1280, 720, 643.7f, 357.8f, 904.2f, 905.2f, model,
+                                { 0.18f, -0.53f, -0.0014f, 0.00012f, 0.47f } } };
+        return m;
+    }
+};
+
+}  // namespace
+
+
+TEST_CASE( "texture_map", "[depth-kernels]" )
+{
+    auto depth = random_depth( 1000 );
+    texture_rays rays( 1000 );
+    rs2_distortion const models[] = { RS2_DISTORTION_NONE, RS2_DISTORTION_BROWN_CONRADY,
+                                      RS2_DISTORTION_MODIFIED_BROWN_CONRADY, RS2_DISTORTION_INVERSE_BROWN_CONRADY,
+                                      RS2_DISTORTION_FTHETA };
+    for( auto model : models )
+    {
+        auto mapping = rays.mapping( model );
+        for( int count : counts )
+        {
+            std::vector< float > vertices( 3 * count ), texcoords( 2 * count );
+            texture_map( isa::scalar, vertices.data(), texcoords.data(), depth.data(), mapping, count, 0.001f );
+            for( int i = 0; i < count; ++i )
+            {
+                CHECK( vertices[3 * i + 2] == depth[i] * 0.001f );
+                if( ! depth[i] )
+                    CHECK( ( texcoords[2 * i] == 0 && texcoords[2 * i + 1] == 0 ) );
+            }
+            for( isa which : all_isas )
+            {
+                if( which == isa::scalar || ! is_supported( which ) )
+                    continue;
+                CAPTURE( get_string( which ), rs2_distortion_to_string( model ), count );
+                std::vector< float > actual_vertices( 3 * count, -1.f ), actual_texcoords( 2 * count, -1.f );
+                texture_map( which, actual_vertices.data(), actual_texcoords.data(), depth.data(), mapping, count, 0.001f );
+                CHECK( same_bits( actual_vertices, vertices ) );
+                // The distortion polynomial is evaluated in another order
+                for( int i = 0; i < 2 * count; ++i )
+                    CHECK( actual_texcoords[i] == Catch::Approx( texcoords[i] ).margin( 1e-5 ) );
+            }
+        }
+    }
+}
+
+TEST_CASE( "depth kernel timing", "[depth-kernels][.benchmark]" )
+{
+    int const count = 1280 * 720;
+    int const repeat = 100;
+    auto depth = random_depth( count ), d1 = random_depth( count );
+    std::vector< uint16_t > out16( count );
+    std::vector< float > out32( count );
+    std::vector< uint16_t > no_holes( count, 1 );
+    texture_rays rays( count );
+    std::vector< float > vertices( 3 * count ), texcoords( 2 * count );
+
+    for( isa which : all_isas )
+    {
+        if( ! is_supported( which ) )
+            continue;
+        auto time = [&]( char const * name, std::function< void() > kernel ) {
+            rsutils::time::stopwatch sw;
+            for( int i = 0; i < repeat; ++i )
+                kernel();
+            std::cout << get_string( which ) << ' ' << name << ": " << sw.get_elapsed_ms() / repeat << " ms" << std::endl;
+        };
+        time( "threshold", [&]() { threshold( which, out16.data(), depth.data(), count, 0.001f, 0.1f, 1.5f ); } );
+        time( "to_meters", [&]() { to_meters( which, out32.data(), depth.data(), count, 0.001f ); } );
+        time( "to_disparity", [&]() { to_disparity( which, out32.data(), depth.data(), count, 1e6f ); } );
+        time( "to_depth", [&]() { to_depth( which, out16.data(), out32.data(), count, 1e6f ); } );
+        time( "hdr_merge", [&]() { hdr_merge( which, out16.data(), depth.data(), d1.data(), count ); } );
+        time( "find_hole", [&]() { find_hole( which, no_holes.data(), count ); } );
+        time( "point_moments", [&]() {
+            double sums[10] = {};
+            point_moments( which, sums, depth.data(), out32.data(), out32.data(), count, 0.001f );
+        } );
+        time( "texture_map", [&]() {
+            texture_map( which, vertices.data(), texcoords.data(), depth.data(),
+                         rays.mapping( RS2_DISTORTION_INVERSE_BROWN_CONRADY ), count, 0.001f );
+        } );
+    }
+}
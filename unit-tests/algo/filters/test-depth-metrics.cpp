@@ -0,0 +1,113 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/depth-metrics.h>
+
+#include <cmath>
+#include <vector>
+
+using librealsense::plane_metrics;
+
+
+namespace {
+
+int const width = 640, height = 480;
+float const units = 0.001f;
+
+rs2_intrinsics intrinsics()
+{
+    rs2_intrinsics intrin = { width, height, 320.f, 240.f, 380.f, 380.f, RS2_DISTORTION_NONE, { 0 } };
+    return intrin;
+}
+
+// A wall 1m away, turned by 'degrees' around the vertical axis
+std::vector< uint16_t > wall( float degrees )
+{
+    float const angle = degrees / 180.f * 3.14159265f;
+    std::vector< uint16_t > depth( width * height );
+    for( int y = 0; y < height; ++y )
+        for( int x = 0; x < width; ++x )
+        {
+            float const ray_x = ( x - 320.f ) / 380.f;
+            float const z = 1.f / ( std::sin( angle ) * ray_x + std::cos( angle ) );
+            depth[y * width + x] = uint16_t( z / units + 0.5f );
+        }
+    return depth;
+}
+
+rs2_depth_metrics measure( plane_metrics & pm, std::vector< uint16_t > const & depth, float baseline_mm = 0.f,
+                           float ground_truth_mm = 0.f )
+{
+    rs2_depth_metrics m = {};
+    pm.measure( m, depth.data(), width, units, baseline_mm, ground_truth_mm );
+    return m;
+}
+
+}  // namespace
+
+
+TEST_CASE( "flat wall", "[depth-metrics]" )
+{
+    plane_metrics pm;
+    pm.set_geometry( intrinsics(), { 192, 144, 448, 336 } );
+
+    auto m = measure( pm, wall( 0 ), 0.f, 1000.f );
+    CHECK( m.fill_rate == Catch::Approx( 100 ) );
+    REQUIRE( m.plane_fit );
+    CHECK( m.distance_mm == Catch::Approx( 1000 ).margin( 0.01 ) );
+    CHECK( m.angle == Catch::Approx( 0 ).margin( 0.1 ) );
+    CHECK( m.plane_fit_rms_mm == Catch::Approx( 0 ).margin( 0.01 ) );
+    CHECK( m.subpixel_rms == 0 );  // no baseline
+    CHECK( m.z_accuracy == Catch::Approx( 0 ).margin( 0.01 ) );
+
+    // Depth that is on the wall, or 2mm off it to either side, with half the pixels missing
+    auto depth = wall( 0 );
+    for( size_t i = 0; i < depth.size(); ++i )
+        depth[i] = ( i % 2 ) ? 0 : uint16_t( 998 + ( i / 2 ) % 3 * 2 );
+    m = measure( pm, depth, 50.f, 990.f );
+    CHECK( m.fill_rate == Catch::Approx( 50 ) );
+    REQUIRE( m.plane_fit );
+    CHECK( m.distance_mm == Catch::Approx( 1000 ).margin( 0.1 ) );
+    CHECK( m.plane_fit_rms_mm == Catch::Approx( std::sqrt( 8 / 3. ) ).epsilon( 0.01 ) );
+    CHECK( m.plane_fit_rms == Catch::Approx( std::sqrt( 8 / 3. ) / 10 ).epsilon( 0.01 ) );
+    CHECK( m.subpixel_rms > 0.025f );  // baseline * focal * units / distance: .038 pixels for 2mm, at 1m
+    CHECK( m.subpixel_rms < 0.032f );
+    CHECK( m.z_accuracy == Catch::Approx( 100. * 10 / 990 ).epsilon( 0.01 ) );
+}
+
+
+TEST_CASE( "tilted wall", "[depth-metrics]" )
+{
+    plane_metrics pm;
+    pm.set_geometry( intrinsics(), { 192, 144, 448, 336 } );
+
+    auto m = measure( pm, wall( 20 ) );
+    REQUIRE( m.plane_fit );
+    CHECK( m.angle == Catch::Approx( 20 ).margin( 0.1 ) );
+    CHECK( m.distance_mm == Catch::Approx( 1000 ).margin( 1 ) );
+    CHECK( m.plane_fit_rms_mm < 0.5f );  // what's left of the quantization to mm
+}
+
+
+TEST_CASE( "no plane", "[depth-metrics]" )
+{
+    plane_metrics pm;
+    pm.set_geometry( intrinsics(), { 600, 400, 1000, 1000 } );  // clipped to the frame
+    CHECK( pm.get_roi().max_x == width );
+    CHECK( pm.get_roi().max_y == height );
+
+    std::vector< uint16_t > depth( width * height, 0 );
+    auto m = measure( pm, depth );
+    CHECK( m.fill_rate == 0 );
+    CHECK( ! m.plane_fit );
+
+    // A single row of points is a line, not a plane
+    for( int x = 600; x < width; ++x )
+        depth[450 * width + x] = 1000;
+    m = measure( pm, depth );
+    CHECK( m.fill_rate > 0 );
+    CHECK( ! m.plane_fit );
+}
@@ -0,0 +1,98 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+//#cmake:add-file ../../../src/proc/simd-isa.cpp
+//#cmake:add-file ../../../src/proc/interleaved-split.cpp
+//#cmake:add-file ../../../src/proc/interleaved-split-avx2.cpp
+
+#include "../algo-common.h"
+#include <src/proc/interleaved-split.h>
+
+#include <random>
+#include <vector>
+
+using namespace librealsense::interleaved;
+
+
+namespace {
+
+typedef void ( *split_fn )( isa, uint8_t * const[], const uint8_t *, int );
+
+// Every supported implementation must match the scalar one, byte for byte, including the
+// leftovers that do not fill a whole vector
+void check_against_scalar( split_fn split, int in_bpp, int out_bpp )
+{
+    std::mt19937 rng( 1234 );
+    std::uniform_int_distribution< int > byte( 0, 255 );
+
+    for( isa which : { isa::ssse3, isa::avx2, isa::neon } )
+    {
+        if( ! is_supported( which ) )
+            continue;
+        for( int count : { 0, 1, 7, 15, 16, 17, 31, 33, 63, 100, 640 * 3 + 5, 1280 * 720 } )
+        {
+            CAPTURE( int( which ), count );
+            std::vector< uint8_t > source( count * in_bpp );
+            for( auto & b : source )
+                b = uint8_t( byte( rng ) );
+
+            std::vector< uint8_t > expected_l( count * out_bpp ), expected_r( count * out_bpp );
+            uint8_t * const expected[] = { expected_l.data(), expected_r.data() };
+            split( isa::scalar, expected, source.data(), count );
+
+            // One extra byte to catch writing past the end
+            std::vector< uint8_t > actual_l( count * out_bpp + 1, 0xAB ), actual_r( count * out_bpp + 1, 0xCD );
+            uint8_t * const actual[] = { actual_l.data(), actual_r.data() };
+            split( which, actual, source.data(), count );
+
+            CHECK( actual_l.back() == 0xAB );
+            CHECK( actual_r.back() == 0xCD );
+            actual_l.pop_back();
+            actual_r.pop_back();
+            CHECK( actual_l == expected_l );
+            CHECK( actual_r == expected_r );
+        }
+    }
+}
+
+}  // namespace
+
+
+TEST_CASE( "Y8I split", "[interleaved]" )
+{
+    // Y8I is left then right
+    uint8_t const source[] = { 1, 2, 3, 4, 5, 6 };
+    uint8_t l[3], r[3];
+    uint8_t * const dest[] = { l, r };
+    split_y8i( isa::scalar, dest, source, 3 );
+    CHECK( l[0] == 1 );
+    CHECK( l[2] == 5 );
+    CHECK( r[0] == 2 );
+    CHECK( r[2] == 6 );
+
+    check_against_scalar( split_y8i, 2, 1 );
+}
+
+TEST_CASE( "Y12I split", "[interleaved]" )
+{
+    // Right is the lower 12 bits, left the upper; both are expanded to 16
+    uint8_t const source[] = { 0xFF, 0x03, 0x00 };
+    uint16_t l, r;
+    uint8_t * const dest[] = { reinterpret_cast< uint8_t * >( &l ), reinterpret_cast< uint8_t * >( &r ) };
+    split_y12i( isa::scalar, dest, source, 1 );
+    CHECK( r == uint16_t( 0x3FF << 6 | 0x3FF >> 4 ) );
+    CHECK( l == 0 );
+
+    check_against_scalar( split_y12i, 3, 2 );
+}
+
+TEST_CASE( "Y12I MIPI split", "[interleaved]" )
+{
+    check_against_scalar( split_y12i_mipi, 4, 2 );
+}
+
+TEST_CASE( "Y16I split", "[interleaved]" )
+{
+    check_against_scalar( split_y16i, 4, 2 );
+}
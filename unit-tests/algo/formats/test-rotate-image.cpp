@@ -0,0 +1,63 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/proc/rotation-transform.h>
+
+#include <random>
+#include <vector>
+
+
+namespace {
+
+// The straightforward, pixel-by-pixel rotation
+template< class T >
+std::vector< T > rotated( std::vector< T > const & in, int width, int height )
+{
+    std::vector< T > out( in.size() );
+    for( int i = 0; i < height; ++i )
+        for( int j = 0; j < width; ++j )
+            out[( width - 1 - j ) * height + ( height - 1 - i )] = in[i * width + j];
+    return out;
+}
+
+template< class T >
+void check_rotation( int width, int height )
+{
+    CAPTURE( sizeof( T ), width, height );
+    std::mt19937 rng( width * 1000 + height );
+    std::uniform_int_distribution< int > value( 0, ( 1 << ( 8 * sizeof( T ) ) ) - 1 );
+    std::vector< T > in( width * height );
+    for( auto & v : in )
+        v = T( value( rng ) );
+
+    std::vector< T > out( in.size() );
+    librealsense::rotate_image( reinterpret_cast< uint8_t * >( out.data() ),
+                                reinterpret_cast< const uint8_t * >( in.data() ),
+                                width, height, int( sizeof( T ) ) );
+    CHECK( out == rotated( in, width, height ) );
+}
+
+}  // namespace
+
+
+TEST_CASE( "rotate 8-bit images", "[rotation]" )
+{
+    // Whole blocks, whole tiles, and edges that fill neither
+    check_rotation< uint8_t >( 16, 16 );
+    check_rotation< uint8_t >( 480, 848 );
+    check_rotation< uint8_t >( 7, 5 );
+    check_rotation< uint8_t >( 130, 67 );
+    check_rotation< uint8_t >( 1, 33 );
+}
+
+TEST_CASE( "rotate 16-bit images", "[rotation]" )
+{
+    check_rotation< uint16_t >( 8, 8 );
+    check_rotation< uint16_t >( 480, 848 );
+    check_rotation< uint16_t >( 7, 5 );
+    check_rotation< uint16_t >( 130, 67 );
+    check_rotation< uint16_t >( 33, 1 );
+}
@@ -0,0 +1,163 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+//#cmake:add-file ../../../src/proc/rvl-codec.cpp
+
+#include "../algo-common.h"
+#include <src/proc/rvl-codec.h>
+#include <src/librealsense-exception.h>
+#include <rsutils/time/stopwatch.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+namespace {
+
+int const width = 848, height = 480;
+
+// A slanted wall at about 1m, with sensor noise, an invalid band (a shadow) to the left of a box in front of it, and
+// scattered pixels with no depth
+std::vector< uint16_t > scene()
+{
+    std::mt19937 rng( 1234 );
+    std::normal_distribution< float > noise( 0.f, 1.5f );
+    std::uniform_int_distribution< int > percent( 0, 99 );
+    std::vector< uint16_t > depth( width * height );
+    for( int y = 0; y < height; ++y )
+        for( int x = 0; x < width; ++x )
+        {
+            float z = 1000.f + 0.4f * x + 0.1f * y;
+            if( x >= 400 && x < 600 && y >= 150 && y < 350 )
+                z = 700.f;
+            bool const invalid = ( x >= 380 && x < 400 && y >= 150 && y < 350 ) || percent( rng ) < 3;
+            depth[y * width + x] = invalid ? 0 : uint16_t( std::lround( z + noise( rng ) ) );
+        }
+    return depth;
+}
+
+std::vector< uint8_t > compress( std::vector< uint16_t > const & depth )
+{
+    std::vector< uint8_t > data( rvl::max_compressed_size( depth.size() ) );
+    data.resize( rvl::compress( depth.data(), depth.size(), data.data() ) );
+    return data;
+}
+
+std::vector< uint16_t > decompress( std::vector< uint8_t > const & data, size_t pixels )
+{
+    std::vector< uint16_t > depth( pixels, 0xBAD );
+    rvl::decompress( data.data(), data.size(), depth.data(), depth.size() );
+    return depth;
+}
+
+}  // namespace
+
+
+TEST_CASE( "round trip", "[rvl]" )
+{
+    std::mt19937 rng( 4321 );
+    std::uniform_int_distribution< int > any( 0, 0xFFFF );
+
+    std::vector< std::vector< uint16_t > > images = { {}, { 0 }, { 1 }, { 0xFFFF }, std::vector< uint16_t >( 1000, 0 ),
+                                                      std::vector< uint16_t >( 1000, 0xFFFF ), scene() };
+    // The largest differences there are, and runs of one
+    std::vector< uint16_t > extremes( 1001 );
+    for( size_t i = 0; i < extremes.size(); ++i )
+        extremes[i] = i % 3 == 0 ? 0 : i % 3 == 1 ? 0xFFFF : 1;
+    images.push_back( extremes );
+    // Noise, which does not compress and is stored raw
+    std::vector< uint16_t > noise( 12345 );
+    for( auto & d : noise )
+        d = uint16_t( any( rng ) );
+    images.push_back( noise );
+
+    for( auto const & depth : images )
+    {
+        CAPTURE( depth.size() );
+        auto data = compress( depth );
+        CHECK( data.size() <= rvl::max_compressed_size( depth.size() ) );
+        CHECK( rvl::decompressed_pixels( data.data(), data.size() ) == depth.size() );
+        CHECK( decompress( data, depth.size() ) == depth );
+    }
+}
+
+
+TEST_CASE( "compression ratio", "[rvl]" )
+{
+    auto depth = scene();
+    auto data = compress( depth );
+    auto const ratio = double( depth.size() * sizeof( uint16_t ) ) / data.size();
+    CAPTURE( ratio );
+    CHECK( ratio > 3 );
+
+    // All zeros is next to nothing
+    std::vector< uint16_t > zeros( width * height, 0 );
+    CHECK( compress( zeros ).size() <= sizeof( rvl::header ) + 8 );
+}
+
+
+TEST_CASE( "corrupt data", "[rvl]" )
+{
+    auto depth = scene();
+    auto data = compress( depth );
+
+    // Wrong size
+    std::vector< uint16_t > out( depth.size() - 1 );
+    CHECK_THROWS_AS( rvl::decompress( data.data(), data.size(), out.data(), out.size() ), invalid_value_exception );
+
+    // Truncated
+    auto truncated = data;
+    truncated.resize( data.size() / 2 );
+    CHECK_THROWS_AS( decompress( truncated, depth.size() ), invalid_value_exception );
+    truncated.resize( sizeof( rvl::header ) - 1 );
+    CHECK_THROWS_AS( decompress( truncated, depth.size() ), invalid_value_exception );
+
+    // Not compressed depth
+    auto other = data;
+    other[0] = 'X';
+    CHECK_THROWS_AS( decompress( other, depth.size() ), invalid_value_exception );
+
+    // Garbage code: never out of bounds, either way
+    std::mt19937 rng( 99 );
+    std::uniform_int_distribution< int > byte( 0, 255 );
+    for( int i = 0; i < 100; ++i )
+    {
+        auto garbage = data;
+        for( size_t b = sizeof( rvl::header ); b < garbage.size(); b += 1 + byte( rng ) )
+            garbage[b] = uint8_t( byte( rng ) );
+        try
+        {
+            decompress( garbage, depth.size() );
+        }
+        catch( invalid_value_exception const & )
+        {
+        }
+    }
+}
+
+
+TEST_CASE( "rvl timing", "[rvl][.benchmark]" )
+{
+    auto depth = scene();
+    int const repeat = 100;
+    std::vector< uint8_t > data( rvl::max_compressed_size( depth.size() ) );
+    size_t size = 0;
+
+    rsutils::time::stopwatch sw;
+    for( int i = 0; i < repeat; ++i )
+        size = rvl::compress( depth.data(), depth.size(), data.data() );
+    auto const compress_ms = sw.get_elapsed_ms() / repeat;
+
+    sw.reset();
+    for( int i = 0; i < repeat; ++i )
+        rvl::decompress( data.data(), size, depth.data(), depth.size() );
+    auto const decompress_ms = sw.get_elapsed_ms() / repeat;
+
+    auto const mb = depth.size() * sizeof( uint16_t ) / 1e6;
+    std::cout << "ratio " << mb * 1e6 / size << "; compress: " << compress_ms << " ms, " << mb / compress_ms
+              << " GB/s; decompress: " << decompress_ms << " ms, " << mb / decompress_ms << " GB/s" << std::endl;
+}
@@ -0,0 +1,115 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../algo-common.h"
+#include <src/fw-logs/fw-logs-parser.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace librealsense::fw_logs;
+
+
+namespace {
+
+char const * const xml = R"(<Format>
+  <Event id="1" numberOfArguments="0" format="No parameters {0} here" />
+  <Event id="2" numberOfArguments="3" format="Count {0}, mask {1:x}, temperature {2:f}C" />
+  <Event id="3" numberOfArguments="2" format="Mode {0,Mode} then {1,Mode}, not {0,Unknown} or {3} or {01}" />
+  <File id="5" Name="main.c" />
+  <Thread id="2" Name="Worker" />
+  <Enums>
+    <Enum Name="Mode">
+      <EnumValue Key="0" Value="Idle" />
+      <EnumValue Key="1" Value="Streaming" />
+    </Enum>
+  </Enums>
+</Format>)";
+
+
+std::vector< uint8_t > raw_log( uint32_t event_id, uint32_t p1, uint32_t p2, uint32_t p3, uint32_t timestamp )
+{
+    fw_log_binary log = {};
+    log.dword1.bits.magic_number = 160;
+    log.dword1.bits.thread_id = 2;
+    log.dword1.bits.file_id = 5;
+    log.dword2.bits.event_id = event_id;
+    log.dword2.bits.line_id = 42;
+    log.dword3.p1 = uint16_t( p1 );
+    log.dword3.p2 = uint16_t( p2 );
+    log.dword4.p3 = p3;
+    log.dword5.timestamp = timestamp;
+
+    std::vector< uint8_t > data( BINARY_DATA_SIZE );
+    memcpy( data.data(), &log, BINARY_DATA_SIZE );
+    return data;
+}
+
+uint32_t float_bits( float f )
+{
+    uint32_t bits;
+    memcpy( &bits, &f, sizeof( bits ) );
+    return bits;
+}
+
+std::string parse_one( fw_logs_parser & parser, std::vector< uint8_t > data )
+{
+    fw_logs_binary_data binary{ data };
+    return parser.parse_fw_log( &binary ).get_message();
+}
+
+}  // namespace
+
+
+TEST_CASE( "fw log messages", "[fw-logs]" )
+{
+    fw_logs_parser parser( xml );
+
+    CHECK( parse_one( parser, raw_log( 1, 0, 0, 0, 1 ) ) == "No parameters {0} here" );
+    CHECK( parse_one( parser, raw_log( 2, 12, 0xab, float_bits( 36.5f ), 2 ) ) == "Count 12, mask ab, temperature 36.5C" );
+    CHECK( parse_one( parser, raw_log( 2, 7, 1, 0x7f800000, 3 ) ) == "Count 7, mask 01, temperature 0x7f800000C" );
+    CHECK( parse_one( parser, raw_log( 3, 1, 0, 0, 4 ) ) == "Mode Streaming then Idle, not {0,Unknown} or {3} or {01}" );
+    CHECK( parse_one( parser, raw_log( 3, 1, 9, 0, 4 ) ) == "Mode Streaming then 9, not {0,Unknown} or {3} or {01}" );
+    CHECK( parse_one( parser, raw_log( 99, 1, 2, 3, 5 ) )
+           == "*** Unrecognized Log Id: 99! P1 = 0x01, P2 = 0x02, P3 = 0x03" );
+}
+
+
+TEST_CASE( "fw logs parsed in a batch", "[fw-logs]" )
+{
+    fw_logs_parser single( xml );
+    fw_logs_parser batch( xml );
+
+    std::vector< uint8_t > data;
+    for( uint32_t i = 0; i < 10; ++i )
+    {
+        auto log = raw_log( 1 + i % 4, i, i * 3, float_bits( i * .5f ), 1000 + i * 100 );
+        data.insert( data.end(), log.begin(), log.end() );
+    }
+    data.push_back( 0 );  // a partial log is ignored
+
+    std::vector< fw_log_entry > entries;
+    std::string text;
+    REQUIRE( batch.parse_fw_logs( data.data(), data.size(), entries, text ) == 10 );
+
+    for( size_t i = 0; i < entries.size(); ++i )
+    {
+        fw_logs_binary_data binary{ std::vector< uint8_t >( data.begin() + i * BINARY_DATA_SIZE,
+                                                            data.begin() + ( i + 1 ) * BINARY_DATA_SIZE ) };
+        auto expected = single.parse_fw_log( &binary );
+        auto & entry = entries[i];
+        CHECK( text.substr( entry.message_begin, entry.message_end - entry.message_begin ) == expected.get_message() );
+        CHECK( *entry.file_name == "main.c" );
+        CHECK( *entry.thread_name == "Worker" );
+        CHECK( entry.line == expected.get_line() );
+        CHECK( entry.timestamp == expected._timestamp );
+        CHECK( entry.delta == expected._delta );
+    }
+
+    // Parsing again reuses the same buffers
+    auto capacity = text.capacity();
+    REQUIRE( batch.parse_fw_logs( data.data(), data.size(), entries, text ) == 10 );
+    CHECK( text.capacity() == capacity );
+}
@@ -0,0 +1,78 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+//#cmake:add-file ../../../src/proc/simd-isa.cpp
+//#cmake:add-file ../../../src/proc/motion-kernels.cpp
+
+#include "../algo-common.h"
+#include <src/proc/motion-kernels.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+using namespace librealsense::motion_kernels;
+
+
+namespace {
+
+isa const all_isas[] = { isa::scalar, isa::ssse3, isa::avx2, isa::neon };
+
+// Whole groups of four samples, plus leftovers
+size_t const counts[] = { 0, 1, 3, 4, 5, 8, 11, 100, 401 };
+
+std::vector< float3 > random_samples( size_t count )
+{
+    static std::mt19937 gen( 1234 );
+    std::uniform_real_distribution< float > value( -20.f, 20.f );
+    std::vector< float3 > v( count );
+    for( auto & s : v )
+        s = { value( gen ), value( gen ), value( gen ) };
+    return v;
+}
+
+bool same_bits( std::vector< float3 > const & a, std::vector< float3 > const & b )
+{
+    return a.size() == b.size() && ! std::memcmp( a.data(), b.data(), a.size() * sizeof( float3 ) );
+}
+
+}  // namespace
+
+
+TEST_CASE( "correct is float3x3 * float3 - bias", "[motion-kernels]" )
+{
+    // A typical IMU-to-depth alignment, and a calibration close to identity
+    float3x3 const alignment = { { -1, 0, 0 }, { 0, 1, 0 }, { 0, 0, -1 } };
+    float3x3 const sensitivity = { { 1.0021f, 0.0013f, -0.0042f }, { -0.0007f, 0.9987f, 0.0031f }, { 0.0025f, -0.0019f, 1.0008f } };
+    float3 const bias = { 0.0123f, -0.0456f, 0.0789f };
+
+    for( size_t count : counts )
+    {
+        auto samples = random_samples( count );
+        std::vector< float3 > expected( samples );
+        for( auto & s : expected )
+            s = sensitivity * ( alignment * s ) - bias;
+
+        for( isa which : all_isas )
+        {
+            if( ! is_supported( which ) )
+                continue;
+            CAPTURE( get_string( which ), count );
+            std::vector< float3 > actual( samples );
+            correct( which, actual.data(), count, alignment, float3{ 0, 0, 0 } );
+            correct( which, actual.data(), count, sensitivity, bias );
+            CHECK( same_bits( actual, expected ) );
+        }
+    }
+}
+
+TEST_CASE( "correct leaves what is past count", "[motion-kernels]" )
+{
+    auto samples = random_samples( 8 );
+    std::vector< float3 > actual( samples );
+    correct( actual.data(), 5, float3x3{ { 2, 0, 0 }, { 0, 2, 0 }, { 0, 0, 2 } }, float3{ 1, 1, 1 } );
+    for( size_t i = 5; i < 8; ++i )
+        CHECK( actual[i] == samples[i] );
+}
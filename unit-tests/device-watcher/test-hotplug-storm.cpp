@@ -0,0 +1,286 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../catch.h"
+#include <src/hotplug-device-watcher.h>
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace librealsense;
+using namespace librealsense::platform;
+
+
+namespace {
+
+
+// A backend that only knows the devices that were there when the watcher was created
+class fake_backend : public backend
+{
+public:
+    backend_device_group initial;
+    std::function< void() > on_query_hid;  // e.g., a device arriving while the devices are queried
+
+    std::shared_ptr< uvc_device > create_uvc_device( uvc_device_info ) const override { return nullptr; }
+    std::vector< uvc_device_info > query_uvc_devices() const override { return initial.uvc_devices; }
+    std::shared_ptr< command_transfer > create_usb_device( usb_device_info ) const override { return nullptr; }
+    std::vector< usb_device_info > query_usb_devices() const override { return initial.usb_devices; }
+    std::shared_ptr< hid_device > create_hid_device( hid_device_info ) const override { return nullptr; }
+    std::vector< hid_device_info > query_hid_devices() const override
+    {
+        if( on_query_hid )
+            on_query_hid();
+        return initial.hid_devices;
+    }
+    std::shared_ptr< device_watcher > create_device_watcher() const override { return nullptr; }
+};
+
+
+class fake_hotplug_source : public usb_hotplug_source
+{
+public:
+    bool supported = true;
+    usb_hotplug_callback callback;
+
+    bool start( usb_hotplug_callback cb ) override
+    {
+        if( ! supported )
+            return false;
+        callback = std::move( cb );
+        return true;
+    }
+    void stop() override { callback = nullptr; }
+
+    void plug( std::string const & path )
+    {
+        usb_hotplug_event e;
+        e.arrived = true;
+        e.device_path = path;
+        for( uint8_t mi = 0; mi < 3; ++mi )
+        {
+            usb_device_info info;
+            info.id = info.unique_id = path;
+            info.vid = 0x8086;
+            info.pid = 0x0b07;
+            info.mi = mi;
+            info.cls = mi == 2 ? RS2_USB_CLASS_HID : RS2_USB_CLASS_VIDEO;
+            e.interfaces.push_back( info );
+        }
+        callback( std::move( e ) );
+    }
+
+    void unplug( std::string const & path )
+    {
+        usb_hotplug_event e;
+        e.device_path = path;
+        callback( std::move( e ) );
+    }
+};
+
+
+backend_device_group to_device_group( std::vector< usb_device_info > const & usb_devices )
+{
+    backend_device_group group;
+    group.usb_devices = usb_devices;
+    for( auto & usb : usb_devices )
+    {
+        if( usb.cls == RS2_USB_CLASS_VIDEO )
+        {
+            uvc_device_info uvc;
+            uvc.id = uvc.device_path = uvc.unique_id = usb.id;
+            uvc.vid = usb.vid;
+            uvc.pid = usb.pid;
+            uvc.mi = usb.mi;
+            group.uvc_devices.push_back( uvc );
+        }
+        else if( usb.cls == RS2_USB_CLASS_HID )
+        {
+            hid_device_info hid;
+            hid.id = "accel";
+            hid.device_path = hid.unique_id = usb.id;
+            group.hid_devices.push_back( hid );
+        }
+    }
+    return group;
+}
+
+
+std::string path_of( int i )
+{
+    return "2-1." + std::to_string( i ) + "-" + std::to_string( 10 + i );
+}
+
+
+struct changes
+{
+    std::mutex mutex;
+    int count = 0;
+    backend_device_group last;
+
+    void on_change( backend_device_group const &, backend_device_group const & curr )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        ++count;
+        last = curr;
+    }
+
+    bool wait_for_quiet( int min_count )
+    {
+        // Wait for the first change, and then for the watcher to settle
+        for( int i = 0; i < 100; ++i )
+        {
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                if( count >= min_count )
+                    break;
+            }
+            std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+        }
+        std::this_thread::sleep_for( std::chrono::milliseconds( 5 * HOTPLUG_SETTLE_PERIOD_MS ) );
+        std::lock_guard< std::mutex > lock( mutex );
+        return count >= min_count;
+    }
+};
+
+
+}  // namespace
+
+
+TEST_CASE( "hotplug storm is reported as a single change", "[device-watcher]" )
+{
+    fake_backend backend;
+    auto source = std::make_shared< fake_hotplug_source >();
+
+    // Device 2 is already connected
+    backend.initial = to_device_group( [&] {
+        std::vector< usb_device_info > infos;
+        usb_device_info info;
+        info.id = info.unique_id = path_of( 2 );
+        info.cls = RS2_USB_CLASS_VIDEO;
+        infos.push_back( info );
+        return infos;
+    }() );
+
+    hotplug_device_watcher watcher( &backend, source, to_device_group );
+    changes changes;
+    watcher.start( [&]( backend_device_group old, backend_device_group curr ) { changes.on_change( old, curr ); } );
+    REQUIRE_FALSE( watcher.is_stopped() );
+
+    // Several devices bouncing at the same time, from different threads
+    std::vector< std::thread > threads;
+    for( int i = 0; i < 4; ++i )
+    {
+        threads.emplace_back( [&, i]() {
+            auto path = path_of( i );
+            for( int n = 0; n < 50; ++n )
+            {
+                source->plug( path );
+                source->unplug( path );
+            }
+            // Devices 0 and 1 end up connected; 2 and 3 disconnected
+            if( i < 2 )
+                source->plug( path );
+        } );
+    }
+    for( auto & t : threads )
+        t.join();
+
+    REQUIRE( changes.wait_for_quiet( 1 ) );
+    CHECK( changes.count == 1 );
+    CHECK( watcher.get_changes_count() == 1 );
+
+    auto & curr = changes.last;
+    CHECK( curr.usb_devices.size() == 6 );
+    CHECK( curr.uvc_devices.size() == 4 );
+    CHECK( curr.hid_devices.size() == 2 );
+    for( auto & uvc : curr.uvc_devices )
+        CHECK( ( uvc.device_path == path_of( 0 ) || uvc.device_path == path_of( 1 ) ) );
+
+    watcher.stop();
+    CHECK( watcher.is_stopped() );
+}
+
+
+TEST_CASE( "hotplug with no net change is not reported", "[device-watcher]" )
+{
+    fake_backend backend;
+    auto source = std::make_shared< fake_hotplug_source >();
+    hotplug_device_watcher watcher( &backend, source, to_device_group );
+    changes changes;
+    watcher.start( [&]( backend_device_group old, backend_device_group curr ) { changes.on_change( old, curr ); } );
+
+    for( int n = 0; n < 100; ++n )
+    {
+        source->plug( path_of( 5 ) );
+        source->unplug( path_of( 5 ) );
+    }
+    CHECK_FALSE( changes.wait_for_quiet( 1 ) );
+    CHECK( watcher.get_changes_count() == 0 );
+
+    // A real change after that is still reported
+    source->plug( path_of( 5 ) );
+    REQUIRE( changes.wait_for_quiet( 1 ) );
+    CHECK( changes.last.uvc_devices.size() == 2 );
+}
+
+
+TEST_CASE( "hotplug changes are kept until reported", "[device-watcher]" )
+{
+    fake_backend backend;
+    auto source = std::make_shared< fake_hotplug_source >();
+    hotplug_device_watcher watcher( &backend, source, to_device_group );
+
+    // Nothing to report to
+    watcher.start( device_changed_callback() );
+    source->plug( path_of( 6 ) );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 5 * HOTPLUG_SETTLE_PERIOD_MS ) );
+    CHECK( watcher.get_changes_count() == 0 );
+
+    changes changes;
+    watcher.start( [&]( backend_device_group old, backend_device_group curr ) { changes.on_change( old, curr ); } );
+    REQUIRE( changes.wait_for_quiet( 1 ) );
+    CHECK( changes.count == 1 );
+    CHECK( changes.last.uvc_devices.size() == 2 );
+    watcher.stop();
+}
+
+
+TEST_CASE( "device arriving while the watcher is created is reported", "[device-watcher]" )
+{
+    fake_backend backend;
+    auto source = std::make_shared< fake_hotplug_source >();
+
+    // Arrives after the video and USB devices were queried: only its event can tell of it
+    backend.on_query_hid = [&]()
+    {
+        backend.on_query_hid = nullptr;
+        if( source->callback )
+            source->plug( path_of( 7 ) );
+    };
+    hotplug_device_watcher watcher( &backend, source, to_device_group );
+
+    changes changes;
+    watcher.start( [&]( backend_device_group old, backend_device_group curr ) { changes.on_change( old, curr ); } );
+    REQUIRE( changes.wait_for_quiet( 1 ) );
+    CHECK( changes.last.uvc_devices.size() == 2 );
+    watcher.stop();
+}
+
+
+TEST_CASE( "falls back to polling when hotplug is not available", "[device-watcher]" )
+{
+    fake_backend backend;
+    auto source = std::make_shared< fake_hotplug_source >();
+    source->supported = false;
+
+    hotplug_device_watcher watcher( &backend, source, to_device_group );
+    CHECK_FALSE( source->callback );
+
+    watcher.start( []( backend_device_group, backend_device_group ) {} );
+    CHECK_FALSE( watcher.is_stopped() );
+    watcher.stop();
+    CHECK( watcher.is_stopped() );
+}
@@ -38,6 +38,11 @@ with test.closure( 'save/load preset' ):
     am_dev.load_json( saved_values )
     test.check( am_dev.get_depth_control().textureCountThreshold != 250 )
 
+with test.closure( 'loading the current preset again skips its writes' ):
+    skipped = am_dev.get_skipped_transfers()
+    am_dev.load_json( saved_values )
+    test.check( am_dev.get_skipped_transfers() > skipped )
+
 with test.closure( 'setting color options' ):
     # Using Hue to test if setting visual preset changes color sensor settings.
     # Not all cameras support Hue (e.g. D457) but using common setting like Gain or Exposure is dependant on auto-exposure logic
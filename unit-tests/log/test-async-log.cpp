@@ -0,0 +1,109 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "log-common.h"
+#include <src/async-log.h>
+
+#include <mutex>
+#include <thread>
+
+
+struct collector
+{
+    std::mutex mutex;
+    std::vector< std::string > messages;
+    std::vector< std::string > files;
+
+    // Called from the async log's thread
+    void operator()( rs2_log_severity, rs2::log_message const & msg )
+    {
+        std::lock_guard< std::mutex > lock( mutex );
+        messages.push_back( msg.raw() );
+        files.push_back( msg.filename() );
+    }
+};
+
+
+TEST_CASE( "async log is written, with the statement's file", "[log][async_log]" )
+{
+    rs2::reset_logger();
+    collector c;
+    rs2::log_to_callback( RS2_LOG_SEVERITY_DEBUG, std::ref( c ) );
+
+    std::thread( []() { LOG_DEBUG_ASYNC( "stream ", RS2_STREAM_DEPTH, " number ", 5, " value ", std::fixed, 1.5 ); } ).join();
+    librealsense::async_log::flush();
+
+    std::lock_guard< std::mutex > lock( c.mutex );
+    REQUIRE( c.messages.size() == 1 );
+    CHECK( c.messages[0] == "stream Depth number 5 value 1.500000" );
+    CHECK( c.files[0].find( "test-async-log" ) != std::string::npos );
+    rs2::reset_logger();
+}
+
+
+TEST_CASE( "async log arguments are not evaluated when disabled", "[log][async_log]" )
+{
+    rs2::reset_logger();
+    collector c;
+    rs2::log_to_callback( RS2_LOG_SEVERITY_INFO, std::ref( c ) );
+
+    int n = 0;
+    LOG_DEBUG_ASYNC( "n=", ++n );
+    CHECK( n == 0 );
+    LOG_INFO_ASYNC( "n=", ++n );
+    CHECK( n == 1 );
+    librealsense::async_log::flush();
+
+    std::lock_guard< std::mutex > lock( c.mutex );
+    REQUIRE( c.messages.size() == 1 );
+    CHECK( c.messages[0] == "n=1" );
+    rs2::reset_logger();
+}
+
+
+TEST_CASE( "async log keeps order, and counts what it drops", "[log][async_log]" )
+{
+    rs2::reset_logger();
+    collector c;
+    rs2::log_to_callback( RS2_LOG_SEVERITY_DEBUG, std::ref( c ) );
+
+    int const n_messages = 10000;
+    auto const dropped_before = librealsense::async_log::dropped();
+    std::thread( [&]() {
+        for( int i = 0; i < n_messages; ++i )
+            LOG_DEBUG_ASYNC( i );
+    } ).join();
+    librealsense::async_log::flush();
+    auto const dropped = librealsense::async_log::dropped() - dropped_before;
+
+    std::lock_guard< std::mutex > lock( c.mutex );
+    int n_logged = 0, last = -1;
+    for( auto & msg : c.messages )
+    {
+        if( msg.find( "dropped" ) != std::string::npos )
+            continue;  // the drop warning
+        int i = std::stoi( msg );
+        CHECK( i > last );
+        last = i;
+        ++n_logged;
+    }
+    CHECK( n_logged + dropped == n_messages );
+    rs2::reset_logger();
+}
+
+
+TEST_CASE( "async log captures string literals, not buffers", "[log][async_log]" )
+{
+    using librealsense::async_log::detail::can_capture;
+
+    char buffer[16] = "not a literal";
+    char const * pointer = buffer;
+    CHECK( can_capture< decltype( ( "literal" ) ) >::value );
+    CHECK_FALSE( can_capture< decltype( ( buffer ) ) >::value );
+    CHECK_FALSE( can_capture< decltype( ( pointer ) ) >::value );
+    CHECK_FALSE( can_capture< std::string const & >::value );
+    CHECK( can_capture< int & >::value );
+    CHECK( can_capture< rs2_stream >::value );
+}
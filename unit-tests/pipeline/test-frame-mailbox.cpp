@@ -0,0 +1,119 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+
+#include "../catch.h"
+#include <src/pipeline/aggregator.h>
+#include <src/frame.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace librealsense;
+using namespace librealsense::pipeline;
+
+
+namespace {
+
+
+// A frame that counts how many times it was released, rather than going back to a pool
+class counted_frame : public frame
+{
+public:
+    void release() override { ++releases; }
+
+    std::atomic< int > releases{ 0 };
+};
+
+
+std::chrono::milliseconds since( std::chrono::steady_clock::time_point start )
+{
+    return std::chrono::duration_cast< std::chrono::milliseconds >( std::chrono::steady_clock::now() - start );
+}
+
+
+}  // namespace
+
+
+TEST_CASE( "overwritten frame is released", "[pipeline]" )
+{
+    counted_frame a, b;
+    frame_mailbox mailbox;
+    mailbox.put( frame_holder( &a ) );
+    mailbox.put( frame_holder( &b ) );
+    CHECK( a.releases == 1 );
+    CHECK( b.releases == 0 );
+
+    frame_holder f;
+    REQUIRE( mailbox.take( &f ) );
+    CHECK( f.frame == &b );
+    CHECK( ! mailbox.take( &f ) );
+    f.reset();
+    CHECK( b.releases == 1 );
+    CHECK( a.releases == 1 );
+}
+
+
+TEST_CASE( "wait times out", "[pipeline]" )
+{
+    frame_mailbox mailbox;
+    frame_holder f;
+    auto const start = std::chrono::steady_clock::now();
+    CHECK( ! mailbox.wait( &f, 100 ) );
+    CHECK( since( start ) >= std::chrono::milliseconds( 100 ) );
+    CHECK( ! f );
+}
+
+
+TEST_CASE( "put wakes a waiting consumer", "[pipeline]" )
+{
+    counted_frame a;
+    frame_mailbox mailbox;
+    std::thread producer( [&]()
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+        mailbox.put( frame_holder( &a ) );
+    } );
+
+    frame_holder f;
+    auto const start = std::chrono::steady_clock::now();
+    CHECK( mailbox.wait( &f, 5000 ) );
+    CHECK( since( start ) < std::chrono::milliseconds( 2000 ) );
+    CHECK( f.frame == &a );
+    producer.join();
+    f.reset();
+    CHECK( a.releases == 1 );
+}
+
+
+TEST_CASE( "stop wakes a waiting consumer", "[pipeline]" )
+{
+    counted_frame a, b;
+    frame_mailbox mailbox;
+    mailbox.put( frame_holder( &a ) );
+    frame_holder f;
+    REQUIRE( mailbox.take( &f ) );
+    f.reset();
+
+    std::thread stopper( [&]()
+    {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+        mailbox.stop();
+    } );
+    auto const start = std::chrono::steady_clock::now();
+    CHECK( ! mailbox.wait( &f, 5000 ) );
+    CHECK( since( start ) < std::chrono::milliseconds( 2000 ) );
+    stopper.join();
+
+    // Once stopped, frames are not held
+    mailbox.put( frame_holder( &b ) );
+    CHECK( b.releases == 1 );
+    CHECK( ! mailbox.take( &f ) );
+
+    mailbox.start();
+    mailbox.put( frame_holder( &b ) );
+    CHECK( mailbox.take( &f ) );
+    CHECK( f.frame == &b );
+}
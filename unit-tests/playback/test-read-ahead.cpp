@@ -0,0 +1,192 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake: static!
+//#cmake:add-file ../../src/media/playback/playback_read_ahead.cpp
+
+#include "../test.h"
+#include <src/media/playback/playback_read_ahead.h>
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+
+using namespace librealsense;
+using namespace librealsense::device_serializer;
+
+
+namespace {
+
+// Frames whose pending work takes a random while and records that it was done, up to an end of file
+class fake_reader : public reader
+{
+public:
+    explicit fake_reader( int frames, int throw_at = -1, int pending_from = 0 )
+        : _frames( frames ), _throw_at( throw_at ), _pending_from( pending_from ), _done( new std::atomic< bool >[frames]() )
+    {
+    }
+
+    std::shared_ptr< serialized_data > read_next_data() override
+    {
+        // Reading takes a while too, so the streams changing while a read is under way is likely to be seen
+        _in_read = true;
+        std::this_thread::sleep_for( std::chrono::microseconds( 200 ) );
+        _in_read = false;
+        int const i = _read++;
+        if( i == _throw_at )
+            throw std::runtime_error( "read error" );
+        if( i >= _frames )
+            return std::make_shared< serialized_end_of_file >();
+        auto frame = std::make_shared< serialized_frame >( nanoseconds( i ), stream_identifier{}, nullptr );
+        if( i < _pending_from )
+        {
+            _done[i] = true;
+            return frame;
+        }
+        auto delay = std::chrono::microseconds( std::uniform_int_distribution< int >( 0, 2000 )( _rng ) );
+        frame->pending = [this, i, delay]()
+        {
+            std::this_thread::sleep_for( delay );
+            _done[i] = true;
+        };
+        return frame;
+    }
+
+    int read() const { return _read; }
+    bool done( int i ) const { return _done[i]; }
+    bool changed_while_reading() const { return _changed_while_reading; }
+
+    device_snapshot query_device_description( const nanoseconds & ) override { return {}; }
+    void seek_to_time( const nanoseconds & ) override {}
+    nanoseconds query_duration() const override { return nanoseconds( _frames ); }
+    void reset() override {}
+    void enable_stream( const std::vector< stream_identifier > & ) override { _changed_while_reading |= _in_read; }
+    void disable_stream( const std::vector< stream_identifier > & ) override { _changed_while_reading |= _in_read; }
+    const std::string & get_file_name() const override { return _name; }
+    std::vector< std::shared_ptr< serialized_data > > fetch_last_frames( const nanoseconds & ) override { return {}; }
+
+private:
+    int _frames;
+    int _throw_at;
+    int _pending_from;  // frames before it have no pending work
+    std::atomic< int > _read{ 0 };
+    std::atomic< bool > _in_read{ false };
+    bool _changed_while_reading = false;
+    std::unique_ptr< std::atomic< bool >[] > _done;
+    std::mt19937 _rng{ 42 };
+    std::string _name = "fake";
+};
+
+}  // namespace
+
+
+TEST_CASE( "read ahead keeps the order", "[playback]" )
+{
+    int const frames = 200;
+    auto reader = std::make_shared< fake_reader >( frames );
+    playback_read_ahead read_ahead( reader, 8, 4 );
+
+    for( int i = 0; i < frames; ++i )
+    {
+        auto data = read_ahead.next();
+        REQUIRE( data );
+        auto frame = data->as< serialized_frame >();
+        REQUIRE( frame );
+        CHECK( frame->get_timestamp() == nanoseconds( i ) );
+        CHECK( ! frame->pending );
+        CHECK( reader->done( i ) );
+    }
+    auto eof = read_ahead.next();
+    REQUIRE( eof );
+    CHECK( eof->is< serialized_end_of_file >() );
+    CHECK( ! read_ahead.next() );
+    CHECK( reader->read() == frames + 1 );
+}
+
+
+TEST_CASE( "read ahead is bounded", "[playback]" )
+{
+    auto reader = std::make_shared< fake_reader >( 100 );
+    playback_read_ahead read_ahead( reader, 8, 2 );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+    CHECK( reader->read() == 8 );
+
+    read_ahead.next();
+    std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+    CHECK( reader->read() == 9 );
+}
+
+
+TEST_CASE( "read ahead stops", "[playback]" )
+{
+    auto reader = std::make_shared< fake_reader >( 100 );
+    playback_read_ahead read_ahead( reader, 8, 2 );
+    CHECK( read_ahead.next()->get_timestamp() == nanoseconds( 0 ) );
+    read_ahead.stop();
+
+    // What was read before is still handed out, in order and finished, and the reader is no longer used
+    int const read = reader->read();
+    for( int i = 1; i < read; ++i )
+    {
+        auto data = read_ahead.next();
+        REQUIRE( data );
+        CHECK( data->get_timestamp() == nanoseconds( i ) );
+        CHECK( reader->done( i ) );
+    }
+    CHECK( ! read_ahead.next() );
+    CHECK( reader->read() == read );
+}
+
+
+TEST_CASE( "read ahead errors", "[playback]" )
+{
+    auto reader = std::make_shared< fake_reader >( 100, 5 );
+    playback_read_ahead read_ahead( reader, 8, 2 );
+    for( int i = 0; i < 5; ++i )
+        CHECK( read_ahead.next()->get_timestamp() == nanoseconds( i ) );
+    CHECK_THROWS_AS( read_ahead.next(), std::runtime_error );
+    CHECK( ! read_ahead.next() );
+    CHECK( reader->read() == 6 );
+}
+
+
+TEST_CASE( "read ahead stops for the streams to change", "[playback]" )
+{
+    // As the player does when a sensor is opened or closed while another is playing
+    auto reader = std::make_shared< fake_reader >( 100 );
+    std::unique_ptr< playback_read_ahead > read_ahead( new playback_read_ahead( reader, 8, 2 ) );
+    for( int i = 0; i < 3; ++i )
+        CHECK( read_ahead->next()->get_timestamp() == nanoseconds( i ) );
+    read_ahead->stop();
+    reader->disable_stream( {} );
+    reader->enable_stream( {} );
+    CHECK( ! reader->changed_while_reading() );
+
+    // What was read before the change is played, then reading goes on from where it stopped
+    int const read = reader->read();
+    for( int i = 3; i < read; ++i )
+        CHECK( read_ahead->next()->get_timestamp() == nanoseconds( i ) );
+    CHECK( ! read_ahead->next() );
+    read_ahead.reset( new playback_read_ahead( reader, 8, 2 ) );
+    for( int i = read; i < 100; ++i )
+        CHECK( read_ahead->next()->get_timestamp() == nanoseconds( i ) );
+    CHECK( read_ahead->next()->is< serialized_end_of_file >() );
+}
+
+
+TEST_CASE( "read ahead starts its workers with the first pending work", "[playback]" )
+{
+    auto reader = std::make_shared< fake_reader >( 100, -1, 50 );
+    playback_read_ahead read_ahead( reader, 8, 3 );
+    for( int i = 0; i < 40; ++i )
+        CHECK( read_ahead.next()->get_timestamp() == nanoseconds( i ) );
+    CHECK( read_ahead.workers() == 0 );
+
+    for( int i = 40; i < 100; ++i )
+    {
+        CHECK( read_ahead.next()->get_timestamp() == nanoseconds( i ) );
+        CHECK( reader->done( i ) );
+    }
+    CHECK( read_ahead.workers() == 3 );
+}
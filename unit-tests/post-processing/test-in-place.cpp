@@ -0,0 +1,123 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <vector>
+
+using namespace rs2;
+
+
+namespace {
+
+int const W = 64;
+int const H = 48;
+
+
+// Produces depth frames whose data is owned by the library (and not borrowed from the software
+// device) by passing them through a threshold filter that keeps everything
+class depth_source
+{
+    software_device _dev;
+    software_sensor _sensor;
+    stream_profile _profile;
+    frame_queue _q;
+    threshold_filter _threshold;
+    std::vector< uint16_t > _pixels;
+    int _number = 0;
+
+public:
+    depth_source()
+        : _sensor( _dev.add_sensor( "Depth" ) )
+        , _threshold( 0.f, 16.f )
+        , _pixels( W * H )
+    {
+        rs2_intrinsics intr = { W, H, W / 2.f, H / 2.f, float( W ), float( W ), RS2_DISTORTION_NONE, { 0 } };
+        _profile = _sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, W, H, 30, 2, RS2_FORMAT_Z16, intr } );
+        _sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+        _sensor.open( _profile );
+        _sensor.start( _q );
+        for( int i = 0; i < W * H; ++i )
+            _pixels[i] = uint16_t( 500 + i % 1000 );
+    }
+
+    ~depth_source()
+    {
+        _sensor.stop();
+        _sensor.close();
+    }
+
+    frame next()
+    {
+        ++_number;
+        _sensor.on_video_frame( { _pixels.data(), []( void * ) {}, W * 2, 2, double( _number ),
+                                  RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, _number, _profile, 0.001f } );
+        return _threshold.process( _q.wait_for_frame() );
+    }
+};
+
+
+std::vector< uint16_t > copy_of( frame const & f )
+{
+    auto data = static_cast< uint16_t const * >( f.get_data() );
+    return std::vector< uint16_t >( data, data + W * H );
+}
+
+}  // namespace
+
+
+TEST_CASE( "frames handed over are processed in place", "[post-processing-filters]" )
+{
+    depth_source src;
+
+    temporal_filter temporal;
+    spatial_filter spatial;
+    hole_filling_filter hole_filling;
+    threshold_filter threshold( 0.f, 1.f );
+
+    auto f = src.next();
+    auto data = f.get_data();
+    auto profile = f.get_profile();
+
+    f = temporal.process( std::move( f ) );
+    f = spatial.process( std::move( f ) );
+    f = hole_filling.process( std::move( f ) );
+    f = threshold.process( std::move( f ) );
+
+    CHECK( f.get_data() == data );
+    CHECK( f.is< depth_frame >() );
+    CHECK( f.get_profile().format() == RS2_FORMAT_Z16 );
+    // The profile is that of the last filter's output, not the input's
+    CHECK( f.get_profile().unique_id() != profile.unique_id() );
+
+    auto pixels = static_cast< uint16_t const * >( f.get_data() );
+    for( int i = 0; i < W * H; ++i )
+        if( pixels[i] > 1000 )
+        {
+            FAIL( "pixel " << i << " = " << pixels[i] << " was not thresholded" );
+            break;
+        }
+}
+
+TEST_CASE( "frames referred to elsewhere are not modified", "[post-processing-filters]" )
+{
+    depth_source src;
+
+    threshold_filter threshold( 0.f, 1.f );
+    temporal_filter temporal;
+
+    auto f = src.next();
+    auto before = copy_of( f );
+    auto profile = f.get_profile();
+
+    auto out = threshold.process( f );
+    CHECK( out.get_data() != f.get_data() );
+    CHECK( copy_of( f ) == before );
+    CHECK( f.get_profile() == profile );
+
+    auto out2 = temporal.process( f );
+    CHECK( out2.get_data() != f.get_data() );
+    CHECK( copy_of( f ) == before );
+}
@@ -0,0 +1,89 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+//#cmake:dependencies rsutils
+
+#include <unit-tests/test.h>
+#include <rsutils/concurrency/seqlock.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using rsutils::concurrency::seqlock;
+
+
+namespace {
+
+// Larger than a word, and with a value that can be checked for tearing
+struct sample
+{
+    uint64_t id;
+    double x;
+    double y;
+    bool odd;
+};
+
+sample make_sample( uint64_t id )
+{
+    return { id, double( id ), -double( id ), ( id & 1 ) != 0 };
+}
+
+bool is_consistent( sample const & s )
+{
+    return s.x == double( s.id ) && s.y == -double( s.id ) && s.odd == ( ( s.id & 1 ) != 0 );
+}
+
+}  // namespace
+
+
+TEST_CASE( "seqlock initial value" )
+{
+    seqlock< sample > sl( make_sample( 7 ) );
+    auto s = sl.load();
+    CHECK( s.id == 7 );
+    CHECK( is_consistent( s ) );
+}
+
+TEST_CASE( "seqlock store then load" )
+{
+    seqlock< sample > sl;
+    sl.store( make_sample( 1 ) );
+    sl.store( make_sample( 2 ) );
+    auto s = sl.load();
+    CHECK( s.id == 2 );
+    CHECK( is_consistent( s ) );
+}
+
+TEST_CASE( "seqlock readers never see a torn value" )
+{
+    seqlock< sample > sl( make_sample( 0 ) );
+    std::atomic< bool > done( false );
+    std::atomic< int > torn( 0 );
+    std::atomic< int > went_back( 0 );
+
+    std::vector< std::thread > readers;
+    for( int i = 0; i < 3; ++i )
+        readers.emplace_back( [&]() {
+            uint64_t last = 0;
+            while( ! done )
+            {
+                auto s = sl.load();
+                if( ! is_consistent( s ) )
+                    ++torn;
+                if( s.id < last )
+                    ++went_back;
+                last = s.id;
+            }
+        } );
+
+    for( uint64_t id = 1; id <= 200000; ++id )
+        sl.store( make_sample( id ) );
+    done = true;
+    for( auto & t : readers )
+        t.join();
+
+    CHECK( torn == 0 );
+    CHECK( went_back == 0 );
+    CHECK( sl.load().id == 200000 );
+}
@@ -0,0 +1,53 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+#include <librealsense2/hpp/rs_export.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace rs2;
+
+
+TEST_CASE( "async exporter errors are thrown by flush", "[software-device]" )
+{
+    int const W = 4, H = 2;
+    std::vector< uint16_t > pixels( W * H );
+
+    software_device dev;
+    auto sensor = dev.add_sensor( "Depth" );
+    rs2_intrinsics intr = { W, H, W / 2.f, H / 2.f, float( W ), float( W ), RS2_DISTORTION_NONE, { 0 } };
+    auto profile = sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, W, H, 30, 2, RS2_FORMAT_Z16, intr } );
+    frame_queue q( 10 );
+    sensor.open( profile );
+    sensor.start( q );
+
+    std::vector< int > exported;
+    async_exporter exporter( [&]( frame f )
+    {
+        int const number = int( f.get_frame_number() );
+        if( number == 2 )
+            throw std::runtime_error( "first" );
+        if( number == 3 )
+            throw 3;  // not a std::exception
+        exported.push_back( number );
+    }, 1, 10 );
+
+    for( int i = 1; i <= 4; ++i )
+    {
+        sensor.on_video_frame( { pixels.data(), []( void * ) {}, W * 2, 2, double( i ),
+                                 RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, i, profile.get() } );
+        exporter.process( q.wait_for_frame() );
+    }
+    CHECK_THROWS_WITH( exporter.flush(), "first" );
+    CHECK( exported == std::vector< int >{ 1, 4 } );
+
+    // Once thrown, it is not thrown again
+    CHECK_NOTHROW( exporter.flush() );
+
+    sensor.stop();
+    sensor.close();
+}
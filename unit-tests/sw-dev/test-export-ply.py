@@ -0,0 +1,54 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+import sw
+import os, struct, tempfile
+
+
+with sw.sensor( "Stereo Module" ) as sensor:
+    sensor.add_option( rs.option.depth_units, rs.option_range( 0, 1, 0.000001, 0.001 ), True )
+    sensor.set_option( rs.option.depth_units, 0.001 )
+    depth = sensor.video_stream( "Depth", rs.stream.depth, rs.format.z16 )
+    intr = rs.intrinsics()
+    intr.width = sw.w
+    intr.height = sw.h
+    intr.ppx = sw.w / 2
+    intr.ppy = sw.h / 2
+    intr.fx = intr.fy = sw.w
+    depth._handle.intrinsics = intr
+    sensor.start( depth )
+
+    df = rs.depth_frame( sensor.publish( depth.frame() ))
+    points = rs.pointcloud().calculate( df )
+    filename = os.path.join( tempfile.gettempdir(), 'test-export-ply.ply' )
+    points.export_to_ply( filename, rs.video_frame( rs.frame() ))
+
+    with open( filename, 'rb' ) as f:
+        contents = f.read()
+    os.remove( filename )
+
+    with test.closure( "Header", on_fail=test.ABORT ):
+        header_end = contents.index( b'end_header\n' ) + len( b'end_header\n' )
+        header = contents[:header_end].decode().split( '\n' )
+        test.check_equal( header[1], 'format binary_little_endian 1.0' )
+        # sw.py fills all pixels with the same (valid) depth, so all points are kept and all quads are faces
+        test.check_equal( header[3], f'element vertex {sw.w * sw.h}' )
+        test.check_equal( header[7], f'element face {2 * ( sw.w - 1 ) * ( sw.h - 1 )}' )
+
+    with test.closure( "Body size" ):
+        test.check_equal( len( contents ) - header_end, sw.w * sw.h * 12 + 2 * ( sw.w - 1 ) * ( sw.h - 1 ) * 13 )
+
+    with test.closure( "Vertices and faces" ):
+        # 0x6969 at 1mm units, with y and z flipped
+        x, y, z = struct.unpack_from( '<fff', contents, header_end )
+        test.check_approx_abs( z, -26.985, 0.0001 )
+        n, a, b, c = struct.unpack_from( '<Biii', contents, header_end + sw.w * sw.h * 12 )
+        test.check_equal( n, 3 )
+        test.check_equal( [a, b, c], [0, sw.w + 1, 1] )
+
+
+#
+#############################################################################################
+test.print_results_and_exit()
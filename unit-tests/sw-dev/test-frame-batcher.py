@@ -0,0 +1,97 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import test
+import numpy as np
+
+
+w = 16
+h = 8
+bpp = 2
+
+sd = rs.software_device()
+sensor = sd.add_sensor( "Depth" )
+stream = rs.video_stream()
+stream.type = rs.stream.depth
+stream.uid = 0
+stream.width = w
+stream.height = h
+stream.bpp = bpp
+stream.fmt = rs.format.z16
+stream.fps = 30
+profile = rs.video_stream_profile( sensor.add_video_stream( stream ))
+
+sync = rs.syncer( 100 )
+sensor.open( profile )
+sensor.start( sync )
+
+
+def generate( number ):
+    """
+    Generates a frame whose pixels are all its frame number
+    """
+    f = rs.software_video_frame()
+    f.pixels = np.full( ( h, w ), number, dtype = np.uint16 ).tobytes()
+    f.stride = w * bpp
+    f.bpp = bpp
+    f.frame_number = number
+    f.timestamp = number * 10.
+    f.domain = rs.timestamp_domain.hardware_clock
+    f.profile = profile
+    sensor.on_video_frame( f )
+
+
+batcher = rs.frame_batcher( sync, [rs.stream.depth], batch_size = 3, ring_size = 2 )
+
+
+#############################################################################################
+#
+with test.closure( "Batches land in the ring's arrays" ):
+    for n in ( 1, 2, 3 ):
+        generate( n )
+    ( frames, timestamps, numbers ), = batcher.wait_for_batch()
+    test.check_equal( frames.shape, ( 3, h, w ))
+    test.check_equal( frames.dtype, np.uint16 )
+    test.check_equal( [int( frames[i].min() ) for i in range( 3 )], [1, 2, 3] )
+    test.check_equal( [int( frames[i].max() ) for i in range( 3 )], [1, 2, 3] )
+    test.check_equal( list( timestamps ), [10., 20., 30.] )
+    test.check_equal( list( numbers ), [1, 2, 3] )
+
+with test.closure( "Or in the caller's" ):
+    for n in ( 4, 5, 6 ):
+        generate( n )
+    frames = np.zeros( ( 3, h, w ), dtype = np.uint16 )
+    timestamps = np.zeros( 3 )
+    numbers = np.zeros( 3, dtype = np.uint64 )
+    batcher.fill( [frames], [timestamps], [numbers] )
+    test.check_equal( [int( frames[i].min() ) for i in range( 3 )], [4, 5, 6] )
+    test.check_equal( list( timestamps ), [40., 50., 60.] )
+    test.check_equal( list( numbers ), [4, 5, 6] )
+
+with test.closure( "Arrays of the wrong size are refused" ):
+    generate( 7 )
+    try:
+        batcher.fill( [np.zeros( ( 3, h, w ), dtype = np.uint8 )], timeout_ms = 1000 )
+        test.unreachable()
+    except Exception as e:
+        test.check_exception( e, RuntimeError, "frame size does not match the batch array" )
+
+with test.closure( "Lists are refused rather than converted" ):
+    frames = np.zeros( ( 3, h, w ), dtype = np.uint16 )
+    try:
+        batcher.fill( [frames], [[0., 0., 0.]], timeout_ms = 1000 )
+        test.unreachable()
+    except Exception as e:
+        test.check_exception( e, ValueError, "expecting numpy arrays" )
+    try:
+        batcher.fill( [frames.tolist()], timeout_ms = 1000 )
+        test.unreachable()
+    except Exception as e:
+        test.check_exception( e, ValueError, "expecting numpy arrays" )
+
+sensor.stop()
+sensor.close()
+
+#############################################################################################
+test.print_results_and_exit()
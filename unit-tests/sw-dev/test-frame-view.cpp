@@ -0,0 +1,73 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <vector>
+
+using namespace rs2;
+
+
+TEST_CASE( "frame view matches the per-field accessors", "[software-device]" )
+{
+    int const W = 32, H = 24;
+    std::vector< uint16_t > pixels( W * H, 0x1234 );
+
+    software_device dev;
+    auto sensor = dev.add_sensor( "Depth" );
+    rs2_intrinsics intr = { W, H, W / 2.f, H / 2.f, float( W ), float( W ), RS2_DISTORTION_NONE, { 0 } };
+    auto profile = sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, W, H, 30, 2, RS2_FORMAT_Z16, intr } );
+    sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+    frame_queue q;
+    sensor.open( profile );
+    sensor.start( q );
+
+    sensor.on_video_frame( { pixels.data(), []( void * ) {}, W * 2, 2, 1234.5,
+                             RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME, 7, profile, 0.001f } );
+    auto f = q.wait_for_frame();
+    REQUIRE( f.is< depth_frame >() );
+
+    auto view = f.get_view();
+    CHECK( view.data == f.get_data() );
+    CHECK( view.data_size == f.get_data_size() );  // software frames hold no data of their own, so 0
+    CHECK( view.width == W );
+    CHECK( view.height == H );
+    CHECK( view.stride_in_bytes == W * 2 );
+    CHECK( view.bits_per_pixel == 16 );
+    CHECK( view.format == RS2_FORMAT_Z16 );
+    CHECK( view.stream == RS2_STREAM_DEPTH );
+    CHECK( view.stream_index == 0 );
+    CHECK( view.unique_id == f.get_profile().unique_id() );
+    CHECK( view.profile == f.get_profile().get() );
+    CHECK( view.timestamp == 1234.5 );
+    CHECK( view.timestamp_domain == RS2_TIMESTAMP_DOMAIN_GLOBAL_TIME );
+    CHECK( view.frame_number == 7 );
+    CHECK( view.depth_units == 0.001f );
+
+    auto df = f.as< depth_frame >();
+    CHECK( df.get_width() == W );
+    CHECK( df.get_height() == H );
+    CHECK( df.get_stride_in_bytes() == W * 2 );
+    CHECK( df.get_bits_per_pixel() == 16 );
+    CHECK( df.get_units() == 0.001f );
+
+    // A frameset looks like its first frame, but is not a video frame
+    processing_block bundle( []( frame f, frame_source & src ) {
+        src.frame_ready( src.allocate_composite_frame( { f } ) );
+    } );
+    frame_queue out;
+    bundle.start( out );
+    bundle.invoke( f );
+    auto fs = out.wait_for_frame();
+    REQUIRE( fs.is< frameset >() );
+    auto fs_view = fs.get_view();
+    CHECK( fs_view.data == view.data );
+    CHECK( fs_view.frame_number == 7 );
+    CHECK( fs_view.width == 0 );
+    CHECK( fs_view.depth_units == 0.f );
+
+    sensor.stop();
+    sensor.close();
+}
@@ -0,0 +1,119 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import test
+import time
+
+
+sd = rs.software_device()
+sensor = sd.add_sensor( "Motion" )
+
+
+def add_stream( type, uid ):
+    stream = rs.motion_stream()
+    stream.type = type
+    stream.index = 0
+    stream.uid = uid
+    stream.fps = 200
+    stream.fmt = rs.format.motion_xyz32f
+    return sensor.add_motion_stream( stream ).as_motion_stream_profile()
+
+
+accel = add_stream( rs.stream.accel, 0 )
+gyro = add_stream( rs.stream.gyro, 1 )
+
+batcher = rs.motion_batcher( latency = 50., max_samples = 4, queue_size = 100 )
+sensor.open( [accel, gyro] )
+sensor.start( batcher )
+
+
+def generate( profile, timestamp ):
+    """
+    Generates a sample whose x is its timestamp
+    """
+    f = rs.software_motion_frame()
+    data = rs.vector()
+    data.x = timestamp
+    data.y = 1
+    data.z = 2
+    f.data = data
+    f.timestamp = timestamp
+    f.domain = rs.timestamp_domain.hardware_clock
+    f.frame_number = int( timestamp )
+    f.profile = profile
+    sensor.on_motion_frame( f )
+
+
+def received():
+    """
+    Returns the batches output so far, as [stream, [timestamps]] lists
+    """
+    batches = []
+    while True:
+        f = batcher.poll_for_frame()
+        if not f:
+            return batches
+        test.check( f.is_motion_batch_frame() )
+        b = f.as_motion_batch_frame()
+        timestamps = [b.get_sample_timestamp( i ) for i in range( len( b ))]
+        test.check_equal( timestamps, [b.get_motion_data( i ).x for i in range( b.size() )] )
+        test.check_equal( f.get_timestamp(), timestamps[0] )
+        test.check_equal( f.get_frame_number(), int( timestamps[0] ))
+        batches.append( [f.get_profile().stream_type(), timestamps] )
+
+
+#############################################################################################
+#
+with test.closure( "A batch is released once it spans the latency" ):
+    generate( accel, 100 )
+    generate( accel, 130 )
+    test.check_equal( received(), [] )
+    generate( accel, 150 )
+    test.check_equal( received(), [[rs.stream.accel, [100, 130, 150]]] )
+
+with test.closure( "Each stream is batched separately" ):
+    generate( gyro, 200 )
+    generate( accel, 210 )
+    generate( gyro, 230 )
+    generate( accel, 240 )
+    test.check_equal( received(), [] )
+    generate( gyro, 250 )
+    test.check_equal( received(), [[rs.stream.gyro, [200, 230, 250]]] )
+    generate( accel, 260 )
+    test.check_equal( received(), [[rs.stream.accel, [210, 240, 260]]] )
+
+with test.closure( "Or once it holds max_samples" ):
+    for ts in ( 300, 300.5, 301 ):
+        generate( accel, ts )
+    test.check_equal( received(), [] )
+    generate( accel, 301.5 )
+    test.check_equal( received(), [[rs.stream.accel, [300, 300.5, 301, 301.5]]] )
+
+with test.closure( "Or once it was held for the latency, when no more samples come" ):
+    generate( accel, 400 )
+    generate( gyro, 410 )
+    test.check_equal( received(), [] )
+    time.sleep( 0.2 )
+    test.check_equal( received(), [[rs.stream.accel, [400]], [rs.stream.gyro, [410]]] )
+
+with test.closure( "Batches are corrected with the intrinsics of their stream" ):
+    intrinsics = rs.motion_device_intrinsic()
+    intrinsics.data = [[2, 0, 0, 1], [0, 1, 0, 0], [0, 0, 0.5, 0]]   # x * 2 - 1, z / 2
+    batcher.set_intrinsics( rs.stream.gyro, intrinsics )
+    for ts in ( 500, 501, 502, 503 ):
+        generate( gyro, ts )
+    f = batcher.poll_for_frame()
+    test.check( f and f.is_motion_batch_frame() )
+    b = f.as_motion_batch_frame()
+    test.check_equal( [b.get_motion_data( i ).x for i in range( b.size() )], [999, 1001, 1003, 1005] )
+    test.check_equal( [b.get_motion_data( i ).z for i in range( b.size() )], [1, 1, 1, 1] )
+    for ts in ( 600, 601, 602, 603 ):
+        generate( accel, ts )
+    test.check_equal( received(), [[rs.stream.accel, [600, 601, 602, 603]]] )   # not corrected
+
+sensor.stop()
+sensor.close()
+
+#############################################################################################
+test.print_results_and_exit()
@@ -0,0 +1,76 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+#include "../test.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <vector>
+
+using namespace rs2;
+
+
+// A matcher is created from the device when a stream is first seen, and may take over some, but not all, of the
+// streams of a matcher created before: the streams left to the old one must still be synced by it
+TEST_CASE( "matcher replaced for only some of its streams", "[syncer]" )
+{
+    int const W = 4, H = 2;
+    std::vector< uint16_t > pixels( W * H );  // all streams are 16 bits a pixel
+    rs2_intrinsics intr = { W, H, W / 2.f, H / 2.f, float( W ), float( W ), RS2_DISTORTION_NONE, { 0 } };
+
+    software_device dev;
+    dev.create_matcher( RS2_MATCHER_DLR_C );
+    auto stereo = dev.add_sensor( "Stereo" );
+    auto depth = stereo.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, W, H, 30, 2, RS2_FORMAT_Z16, intr } );
+    stereo.add_video_stream( { RS2_STREAM_INFRARED, 1, 1, W, H, 30, 2, RS2_FORMAT_Y16, intr } );
+    stereo.add_video_stream( { RS2_STREAM_INFRARED, 2, 2, W, H, 30, 2, RS2_FORMAT_Y16, intr } );
+    // Not one of the DLR_C streams
+    auto ir3 = stereo.add_video_stream( { RS2_STREAM_INFRARED, 3, 3, W, H, 30, 2, RS2_FORMAT_Y16, intr } );
+
+    syncer sync( 100 );
+    stereo.open( { depth, ir3 } );
+    stereo.start( sync );
+
+    auto send = [&]( software_sensor & sensor, stream_profile const & profile, double timestamp, int number )
+    {
+        sensor.on_video_frame(
+            { pixels.data(), []( void * ) {}, W * 2, 2, timestamp, RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK, number, profile.get() } );
+    };
+
+    // Without color, the device's matcher syncs all four stereo streams by timestamp
+    send( stereo, depth, 0, 1 );
+    send( stereo, ir3, 0, 1 );
+
+    // Once color shows up, the new matcher is DLR + color: it takes over depth, but infrared 3 stays with the first
+    auto rgb = dev.add_sensor( "RGB" );
+    auto color = rgb.add_video_stream( { RS2_STREAM_COLOR, 0, 4, W, H, 30, 2, RS2_FORMAT_YUYV, intr } );
+    rgb.open( color );
+    rgb.start( sync );
+    send( rgb, color, 33, 2 );
+
+    // The frames are drained as we go, so the sensors' frame pools are not exhausted
+    int ir3_frames = 0;
+    frameset fs;
+    auto drain = [&]( unsigned timeout )
+    {
+        while( sync.try_wait_for_frames( &fs, timeout ) )
+        {
+            if( fs.first_or_default( RS2_STREAM_INFRARED ) )
+                ++ir3_frames;
+        }
+    };
+    for( int i = 2; i < 20; ++i )
+    {
+        send( stereo, ir3, 33. * i, i );
+        send( stereo, depth, 33. * i, i );
+        send( rgb, color, 33. * i, i );
+        drain( 10 );
+    }
+    drain( 200 );
+    CHECK( ir3_frames > 15 );
+
+    stereo.stop();
+    rgb.stop();
+    stereo.close();
+    rgb.close();
+}
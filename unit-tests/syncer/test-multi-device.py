@@ -0,0 +1,146 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2024 Intel Corporation. All Rights Reserved.
+
+import pyrealsense2 as rs
+from rspy import log, test
+
+
+w = 64
+h = 48
+bpp = 2
+pixels = bytearray( b'\x00' * ( w * h * bpp ))
+
+syncer = rs.multi_device_syncer( tolerance = 2., device_queue_size = 4, queue_size = 100 )
+
+
+class device:
+    def __init__( self, name, n_streams = 1, target = syncer ):
+        self._dev = rs.software_device()
+        self._sensor = self._dev.add_sensor( name )
+        self._profiles = []
+        for uid in range( n_streams ):
+            stream = rs.video_stream()
+            stream.type = rs.stream.depth if uid == 0 else rs.stream.infrared
+            stream.index = uid
+            stream.uid = uid
+            stream.width = w
+            stream.height = h
+            stream.bpp = bpp
+            stream.fmt = rs.format.z16 if uid == 0 else rs.format.y16
+            stream.fps = 10
+            self._profiles.append( rs.video_stream_profile( self._sensor.add_video_stream( stream )))
+        self._sensor.open( self._profiles )
+        self._sensor.start( target )
+        self._number = 0
+
+    def generate( self, timestamp, stream = 0 ):
+        f = rs.software_video_frame()
+        f.pixels = pixels
+        f.stride = w * bpp
+        f.bpp = bpp
+        if stream == 0:
+            self._number += 1
+        f.frame_number = self._number
+        f.timestamp = timestamp
+        f.domain = rs.timestamp_domain.global_time
+        f.profile = self._profiles[stream]
+        log.d( 'generating', timestamp )
+        self._sensor.on_video_frame( f )
+
+    def stop( self ):
+        self._sensor.stop()
+        self._sensor.close()
+
+
+def received( source = syncer ):
+    """
+    Returns the framesets output so far, as lists of timestamps
+    """
+    framesets = []
+    while True:
+        fs = source.poll_for_frames()
+        if not fs:
+            return framesets
+        framesets.append( sorted( f.get_timestamp() for f in fs ))
+
+
+a = device( 'A' )
+b = device( 'B' )
+c = device( 'C' )
+
+
+#############################################################################################
+#
+with test.closure( "Devices are discovered as their frames arrive" ):
+    a.generate( 0 )
+    test.check_equal( received(), [[0]] )      # nothing to wait for yet
+    b.generate( 0 )
+    c.generate( 0 )
+    test.check_equal( received(), [] )         # waiting for A
+    a.generate( 100 )
+    test.check_equal( received(), [[0, 0]] )   # A moved past 0; still waiting for B and C @100
+
+with test.closure( "One frameset per slot" ):
+    b.generate( 100 )
+    test.check_equal( received(), [] )
+    c.generate( 100 )
+    test.check_equal( received(), [[100, 100, 100]] )
+
+with test.closure( "Frames within the tolerance are matched" ):
+    a.generate( 200 )
+    b.generate( 200.5 )
+    c.generate( 201.9 )
+    test.check_equal( received(), [[200, 200.5, 201.9]] )
+
+with test.closure( "A device that skips a slot does not hold it up" ):
+    a.generate( 300 )
+    c.generate( 300 )
+    test.check_equal( received(), [] )
+    b.generate( 400 )
+    test.check_equal( received(), [[300, 300]] )
+    a.generate( 400 )
+    c.generate( 400 )
+    test.check_equal( received(), [[400, 400, 400]] )
+
+with test.closure( "A stalled device is given up on once the queues fill" ):
+    for ts in ( 500, 600, 700 ):
+        a.generate( ts )
+        b.generate( ts )
+    test.check_equal( received(), [] )
+    a.generate( 800 )   # 4 frames queued for A
+    test.check_equal( received(), [[500, 500], [600, 600], [700, 700]] )
+    b.generate( 800 )   # no longer waiting for C
+    test.check_equal( received(), [[800, 800]] )
+
+with test.closure( "And picked up again when it resumes" ):
+    c.generate( 900 )
+    a.generate( 900 )
+    test.check_equal( received(), [] )
+    b.generate( 900 )
+    test.check_equal( received(), [[900, 900, 900]] )
+
+a.stop()
+b.stop()
+c.stop()
+
+
+#############################################################################################
+#
+with test.closure( "Each stream of a device gets a frame in the slot" ):
+    two_streams = rs.multi_device_syncer( tolerance = 2., device_queue_size = 4, queue_size = 100 )
+    d = device( 'D', n_streams = 2, target = two_streams )
+    e = device( 'E', target = two_streams )
+    d.generate( 0 )
+    d.generate( 0, stream = 1 )
+    e.generate( 0 )
+    d.generate( 100 )
+    received( two_streams )   # the streams are discovered as they arrive, so 0 is released piecemeal
+    d.generate( 100, stream = 1 )
+    test.check_equal( received( two_streams ), [] )   # waiting for E
+    e.generate( 100 )
+    test.check_equal( received( two_streams ), [[100, 100, 100]] )
+    d.stop()
+    e.stop()
+
+#############################################################################################
+test.print_results_and_exit()
@@ -25,6 +25,7 @@ PYBIND11_MODULE(NAME, m) {
     init_record_playback(m);
     init_context(m);
     init_pipeline(m);
+    init_batch(m);
     init_internal(m); // must be run after init_frame()
     init_export(m);
     init_advanced_mode(m);
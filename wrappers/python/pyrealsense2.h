@@ -212,6 +212,7 @@ void init_device(py::module &m);
 void init_record_playback(py::module &m);
 void init_context(py::module &m);
 void init_pipeline(py::module &m);
+void init_batch(py::module &m);
 void init_internal(py::module &m);
 void init_export(py::module &m);
 void init_advanced_mode(py::module &m);
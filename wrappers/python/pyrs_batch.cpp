@@ -0,0 +1,288 @@
+/* License: Apache 2.0. See LICENSE file in root directory.
+Copyright(c) 2024 Intel Corporation. All Rights Reserved. */
+
+#include "pyrealsense2.h"
+#include <librealsense2/rs.hpp>
+#include <pybind11/numpy.h>
+
+#include <cstring>
+#include <functional>
+#include <string>
+
+
+namespace {
+
+
+    // Collects batches of framesets straight into numpy arrays, one array per stream, with the GIL released
+    // while waiting and copying: each frame is copied once, from the frame into its slot in the batch, and
+    // released right away. The arrays are either the caller's, or from a ring of arrays reused batch after batch.
+    class frame_batcher
+    {
+    public:
+        using waiter = std::function< bool( rs2::frameset *, unsigned int ) >;
+
+        frame_batcher( waiter wait, std::vector< rs2_stream > streams, size_t batch_size, size_t ring_size )
+            : _wait( std::move( wait ) )
+            , _streams( std::move( streams ) )
+            , _batch_size( batch_size )
+            , _ring( std::max( ring_size, size_t( 1 ) ) )
+        {
+            if( _streams.empty() )
+                throw std::invalid_argument( "no streams to batch" );
+            if( ! _batch_size )
+                throw std::invalid_argument( "batch size must be positive" );
+        }
+
+        // One (frames, timestamps, frame_numbers) tuple per stream, in the ring's next arrays: they are valid
+        // until the ring comes back around to them, ring_size batches later
+        py::list wait_for_batch( unsigned int timeout_ms )
+        {
+            rs2::frameset first;
+            {
+                py::gil_scoped_release nogil;
+                first = wait_for_complete( timeout_ms );
+            }
+
+            auto & slot = _ring[_next];
+            _next = ( _next + 1 ) % _ring.size();
+            if( slot.size() != _streams.size() )
+                slot.resize( _streams.size() );
+            std::vector< target > targets;
+            for( size_t s = 0; s < _streams.size(); ++s )
+            {
+                auto f = first.first( _streams[s] );
+                auto & arrays = slot[s];
+                auto shape = shape_of( f );
+                auto dtype = dtype_of( f );
+                if( ! arrays.frames.dtype().equal( dtype )
+                    || std::vector< py::ssize_t >( arrays.frames.shape(), arrays.frames.shape() + arrays.frames.ndim() ) != shape )
+                {
+                    arrays.frames = py::array( dtype, shape );
+                    arrays.timestamps = py::array_t< double >( _batch_size );
+                    arrays.frame_numbers = py::array_t< unsigned long long >( _batch_size );
+                }
+                targets.push_back( { static_cast< uint8_t * >( arrays.frames.mutable_data() ),
+                                     size_t( arrays.frames.nbytes() ) / _batch_size,
+                                     arrays.timestamps.mutable_data(),
+                                     arrays.frame_numbers.mutable_data() } );
+            }
+
+            {
+                py::gil_scoped_release nogil;
+                fill( std::move( first ), targets, timeout_ms );
+            }
+
+            py::list result;
+            for( auto & arrays : slot )
+                result.append( py::make_tuple( arrays.frames, arrays.timestamps, arrays.frame_numbers ) );
+            return result;
+        }
+
+        // Fills the caller's arrays, one per stream: C-contiguous, with room for batch_size frames. Timestamps
+        // and frame numbers go into the matching arrays, when given.
+        void fill_arrays( py::list frames, py::object timestamps, py::object frame_numbers, unsigned int timeout_ms )
+        {
+            if( frames.size() != _streams.size() )
+                throw std::invalid_argument( "expecting one array per stream" );
+
+            // The arrays are held until filled: their data is written to without the GIL
+            std::vector< py::array > arrays;
+            std::vector< target > targets( _streams.size() );
+            for( size_t s = 0; s < _streams.size(); ++s )
+            {
+                auto a = as_array( frames[s] );
+                arrays.push_back( a );
+                if( ! ( a.flags() & py::array::c_style ) || ! a.writeable() )
+                    throw std::invalid_argument( "arrays must be writeable and C-contiguous" );
+                if( a.ndim() < 1 || size_t( a.shape( 0 ) ) < _batch_size )
+                    throw std::invalid_argument( "arrays must hold a whole batch" );
+                targets[s].data = static_cast< uint8_t * >( a.mutable_data() );
+                targets[s].frame_bytes = size_t( a.nbytes() ) / size_t( a.shape( 0 ) );
+            }
+            if( ! timestamps.is_none() )
+                for( size_t s = 0; s < _streams.size(); ++s )
+                    targets[s].timestamps = metadata_array< double >( timestamps, s, arrays );
+            if( ! frame_numbers.is_none() )
+                for( size_t s = 0; s < _streams.size(); ++s )
+                    targets[s].frame_numbers = metadata_array< unsigned long long >( frame_numbers, s, arrays );
+
+            py::gil_scoped_release nogil;
+            fill( wait_for_complete( timeout_ms ), targets, timeout_ms );
+        }
+
+    private:
+        struct target
+        {
+            uint8_t * data;
+            size_t frame_bytes;
+            double * timestamps;
+            unsigned long long * frame_numbers;
+        };
+
+        struct stream_arrays
+        {
+            py::array frames;
+            py::array_t< double > timestamps;
+            py::array_t< unsigned long long > frame_numbers;
+        };
+
+        // Only arrays are written to: anything else would be converted to a temporary array, and the caller's
+        // object would never be filled
+        static py::array as_array( py::object obj )
+        {
+            if( ! py::isinstance< py::array >( obj ) )
+                throw std::invalid_argument( "expecting numpy arrays" );
+            return py::reinterpret_borrow< py::array >( obj );
+        }
+
+        // Not cast to array_t, which would convert (copy) an array of another type rather than fail
+        template< class T >
+        T * metadata_array( py::object lists, size_t s, std::vector< py::array > & arrays ) const
+        {
+            auto a = as_array( py::list( lists )[s] );
+            arrays.push_back( a );
+            if( ! a.dtype().equal( py::dtype::of< T >() ) )
+                throw std::invalid_argument( "wrong metadata array type" );
+            if( ! ( a.flags() & py::array::c_style ) || ! a.writeable() || size_t( a.size() ) < _batch_size )
+                throw std::invalid_argument( "metadata arrays must be writeable and hold a whole batch" );
+            return static_cast< T * >( a.mutable_data() );
+        }
+
+        // Framesets that lack any of the streams are skipped, so every slot of the batch has all of them
+        rs2::frameset wait_for_complete( unsigned int timeout_ms )
+        {
+            while( true )
+            {
+                rs2::frameset fs;
+                if( ! _wait( &fs, timeout_ms ) )
+                    throw std::runtime_error( "Frame didn't arrive within " + std::to_string( timeout_ms ) );
+                bool complete = true;
+                for( auto stream : _streams )
+                    complete = complete && fs.first_or_default( stream );
+                if( complete )
+                    return fs;
+            }
+        }
+
+        void fill( rs2::frameset fs, std::vector< target > const & targets, unsigned int timeout_ms )
+        {
+            for( size_t i = 0; i < _batch_size; ++i )
+            {
+                if( i )
+                    fs = wait_for_complete( timeout_ms );
+                for( size_t s = 0; s < _streams.size(); ++s )
+                {
+                    auto f = fs.first( _streams[s] );
+                    auto & t = targets[s];
+                    copy_frame( t.data + i * t.frame_bytes, t.frame_bytes, f );
+                    if( t.timestamps )
+                        t.timestamps[i] = f.get_timestamp();
+                    if( t.frame_numbers )
+                        t.frame_numbers[i] = f.get_frame_number();
+                }
+            }
+        }
+
+        // Video frames are copied without their stride padding
+        static void copy_frame( uint8_t * out, size_t size, rs2::frame const & f )
+        {
+            auto in = static_cast< const uint8_t * >( f.get_data() );
+            if( auto vf = f.as< rs2::video_frame >() )
+            {
+                size_t const row = size_t( vf.get_width() ) * vf.get_bytes_per_pixel();
+                size_t const stride = size_t( vf.get_stride_in_bytes() );
+                if( row * vf.get_height() != size )
+                    throw std::runtime_error( "frame size does not match the batch array" );
+                if( row == stride )
+                    std::memcpy( out, in, size );
+                else
+                    for( int y = 0; y < vf.get_height(); ++y )
+                        std::memcpy( out + y * row, in + y * stride, row );
+            }
+            else
+            {
+                if( size_t( f.get_data_size() ) != size )
+                    throw std::runtime_error( "frame size does not match the batch array" );
+                std::memcpy( out, in, size );
+            }
+        }
+
+        // The same shapes and types as frame.get_data() gives, with the batch as the first dimension
+        std::vector< py::ssize_t > shape_of( rs2::frame const & f ) const
+        {
+            std::vector< py::ssize_t > shape{ py::ssize_t( _batch_size ) };
+            if( auto vf = f.as< rs2::video_frame >() )
+            {
+                shape.push_back( vf.get_height() );
+                shape.push_back( vf.get_width() );
+                switch( vf.get_profile().format() )
+                {
+                case RS2_FORMAT_RGB8: case RS2_FORMAT_BGR8: shape.push_back( 3 ); break;
+                case RS2_FORMAT_RGBA8: case RS2_FORMAT_BGRA8: shape.push_back( 4 ); break;
+                default: break;
+                }
+            }
+            else
+                shape.push_back( f.get_data_size() );
+            return shape;
+        }
+
+        static py::dtype dtype_of( rs2::frame const & f )
+        {
+            if( auto vf = f.as< rs2::video_frame >() )
+            {
+                switch( vf.get_profile().format() )
+                {
+                case RS2_FORMAT_RGB8: case RS2_FORMAT_BGR8: case RS2_FORMAT_RGBA8: case RS2_FORMAT_BGRA8:
+                    break;
+                default:
+                    switch( vf.get_bytes_per_pixel() )
+                    {
+                    case 2: return py::dtype::of< uint16_t >();
+                    case 4: return py::dtype::of< uint32_t >();
+                    default: break;
+                    }
+                }
+            }
+            return py::dtype::of< uint8_t >();
+        }
+
+        waiter _wait;
+        std::vector< rs2_stream > _streams;
+        size_t _batch_size;
+        std::vector< std::vector< stream_arrays > > _ring;
+        size_t _next = 0;
+    };
+
+
+}
+
+
+void init_batch(py::module &m) {
+    py::class_< frame_batcher > frame_batcher_py( m, "frame_batcher",
+        "Collects batches of framesets into numpy arrays, one per stream, without going through Python for each frame.\n"
+        "Framesets that lack any of the streams are skipped. Frames are copied into the batch with the GIL released." );
+    frame_batcher_py
+        .def( py::init( []( rs2::pipeline pipe, std::vector< rs2_stream > streams, size_t batch_size, size_t ring_size ) {
+                  return frame_batcher( [pipe]( rs2::frameset * fs, unsigned int timeout_ms ) { return pipe.try_wait_for_frames( fs, timeout_ms ); },
+                                        std::move( streams ), batch_size, ring_size );
+              } ),
+              "Batches the framesets of a started pipeline", "pipeline"_a, "streams"_a, "batch_size"_a, "ring_size"_a = 2 )
+        .def( py::init( []( rs2::frame_queue queue, std::vector< rs2_stream > streams, size_t batch_size, size_t ring_size ) {
+                  return frame_batcher( [queue]( rs2::frameset * fs, unsigned int timeout_ms ) { return queue.try_wait_for_frame( fs, timeout_ms ); },
+                                        std::move( streams ), batch_size, ring_size );
+              } ),
+              "Batches the framesets arriving in a frame queue", "queue"_a, "streams"_a, "batch_size"_a, "ring_size"_a = 2 )
+        .def( py::init( []( rs2::syncer sync, std::vector< rs2_stream > streams, size_t batch_size, size_t ring_size ) {
+                  return frame_batcher( [sync]( rs2::frameset * fs, unsigned int timeout_ms ) { return sync.try_wait_for_frames( fs, timeout_ms ); },
+                                        std::move( streams ), batch_size, ring_size );
+              } ),
+              "Batches the framesets of a syncer", "syncer"_a, "streams"_a, "batch_size"_a, "ring_size"_a = 2 )
+        .def( "wait_for_batch", &frame_batcher::wait_for_batch,
+              "Wait for the next batch_size framesets, and return one (frames, timestamps, frame_numbers) tuple of arrays per stream.\n"
+              "The arrays are reused: they are valid until ring_size more batches have been read.", "timeout_ms"_a = 5000 )
+        .def( "fill", &frame_batcher::fill_arrays,
+              "Wait for the next batch_size framesets, and copy them into the given arrays (one per stream, C-contiguous, with the batch as\n"
+              "the first dimension). Timestamps and frame numbers, if given arrays for them, are written as well.",
+              "frames"_a, "timestamps"_a = py::none(), "frame_numbers"_a = py::none(), "timeout_ms"_a = 5000 );
+}
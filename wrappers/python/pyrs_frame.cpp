@@ -135,6 +135,7 @@ void init_frame(py::module &m) {
         .def("__nonzero__", &rs2::frame::operator bool, "check if internal frame handle is valid") // Called to implement truth value testing in Python 2
         .def("__bool__", &rs2::frame::operator bool, "check if internal frame handle is valid") // Called to implement truth value testing in Python 3
         .def("get_timestamp", &rs2::frame::get_timestamp, "Retrieve the time at which the frame was captured")
+        .def("get_age", &rs2::frame::get_age, "Retrieve how long ago, in milliseconds, the frame (or the oldest frame of a frameset) arrived at the host")
         .def_property_readonly("timestamp", &rs2::frame::get_timestamp, "Time at which the frame was captured. Identical to calling get_timestamp.")
         .def("get_frame_timestamp_domain", &rs2::frame::get_frame_timestamp_domain, "Retrieve the timestamp domain.")
         .def_property_readonly("frame_timestamp_domain", &rs2::frame::get_frame_timestamp_domain, "The timestamp domain. Identical to calling get_frame_timestamp_domain.")
@@ -154,6 +155,7 @@ void init_frame(py::module &m) {
         .def(BIND_DOWNCAST(frame, video_frame))
         .def(BIND_DOWNCAST(frame, depth_frame))
         .def(BIND_DOWNCAST(frame, motion_frame))
+        .def(BIND_DOWNCAST(frame, motion_batch_frame))
         .def(BIND_DOWNCAST(frame, pose_frame))
         // No apply_filter?
         .def( "__repr__", []( const rs2::frame &self )
@@ -288,6 +290,13 @@ void init_frame(py::module &m) {
         .def("get_motion_data", &rs2::motion_frame::get_motion_data, "Retrieve the motion data from IMU sensor.")
         .def_property_readonly("motion_data", &rs2::motion_frame::get_motion_data, "Motion data from IMU sensor. Identical to calling get_motion_data.");
 
+    py::class_<rs2::motion_batch_frame, rs2::frame> motion_batch_frame(m, "motion_batch_frame", "Extends the frame class with access to each of the motion samples batched in the frame");
+    motion_batch_frame.def(py::init<rs2::frame>())
+        .def("size", &rs2::motion_batch_frame::size, "Number of samples in the batch.")
+        .def("__len__", &rs2::motion_batch_frame::size)
+        .def("get_motion_data", &rs2::motion_batch_frame::get_motion_data, "Retrieve the motion data of one sample.", "index"_a)
+        .def("get_sample_timestamp", &rs2::motion_batch_frame::get_sample_timestamp, "Retrieve the timestamp of one sample.", "index"_a);
+
     py::class_<rs2::pose_frame, rs2::frame> pose_frame(m, "pose_frame", "Extends the frame class with additional pose related attributes and functions.");
     pose_frame.def(py::init<rs2::frame>())
         .def("get_pose_data", &rs2::pose_frame::get_pose_data, "Retrieve the pose data from T2xx position tracking sensor.")
@@ -247,6 +247,11 @@ void init_internal(py::module &m) {
             "xml_content"_a)
         .def("parse_log", &rs2::firmware_logger::parse_log, "Parse Fw Log ", "msg"_a, "parsed_msg"_a);
 
+    // rs2::firmware_log_parser
+    py::class_<rs2::firmware_log_parser> firmware_log_parser(m, "firmware_log_parser");
+    firmware_log_parser.def(py::init<const std::string&>(), "xml_content"_a)
+        .def("parse", &rs2::firmware_log_parser::parse, "Parse raw Fw Logs (concatenated message data) into a line per log", "raw_logs"_a);
+
     // rs2::terminal_parser
     py::class_<rs2::terminal_parser> terminal_parser(m, "terminal_parser");
     terminal_parser.def(py::init<const std::string&>(), "xml_content"_a) 
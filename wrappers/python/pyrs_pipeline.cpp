@@ -68,6 +68,9 @@ void init_pipeline(py::module &m) {
              "This request cannot be used if enable_record_to_file() is called for the current config, and vice versa.", "file_name"_a, "repeat_playback"_a = true)
         .def("enable_record_to_file", &rs2::config::enable_record_to_file, "Requires that the resolved device would be recorded to file.\n"
              "This request cannot be used if enable_device_from_file() is called for the current config, and vice versa as available.", "file_name"_a)
+        .def("enable_latest_frames_only", &rs2::config::enable_latest_frames_only, "Deliver only the latest frames to wait_for_frames and poll_for_frames: "
+             "a frameset that was not retrieved yet is replaced by the next one, so a slow consumer always gets fresh data. "
+             "frame.get_age() tells how old it is.", "enable"_a = true)
         .def("disable_stream", &rs2::config::disable_stream, "Disable a device stream explicitly, to remove any requests on this stream profile.\n"
              "The stream can still be enabled due to pipeline computer vision module request. This call removes any filter on the stream configuration.", "stream"_a, "index"_a = -1)
         .def("disable_all_streams", &rs2::config::disable_all_streams, "Disable all device stream explicitly, to remove any requests on the streams profiles.\n"
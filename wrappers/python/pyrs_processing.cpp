@@ -72,6 +72,9 @@ void init_processing(py::module &m) {
         .def(BIND_DOWNCAST(filter, threshold_filter))
         .def(BIND_DOWNCAST(filter, hdr_merge))
         .def(BIND_DOWNCAST(filter, sequence_id_filter))
+        .def(BIND_DOWNCAST(filter, depth_metrics))
+        .def(BIND_DOWNCAST(filter, depth_encoder))
+        .def(BIND_DOWNCAST(filter, depth_decoder))
         .def("__nonzero__", &rs2::filter::operator bool) // Called to implement truth value testing in Python 2
         .def("__bool__", &rs2::filter::operator bool);   // Called to implement truth value testing in Python 3
         // get_queue?
@@ -93,6 +96,35 @@ void init_processing(py::module &m) {
                                                              "or too small, as a software post-processing step");
     threshold.def(py::init<float, float>(), "min_dist"_a = 0.15f, "max_dist"_a = 4.f);
 
+    py::class_<rs2_depth_metrics> depth_metrics_data(m, "depth_metrics_data", "Depth quality metrics of a frame, of a flat target.");
+    depth_metrics_data.def(py::init<>())
+        .def_readonly("frame_number", &rs2_depth_metrics::frame_number, "The frame the metrics are of")
+        .def_readonly("timestamp", &rs2_depth_metrics::timestamp, "Its timestamp, in milliseconds")
+        .def_readonly("fill_rate", &rs2_depth_metrics::fill_rate, "Percent of the ROI pixels that have depth")
+        .def_property_readonly("plane_fit", [](const rs2_depth_metrics& self) { return self.plane_fit != 0; }, "Whether a plane was fit to the ROI; the metrics below are valid only then")
+        .def_readonly("distance_mm", &rs2_depth_metrics::distance_mm, "Distance from the camera to the plane, along its normal")
+        .def_readonly("angle", &rs2_depth_metrics::angle, "Angle between the plane and the image plane, in degrees")
+        .def_readonly("plane_fit_rms_mm", &rs2_depth_metrics::plane_fit_rms_mm, "RMS of the distances of the points from the plane")
+        .def_readonly("plane_fit_rms", &rs2_depth_metrics::plane_fit_rms, "Same, in percent of the distance")
+        .def_readonly("subpixel_rms", &rs2_depth_metrics::subpixel_rms, "RMS of the disparity errors, in pixels")
+        .def_readonly("z_accuracy", &rs2_depth_metrics::z_accuracy, "Median error relative to the ground truth, in percent");
+
+    py::class_<rs2::depth_metrics, rs2::filter> depth_metrics(m, "depth_metrics", "Measures the depth quality of a flat target on every depth "
+                                                               "frame, as the Depth Quality Tool does, and passes the frame through");
+    depth_metrics.def(py::init<>())
+        .def(py::init<rs2::filter>(), "filter"_a)
+        .def("set_roi", &rs2::depth_metrics::set_roi, "Set the region of interest; by default, the center 40% of the frame", "roi"_a)
+        .def("set_ground_truth", &rs2::depth_metrics::set_ground_truth, "Set the distance of the target in millimeters, for the Z accuracy", "mm"_a)
+        .def("get_metrics", &rs2::depth_metrics::get_metrics, "The metrics of the latest frame processed");
+
+    py::class_<rs2::depth_encoder, rs2::filter> depth_encoder(m, "depth_encoder", "Compresses Z16 depth frames, losslessly, to Z16RVL frames");
+    depth_encoder.def(py::init<>())
+        .def(py::init<rs2::filter>(), "filter"_a);
+
+    py::class_<rs2::depth_decoder, rs2::filter> depth_decoder(m, "depth_decoder", "Decompresses Z16RVL frames back to Z16 depth frames");
+    depth_decoder.def(py::init<>())
+        .def(py::init<rs2::filter>(), "filter"_a);
+
     py::class_<rs2::units_transform, rs2::filter> units_transform(m, "units_transform");
     units_transform.def(py::init<>());
 
@@ -132,6 +164,66 @@ void init_processing(py::module &m) {
               py::call_guard< py::gil_scoped_release >() );
       /*.def("__call__", &rs2::syncer::operator(), "frame"_a)*/
 
+    py::class_<rs2::multi_device_syncer> multi_device_syncer(m, "multi_device_syncer", "Matches frames from several devices into one frameset per time slot");
+    multi_device_syncer.def( py::init< double, bool, int, int >(),
+                             "tolerance"_a = 2.,
+                             "match_frame_counter"_a = false,
+                             "device_queue_size"_a = 4,
+                             "queue_size"_a = 1 )
+        .def( "wait_for_frames",
+              &rs2::multi_device_syncer::wait_for_frames,
+              "Wait until a matched set of frames becomes available",
+              "timeout_ms"_a = 5000,
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "poll_for_frames",
+              []( const rs2::multi_device_syncer & self ) {
+                  rs2::frameset frames;
+                  self.poll_for_frames( &frames );
+                  return frames;
+              },
+              "Check if a matched set of frames is available" )
+        .def( "try_wait_for_frames",
+              []( const rs2::multi_device_syncer & self, unsigned int timeout_ms ) {
+                  rs2::frameset fs;
+                  auto success = self.try_wait_for_frames( &fs, timeout_ms );
+                  return std::make_tuple( success, fs );
+              },
+              "timeout_ms"_a = 5000,
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "__call__", &rs2::multi_device_syncer::operator(), "frame"_a );
+
+    py::class_<rs2::motion_batcher> motion_batcher(m, "motion_batcher", "Collects the samples of each motion stream into motion_batch_frame objects");
+    motion_batcher.def( py::init< double, int, int >(),
+                        "latency"_a = 5.,
+                        "max_samples"_a = 1000,
+                        "queue_size"_a = 16 )
+        .def( "wait_for_frame",
+              &rs2::motion_batcher::wait_for_frame,
+              "Wait until a batch (or another frame) becomes available",
+              "timeout_ms"_a = 5000,
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "poll_for_frame",
+              []( const rs2::motion_batcher & self ) {
+                  rs2::frame f;
+                  self.poll_for_frame( &f );
+                  return f;
+              },
+              "Check if a batch (or another frame) is available" )
+        .def( "try_wait_for_frame",
+              []( const rs2::motion_batcher & self, unsigned int timeout_ms ) {
+                  rs2::frame f;
+                  auto success = self.try_wait_for_frame( &f, timeout_ms );
+                  return std::make_tuple( success, f );
+              },
+              "timeout_ms"_a = 5000,
+              py::call_guard< py::gil_scoped_release >() )
+        .def( "set_intrinsics",
+              &rs2::motion_batcher::set_intrinsics,
+              "Correct the batches of a stream type with the given motion intrinsics (scale, cross-axis and bias)",
+              "stream"_a,
+              "intrinsics"_a )
+        .def( "__call__", &rs2::motion_batcher::operator(), "frame"_a );
+
     py::class_<rs2::align, rs2::filter> align(m, "align", "Performs alignment between depth image and another image.");
     align.def(py::init<rs2_stream>(), "To perform alignment of a depth image to the other, set the align_to parameter with the other stream type.\n"
               "To perform alignment of a non depth image to a depth image, set the align_to parameter to RS2_STREAM_DEPTH.\n"